@@ -173,17 +173,59 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.01, double b_sigma = 0.01, double A_tau = 10) {
-        typedef SEXP(*Ptr_fast_normal_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+    inline Rcpp::List sim_linear_reg_big(SEXP bigX, int q = 5, double R2 = 0.95, double X_cor = 0.5, double beta_size = 1, int seed = 2022, int block_size = 256, int n_threads = 0) {
+        typedef SEXP(*Ptr_sim_linear_reg_big)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sim_linear_reg_big p_sim_linear_reg_big = NULL;
+        if (p_sim_linear_reg_big == NULL) {
+            validateSignature("Rcpp::List(*sim_linear_reg_big)(SEXP,int,double,double,double,int,int,int)");
+            p_sim_linear_reg_big = (Ptr_sim_linear_reg_big)R_GetCCallable("fastBayesReg", "_fastBayesReg_sim_linear_reg_big");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_sim_linear_reg_big(Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(q)), Shield<SEXP>(Rcpp::wrap(R2)), Shield<SEXP>(Rcpp::wrap(X_cor)), Shield<SEXP>(Rcpp::wrap(beta_size)), Shield<SEXP>(Rcpp::wrap(seed)), Shield<SEXP>(Rcpp::wrap(block_size)), Shield<SEXP>(Rcpp::wrap(n_threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List sim_logit_reg_big(SEXP bigX, int q = 5, double X_cor = 0.5, double X_var = 10, double beta_size = 1, int seed = 2022, int block_size = 256, int n_threads = 0) {
+        typedef SEXP(*Ptr_sim_logit_reg_big)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sim_logit_reg_big p_sim_logit_reg_big = NULL;
+        if (p_sim_logit_reg_big == NULL) {
+            validateSignature("Rcpp::List(*sim_logit_reg_big)(SEXP,int,double,double,double,int,int,int)");
+            p_sim_logit_reg_big = (Ptr_sim_logit_reg_big)R_GetCCallable("fastBayesReg", "_fastBayesReg_sim_logit_reg_big");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_sim_logit_reg_big(Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(q)), Shield<SEXP>(Rcpp::wrap(X_cor)), Shield<SEXP>(Rcpp::wrap(X_var)), Shield<SEXP>(Rcpp::wrap(beta_size)), Shield<SEXP>(Rcpp::wrap(seed)), Shield<SEXP>(Rcpp::wrap(block_size)), Shield<SEXP>(Rcpp::wrap(n_threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.01, double b_sigma = 0.01, double A_tau = 10, bool collapsed = false) {
+        typedef SEXP(*Ptr_fast_normal_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_fast_normal_lm p_fast_normal_lm = NULL;
         if (p_fast_normal_lm == NULL) {
-            validateSignature("Rcpp::List(*fast_normal_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double)");
+            validateSignature("Rcpp::List(*fast_normal_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,bool)");
             p_fast_normal_lm = (Ptr_fast_normal_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_normal_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+            rcpp_result_gen = p_fast_normal_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(collapsed)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -257,17 +299,38 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_normal_logit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
-        typedef SEXP(*Ptr_fast_normal_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+    inline Rcpp::List big_normal_multi_lm(SEXP bigY, arma::mat& X, SEXP bigB, int block_size = 1000, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.01, double b_sigma = 0.01, double A_tau = 10, int seed = 2022, int n_threads = 0) {
+        typedef SEXP(*Ptr_big_normal_multi_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_big_normal_multi_lm p_big_normal_multi_lm = NULL;
+        if (p_big_normal_multi_lm == NULL) {
+            validateSignature("Rcpp::List(*big_normal_multi_lm)(SEXP,arma::mat&,SEXP,int,int,int,int,double,double,double,int,int)");
+            p_big_normal_multi_lm = (Ptr_big_normal_multi_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_big_normal_multi_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_big_normal_multi_lm(Shield<SEXP>(Rcpp::wrap(bigY)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(bigB)), Shield<SEXP>(Rcpp::wrap(block_size)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(seed)), Shield<SEXP>(Rcpp::wrap(n_threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_logit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, bool asis = false) {
+        typedef SEXP(*Ptr_fast_normal_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_fast_normal_logit p_fast_normal_logit = NULL;
         if (p_fast_normal_logit == NULL) {
-            validateSignature("Rcpp::List(*fast_normal_logit)(arma::vec&,arma::mat&,int,int,int,double)");
+            validateSignature("Rcpp::List(*fast_normal_logit)(arma::vec&,arma::mat&,int,int,int,double,bool)");
             p_fast_normal_logit = (Ptr_fast_normal_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_normal_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+            rcpp_result_gen = p_fast_normal_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(asis)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -278,17 +341,80 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0) {
-        typedef SEXP(*Ptr_fast_normal_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+    inline Rcpp::List fast_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = -1, int thinning = 1, double A_tau = 1, int verbose = 0, std::string init = "zero") {
+        typedef SEXP(*Ptr_fast_normal_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_fast_normal_logit_single_gibbs p_fast_normal_logit_single_gibbs = NULL;
         if (p_fast_normal_logit_single_gibbs == NULL) {
-            validateSignature("Rcpp::List(*fast_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int)");
+            validateSignature("Rcpp::List(*fast_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int,std::string)");
             p_fast_normal_logit_single_gibbs = (Ptr_fast_normal_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_normal_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)));
+            rcpp_result_gen = p_fast_normal_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)), Shield<SEXP>(Rcpp::wrap(init)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_logit_block_gibbs(arma::vec& y, arma::mat& X, int block_size = 32, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, bool mcmc_output = true, int window = 0) {
+        typedef SEXP(*Ptr_fast_normal_logit_block_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_logit_block_gibbs p_fast_normal_logit_block_gibbs = NULL;
+        if (p_fast_normal_logit_block_gibbs == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_logit_block_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,bool,int)");
+            p_fast_normal_logit_block_gibbs = (Ptr_fast_normal_logit_block_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_block_gibbs");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_logit_block_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(block_size)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(mcmc_output)), Shield<SEXP>(Rcpp::wrap(window)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List multilabel_normal_logit_single_gibbs(arma::mat& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, bool mcmc_output = true, int n_threads = 0, bool numa_interleave = false) {
+        typedef SEXP(*Ptr_multilabel_normal_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_multilabel_normal_logit_single_gibbs p_multilabel_normal_logit_single_gibbs = NULL;
+        if (p_multilabel_normal_logit_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*multilabel_normal_logit_single_gibbs)(arma::mat&,arma::mat&,int,int,int,double,bool,int,bool)");
+            p_multilabel_normal_logit_single_gibbs = (Ptr_multilabel_normal_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_multilabel_normal_logit_single_gibbs");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_multilabel_normal_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(mcmc_output)), Shield<SEXP>(Rcpp::wrap(n_threads)), Shield<SEXP>(Rcpp::wrap(numa_interleave)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_logit_sel_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double a_pi = 1, double b_pi = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_fast_normal_logit_sel_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_logit_sel_single_gibbs p_fast_normal_logit_sel_single_gibbs = NULL;
+        if (p_fast_normal_logit_sel_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_logit_sel_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,double,double,bool)");
+            p_fast_normal_logit_sel_single_gibbs = (Ptr_fast_normal_logit_sel_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_sel_single_gibbs");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_logit_sel_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(a_pi)), Shield<SEXP>(Rcpp::wrap(b_pi)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -362,17 +488,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
-        typedef SEXP(*Ptr_fast_normal_multiclass)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_normal_multiclass p_fast_normal_multiclass = NULL;
-        if (p_fast_normal_multiclass == NULL) {
-            validateSignature("Rcpp::List(*fast_normal_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
-            p_fast_normal_multiclass = (Ptr_fast_normal_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass");
+    inline Rcpp::List interaction_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0, bool mcmc_output = false) {
+        typedef SEXP(*Ptr_interaction_normal_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_interaction_normal_logit_single_gibbs p_interaction_normal_logit_single_gibbs = NULL;
+        if (p_interaction_normal_logit_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*interaction_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int,bool)");
+            p_interaction_normal_logit_single_gibbs = (Ptr_interaction_normal_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_interaction_normal_logit_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_normal_multiclass(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+            rcpp_result_gen = p_interaction_normal_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -383,17 +509,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0) {
-        typedef SEXP(*Ptr_fast_normal_multiclass_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_normal_multiclass_single_gibbs p_fast_normal_multiclass_single_gibbs = NULL;
-        if (p_fast_normal_multiclass_single_gibbs == NULL) {
-            validateSignature("Rcpp::List(*fast_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
-            p_fast_normal_multiclass_single_gibbs = (Ptr_fast_normal_multiclass_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass_single_gibbs");
+    inline Rcpp::List basis_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, arma::sp_mat& Phi, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_basis_normal_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_basis_normal_logit_single_gibbs p_basis_normal_logit_single_gibbs = NULL;
+        if (p_basis_normal_logit_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*basis_normal_logit_single_gibbs)(arma::vec&,arma::mat&,arma::sp_mat&,int,int,int,double,int,bool)");
+            p_basis_normal_logit_single_gibbs = (Ptr_basis_normal_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_basis_normal_logit_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_normal_multiclass_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)));
+            rcpp_result_gen = p_basis_normal_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(Phi)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -404,17 +530,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0) {
-        typedef SEXP(*Ptr_scalable_normal_multiclass_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_scalable_normal_multiclass_single_gibbs p_scalable_normal_multiclass_single_gibbs = NULL;
-        if (p_scalable_normal_multiclass_single_gibbs == NULL) {
-            validateSignature("Rcpp::List(*scalable_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
-            p_scalable_normal_multiclass_single_gibbs = (Ptr_scalable_normal_multiclass_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_scalable_normal_multiclass_single_gibbs");
+    inline Rcpp::List fast_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::mat& X, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_fast_binomial_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_binomial_single_gibbs p_fast_binomial_single_gibbs = NULL;
+        if (p_fast_binomial_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*fast_binomial_single_gibbs)(arma::vec&,arma::vec&,arma::mat&,std::string,int,int,int,double,double,bool)");
+            p_fast_binomial_single_gibbs = (Ptr_fast_binomial_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_binomial_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_scalable_normal_multiclass_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)));
+            rcpp_result_gen = p_fast_binomial_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(trials)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -425,17 +551,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X, int max_iter = 5000, double tol = 1e-05, double A = 10, double in_E_inv_tau_sq = 1, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue) {
-        typedef SEXP(*Ptr_fast_mfvb_normal_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_mfvb_normal_logit p_fast_mfvb_normal_logit = NULL;
-        if (p_fast_mfvb_normal_logit == NULL) {
-            validateSignature("Rcpp::List(*fast_mfvb_normal_logit)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
-            p_fast_mfvb_normal_logit = (Ptr_fast_mfvb_normal_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit");
+    inline Rcpp::List sparse_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::sp_mat& X, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_sparse_binomial_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sparse_binomial_single_gibbs p_sparse_binomial_single_gibbs = NULL;
+        if (p_sparse_binomial_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*sparse_binomial_single_gibbs)(arma::vec&,arma::vec&,arma::sp_mat&,std::string,int,int,int,double,double,bool)");
+            p_sparse_binomial_single_gibbs = (Ptr_sparse_binomial_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_sparse_binomial_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_mfvb_normal_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)), Shield<SEXP>(Rcpp::wrap(A)), Shield<SEXP>(Rcpp::wrap(in_E_inv_tau_sq)), Shield<SEXP>(Rcpp::wrap(in_E_omega)), Shield<SEXP>(Rcpp::wrap(in_E_beta)));
+            rcpp_result_gen = p_sparse_binomial_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(trials)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -446,17 +572,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X, int max_iter = 5000, double tol = 1e-05, double A = 10, double in_E_inv_tau_sq = 1, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue) {
-        typedef SEXP(*Ptr_fast_mfvb_normal_logit_single)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_mfvb_normal_logit_single p_fast_mfvb_normal_logit_single = NULL;
-        if (p_fast_mfvb_normal_logit_single == NULL) {
-            validateSignature("Rcpp::List(*fast_mfvb_normal_logit_single)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
-            p_fast_mfvb_normal_logit_single = (Ptr_fast_mfvb_normal_logit_single)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit_single");
+    inline Rcpp::List big_binomial_single_gibbs(arma::vec& y, arma::vec& trials, SEXP bigX, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_big_binomial_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_big_binomial_single_gibbs p_big_binomial_single_gibbs = NULL;
+        if (p_big_binomial_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*big_binomial_single_gibbs)(arma::vec&,arma::vec&,SEXP,std::string,int,int,int,double,double,bool)");
+            p_big_binomial_single_gibbs = (Ptr_big_binomial_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_big_binomial_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_mfvb_normal_logit_single(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)), Shield<SEXP>(Rcpp::wrap(A)), Shield<SEXP>(Rcpp::wrap(in_E_inv_tau_sq)), Shield<SEXP>(Rcpp::wrap(in_E_omega)), Shield<SEXP>(Rcpp::wrap(in_E_beta)));
+            rcpp_result_gen = p_big_binomial_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(trials)), Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -467,17 +593,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
-        typedef SEXP(*Ptr_fast_mfvb_multiclass)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_mfvb_multiclass p_fast_mfvb_multiclass = NULL;
-        if (p_fast_mfvb_multiclass == NULL) {
-            validateSignature("Rcpp::List(*fast_mfvb_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
-            p_fast_mfvb_multiclass = (Ptr_fast_mfvb_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_multiclass");
+    inline Rcpp::List fast_negbin_single_gibbs(arma::vec& y, arma::mat& X, double r = 1, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_fast_negbin_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_negbin_single_gibbs p_fast_negbin_single_gibbs = NULL;
+        if (p_fast_negbin_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*fast_negbin_single_gibbs)(arma::vec&,arma::mat&,double,std::string,int,int,int,double,double,bool)");
+            p_fast_negbin_single_gibbs = (Ptr_fast_negbin_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_negbin_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_mfvb_multiclass(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+            rcpp_result_gen = p_fast_negbin_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(r)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -488,17 +614,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1) {
-        typedef SEXP(*Ptr_fast_horseshoe_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_horseshoe_logit p_fast_horseshoe_logit = NULL;
-        if (p_fast_horseshoe_logit == NULL) {
-            validateSignature("Rcpp::List(*fast_horseshoe_logit)(arma::vec&,arma::mat&,int,int,int,double,double)");
-            p_fast_horseshoe_logit = (Ptr_fast_horseshoe_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_logit");
+    inline Rcpp::List sparse_negbin_single_gibbs(arma::vec& y, arma::sp_mat& X, double r = 1, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_sparse_negbin_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sparse_negbin_single_gibbs p_sparse_negbin_single_gibbs = NULL;
+        if (p_sparse_negbin_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*sparse_negbin_single_gibbs)(arma::vec&,arma::sp_mat&,double,std::string,int,int,int,double,double,bool)");
+            p_sparse_negbin_single_gibbs = (Ptr_sparse_negbin_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_sparse_negbin_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_horseshoe_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+            rcpp_result_gen = p_sparse_negbin_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(r)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -509,17 +635,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline arma::vec rand_left_trucnorm0(int n, double lower, double ratio = 1.0) {
-        typedef SEXP(*Ptr_rand_left_trucnorm0)(SEXP,SEXP,SEXP);
-        static Ptr_rand_left_trucnorm0 p_rand_left_trucnorm0 = NULL;
-        if (p_rand_left_trucnorm0 == NULL) {
-            validateSignature("arma::vec(*rand_left_trucnorm0)(int,double,double)");
-            p_rand_left_trucnorm0 = (Ptr_rand_left_trucnorm0)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm0");
+    inline Rcpp::List big_negbin_single_gibbs(arma::vec& y, SEXP bigX, double r = 1, std::string prior = "normal", int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_big_negbin_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_big_negbin_single_gibbs p_big_negbin_single_gibbs = NULL;
+        if (p_big_negbin_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*big_negbin_single_gibbs)(arma::vec&,SEXP,double,std::string,int,int,int,double,double,bool)");
+            p_big_negbin_single_gibbs = (Ptr_big_negbin_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_big_negbin_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_rand_left_trucnorm0(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(ratio)));
+            rcpp_result_gen = p_big_negbin_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(r)), Shield<SEXP>(Rcpp::wrap(prior)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -527,20 +653,20 @@ namespace fastBayesReg {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<arma::vec >(rcpp_result_gen);
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline arma::vec rand_left_trucnorm(int n, double mu, double sigma, double lower, double ratio = 1.0) {
-        typedef SEXP(*Ptr_rand_left_trucnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_rand_left_trucnorm p_rand_left_trucnorm = NULL;
-        if (p_rand_left_trucnorm == NULL) {
-            validateSignature("arma::vec(*rand_left_trucnorm)(int,double,double,double,double)");
-            p_rand_left_trucnorm = (Ptr_rand_left_trucnorm)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm");
+    inline Rcpp::List sparse_horseshoe_lm_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_sparse_horseshoe_lm_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sparse_horseshoe_lm_single_gibbs p_sparse_horseshoe_lm_single_gibbs = NULL;
+        if (p_sparse_horseshoe_lm_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*sparse_horseshoe_lm_single_gibbs)(arma::vec&,arma::sp_mat&,int,int,int,double,double,double,double,bool)");
+            p_sparse_horseshoe_lm_single_gibbs = (Ptr_sparse_horseshoe_lm_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_sparse_horseshoe_lm_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_rand_left_trucnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(ratio)));
+            rcpp_result_gen = p_sparse_horseshoe_lm_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -548,20 +674,20 @@ namespace fastBayesReg {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<arma::vec >(rcpp_result_gen);
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline arma::vec rand_right_trucnorm(int n, double mu, double sigma, double upper, double ratio = 1.0) {
-        typedef SEXP(*Ptr_rand_right_trucnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_rand_right_trucnorm p_rand_right_trucnorm = NULL;
-        if (p_rand_right_trucnorm == NULL) {
-            validateSignature("arma::vec(*rand_right_trucnorm)(int,double,double,double,double)");
-            p_rand_right_trucnorm = (Ptr_rand_right_trucnorm)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_right_trucnorm");
+    inline Rcpp::List big_horseshoe_lm_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_big_horseshoe_lm_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_big_horseshoe_lm_single_gibbs p_big_horseshoe_lm_single_gibbs = NULL;
+        if (p_big_horseshoe_lm_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*big_horseshoe_lm_single_gibbs)(arma::vec&,SEXP,int,int,int,double,double,double,double,bool)");
+            p_big_horseshoe_lm_single_gibbs = (Ptr_big_horseshoe_lm_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_big_horseshoe_lm_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_rand_right_trucnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(ratio)));
+            rcpp_result_gen = p_big_horseshoe_lm_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -569,20 +695,20 @@ namespace fastBayesReg {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<arma::vec >(rcpp_result_gen);
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1) {
-        typedef SEXP(*Ptr_fast_horseshoe_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_horseshoe_lm p_fast_horseshoe_lm = NULL;
-        if (p_fast_horseshoe_lm == NULL) {
-            validateSignature("Rcpp::List(*fast_horseshoe_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
-            p_fast_horseshoe_lm = (Ptr_fast_horseshoe_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_lm");
+    inline Rcpp::List sparse_horseshoe_logit_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_sparse_horseshoe_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_sparse_horseshoe_logit_single_gibbs p_sparse_horseshoe_logit_single_gibbs = NULL;
+        if (p_sparse_horseshoe_logit_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*sparse_horseshoe_logit_single_gibbs)(arma::vec&,arma::sp_mat&,int,int,int,double,double,bool)");
+            p_sparse_horseshoe_logit_single_gibbs = (Ptr_sparse_horseshoe_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_sparse_horseshoe_logit_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_horseshoe_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+            rcpp_result_gen = p_sparse_horseshoe_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -593,17 +719,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1) {
-        typedef SEXP(*Ptr_fast_horseshoe_ss_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_horseshoe_ss_lm p_fast_horseshoe_ss_lm = NULL;
-        if (p_fast_horseshoe_ss_lm == NULL) {
-            validateSignature("Rcpp::List(*fast_horseshoe_ss_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
-            p_fast_horseshoe_ss_lm = (Ptr_fast_horseshoe_ss_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_ss_lm");
+    inline Rcpp::List big_horseshoe_logit_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true) {
+        typedef SEXP(*Ptr_big_horseshoe_logit_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_big_horseshoe_logit_single_gibbs p_big_horseshoe_logit_single_gibbs = NULL;
+        if (p_big_horseshoe_logit_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*big_horseshoe_logit_single_gibbs)(arma::vec&,SEXP,int,int,int,double,double,bool)");
+            p_big_horseshoe_logit_single_gibbs = (Ptr_big_horseshoe_logit_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_big_horseshoe_logit_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_horseshoe_ss_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+            rcpp_result_gen = p_big_horseshoe_logit_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(bigX)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -614,17 +740,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1) {
-        typedef SEXP(*Ptr_fast_horseshoe_hd_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_fast_horseshoe_hd_lm p_fast_horseshoe_hd_lm = NULL;
-        if (p_fast_horseshoe_hd_lm == NULL) {
-            validateSignature("Rcpp::List(*fast_horseshoe_hd_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
-            p_fast_horseshoe_hd_lm = (Ptr_fast_horseshoe_hd_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_hd_lm");
+    inline Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
+        typedef SEXP(*Ptr_fast_normal_multiclass)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_multiclass p_fast_normal_multiclass = NULL;
+        if (p_fast_normal_multiclass == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
+            p_fast_normal_multiclass = (Ptr_fast_normal_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_fast_horseshoe_hd_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+            rcpp_result_gen = p_fast_normal_multiclass(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -635,17 +761,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95) {
-        typedef SEXP(*Ptr_predict_fast_lm)(SEXP,SEXP,SEXP);
-        static Ptr_predict_fast_lm p_predict_fast_lm = NULL;
-        if (p_predict_fast_lm == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_lm)(Rcpp::List&,arma::mat&,double)");
-            p_predict_fast_lm = (Ptr_predict_fast_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_lm");
+    inline Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0) {
+        typedef SEXP(*Ptr_fast_normal_multiclass_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_multiclass_single_gibbs p_fast_normal_multiclass_single_gibbs = NULL;
+        if (p_fast_normal_multiclass_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
+            p_fast_normal_multiclass_single_gibbs = (Ptr_fast_normal_multiclass_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)));
+            rcpp_result_gen = p_fast_normal_multiclass_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -656,17 +782,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test) {
-        typedef SEXP(*Ptr_predict_fast_multi_lm)(SEXP,SEXP);
-        static Ptr_predict_fast_multi_lm p_predict_fast_multi_lm = NULL;
-        if (p_predict_fast_multi_lm == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_multi_lm)(Rcpp::List&,arma::mat&)");
-            p_predict_fast_multi_lm = (Ptr_predict_fast_multi_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_multi_lm");
+    inline Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, int verbose = 0) {
+        typedef SEXP(*Ptr_scalable_normal_multiclass_single_gibbs)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_scalable_normal_multiclass_single_gibbs p_scalable_normal_multiclass_single_gibbs = NULL;
+        if (p_scalable_normal_multiclass_single_gibbs == NULL) {
+            validateSignature("Rcpp::List(*scalable_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
+            p_scalable_normal_multiclass_single_gibbs = (Ptr_scalable_normal_multiclass_single_gibbs)R_GetCCallable("fastBayesReg", "_fastBayesReg_scalable_normal_multiclass_single_gibbs");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_multi_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+            rcpp_result_gen = p_scalable_normal_multiclass_single_gibbs(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(verbose)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -677,17 +803,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test) {
-        typedef SEXP(*Ptr_predict_fast_mfvb_lm)(SEXP,SEXP);
-        static Ptr_predict_fast_mfvb_lm p_predict_fast_mfvb_lm = NULL;
-        if (p_predict_fast_mfvb_lm == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_mfvb_lm)(Rcpp::List&,arma::mat&)");
-            p_predict_fast_mfvb_lm = (Ptr_predict_fast_mfvb_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_mfvb_lm");
+    inline Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X, int max_iter = 5000, double tol = 1e-05, double A = 10, double in_E_inv_tau_sq = 1, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue) {
+        typedef SEXP(*Ptr_fast_mfvb_normal_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_mfvb_normal_logit p_fast_mfvb_normal_logit = NULL;
+        if (p_fast_mfvb_normal_logit == NULL) {
+            validateSignature("Rcpp::List(*fast_mfvb_normal_logit)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
+            p_fast_mfvb_normal_logit = (Ptr_fast_mfvb_normal_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_mfvb_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+            rcpp_result_gen = p_fast_mfvb_normal_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)), Shield<SEXP>(Rcpp::wrap(A)), Shield<SEXP>(Rcpp::wrap(in_E_inv_tau_sq)), Shield<SEXP>(Rcpp::wrap(in_E_omega)), Shield<SEXP>(Rcpp::wrap(in_E_beta)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -698,17 +824,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95, double cutoff = 0.5) {
-        typedef SEXP(*Ptr_predict_fast_logit)(SEXP,SEXP,SEXP,SEXP);
-        static Ptr_predict_fast_logit p_predict_fast_logit = NULL;
-        if (p_predict_fast_logit == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_logit)(Rcpp::List&,arma::mat&,double,double)");
-            p_predict_fast_logit = (Ptr_predict_fast_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_logit");
+    inline Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X, int max_iter = 5000, double tol = 1e-05, double A = 10, double in_E_inv_tau_sq = 1, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue) {
+        typedef SEXP(*Ptr_fast_mfvb_normal_logit_single)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_mfvb_normal_logit_single p_fast_mfvb_normal_logit_single = NULL;
+        if (p_fast_mfvb_normal_logit_single == NULL) {
+            validateSignature("Rcpp::List(*fast_mfvb_normal_logit_single)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
+            p_fast_mfvb_normal_logit_single = (Ptr_fast_mfvb_normal_logit_single)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit_single");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_logit(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(cutoff)));
+            rcpp_result_gen = p_fast_mfvb_normal_logit_single(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)), Shield<SEXP>(Rcpp::wrap(A)), Shield<SEXP>(Rcpp::wrap(in_E_inv_tau_sq)), Shield<SEXP>(Rcpp::wrap(in_E_omega)), Shield<SEXP>(Rcpp::wrap(in_E_beta)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -719,17 +845,17 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit, arma::mat& X_test) {
-        typedef SEXP(*Ptr_predict_fast_multiclass)(SEXP,SEXP);
-        static Ptr_predict_fast_multiclass p_predict_fast_multiclass = NULL;
-        if (p_predict_fast_multiclass == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_multiclass)(Rcpp::List&,arma::mat&)");
-            p_predict_fast_multiclass = (Ptr_predict_fast_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_multiclass");
+    inline Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
+        typedef SEXP(*Ptr_fast_mfvb_multiclass)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_mfvb_multiclass p_fast_mfvb_multiclass = NULL;
+        if (p_fast_mfvb_multiclass == NULL) {
+            validateSignature("Rcpp::List(*fast_mfvb_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
+            p_fast_mfvb_multiclass = (Ptr_fast_mfvb_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_multiclass");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_multiclass(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+            rcpp_result_gen = p_fast_mfvb_multiclass(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(num_class)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -740,17 +866,374 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
-    inline Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95, double cutoff = 0.5) {
-        typedef SEXP(*Ptr_predict_fast_mfvb_logit)(SEXP,SEXP,SEXP,SEXP);
-        static Ptr_predict_fast_mfvb_logit p_predict_fast_mfvb_logit = NULL;
-        if (p_predict_fast_mfvb_logit == NULL) {
-            validateSignature("Rcpp::List(*predict_fast_mfvb_logit)(Rcpp::List&,arma::mat&,double,double)");
-            p_predict_fast_mfvb_logit = (Ptr_predict_fast_mfvb_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_mfvb_logit");
+    inline Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1, bool asis = false) {
+        typedef SEXP(*Ptr_fast_horseshoe_logit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_logit p_fast_horseshoe_logit = NULL;
+        if (p_fast_horseshoe_logit == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_logit)(arma::vec&,arma::mat&,int,int,int,double,double,bool)");
+            p_fast_horseshoe_logit = (Ptr_fast_horseshoe_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_logit");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_predict_fast_mfvb_logit(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(cutoff)));
+            rcpp_result_gen = p_fast_horseshoe_logit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(asis)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline arma::vec rand_left_trucnorm0(int n, double lower, double ratio = 1.0) {
+        typedef SEXP(*Ptr_rand_left_trucnorm0)(SEXP,SEXP,SEXP);
+        static Ptr_rand_left_trucnorm0 p_rand_left_trucnorm0 = NULL;
+        if (p_rand_left_trucnorm0 == NULL) {
+            validateSignature("arma::vec(*rand_left_trucnorm0)(int,double,double)");
+            p_rand_left_trucnorm0 = (Ptr_rand_left_trucnorm0)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm0");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_rand_left_trucnorm0(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(ratio)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<arma::vec >(rcpp_result_gen);
+    }
+
+    inline arma::vec rand_left_trucnorm(int n, double mu, double sigma, double lower, double ratio = 1.0) {
+        typedef SEXP(*Ptr_rand_left_trucnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_rand_left_trucnorm p_rand_left_trucnorm = NULL;
+        if (p_rand_left_trucnorm == NULL) {
+            validateSignature("arma::vec(*rand_left_trucnorm)(int,double,double,double,double)");
+            p_rand_left_trucnorm = (Ptr_rand_left_trucnorm)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_rand_left_trucnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(ratio)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<arma::vec >(rcpp_result_gen);
+    }
+
+    inline arma::vec rand_right_trucnorm(int n, double mu, double sigma, double upper, double ratio = 1.0) {
+        typedef SEXP(*Ptr_rand_right_trucnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_rand_right_trucnorm p_rand_right_trucnorm = NULL;
+        if (p_rand_right_trucnorm == NULL) {
+            validateSignature("arma::vec(*rand_right_trucnorm)(int,double,double,double,double)");
+            p_rand_right_trucnorm = (Ptr_rand_right_trucnorm)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_right_trucnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_rand_right_trucnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(ratio)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<arma::vec >(rcpp_result_gen);
+    }
+
+    inline arma::vec rand_trucnorm(arma::vec& mu, arma::vec& sigma, arma::vec& lower, arma::vec& upper, int seed = 2022, int n_threads = 0) {
+        typedef SEXP(*Ptr_rand_trucnorm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_rand_trucnorm p_rand_trucnorm = NULL;
+        if (p_rand_trucnorm == NULL) {
+            validateSignature("arma::vec(*rand_trucnorm)(arma::vec&,arma::vec&,arma::vec&,arma::vec&,int,int)");
+            p_rand_trucnorm = (Ptr_rand_trucnorm)R_GetCCallable("fastBayesReg", "_fastBayesReg_rand_trucnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_rand_trucnorm(Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(seed)), Shield<SEXP>(Rcpp::wrap(n_threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<arma::vec >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_probit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1) {
+        typedef SEXP(*Ptr_fast_normal_probit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_probit p_fast_normal_probit = NULL;
+        if (p_fast_normal_probit == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_probit)(arma::vec&,arma::mat&,int,int,int,double)");
+            p_fast_normal_probit = (Ptr_fast_normal_probit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_probit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_probit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_probit(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double A_tau = 1, double A_lambda = 1) {
+        typedef SEXP(*Ptr_fast_horseshoe_probit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_probit p_fast_horseshoe_probit = NULL;
+        if (p_fast_horseshoe_probit == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_probit)(arma::vec&,arma::mat&,int,int,int,double,double)");
+            p_fast_horseshoe_probit = (Ptr_fast_horseshoe_probit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_probit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_probit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_tobit(arma::vec& y, arma::mat& X, arma::vec& lower, arma::vec& upper, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.01, double b_sigma = 0.01, double A_tau = 10) {
+        typedef SEXP(*Ptr_fast_normal_tobit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_tobit p_fast_normal_tobit = NULL;
+        if (p_fast_normal_tobit == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_tobit)(arma::vec&,arma::mat&,arma::vec&,arma::vec&,int,int,int,double,double,double)");
+            p_fast_normal_tobit = (Ptr_fast_normal_tobit)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_tobit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_tobit(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1, bool asis = false) {
+        typedef SEXP(*Ptr_fast_horseshoe_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_lm p_fast_horseshoe_lm = NULL;
+        if (p_fast_horseshoe_lm == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double,bool)");
+            p_fast_horseshoe_lm = (Ptr_fast_horseshoe_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(asis)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1) {
+        typedef SEXP(*Ptr_fast_horseshoe_ss_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_ss_lm p_fast_horseshoe_ss_lm = NULL;
+        if (p_fast_horseshoe_ss_lm == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_ss_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
+            p_fast_horseshoe_ss_lm = (Ptr_fast_horseshoe_ss_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_ss_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_ss_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X, int mcmc_sample = 500, int burnin = -1, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1, int screen_size = 0, int screen_every = 50, std::string init = "zero") {
+        typedef SEXP(*Ptr_fast_horseshoe_hd_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_hd_lm p_fast_horseshoe_hd_lm = NULL;
+        if (p_fast_horseshoe_hd_lm == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_hd_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double,int,int,std::string)");
+            p_fast_horseshoe_hd_lm = (Ptr_fast_horseshoe_hd_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_hd_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_hd_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(screen_size)), Shield<SEXP>(Rcpp::wrap(screen_every)), Shield<SEXP>(Rcpp::wrap(init)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_multi_lm(arma::mat& y, arma::mat& X, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1, bool mcmc_output = true, int n_threads = 0, bool display_progress = false) {
+        typedef SEXP(*Ptr_fast_horseshoe_multi_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_multi_lm p_fast_horseshoe_multi_lm = NULL;
+        if (p_fast_horseshoe_multi_lm == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_multi_lm)(arma::mat&,arma::mat&,int,int,int,double,double,double,double,bool,int,bool)");
+            p_fast_horseshoe_multi_lm = (Ptr_fast_horseshoe_multi_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_multi_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_multi_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(mcmc_output)), Shield<SEXP>(Rcpp::wrap(n_threads)), Shield<SEXP>(Rcpp::wrap(display_progress)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95) {
+        typedef SEXP(*Ptr_predict_fast_lm)(SEXP,SEXP,SEXP);
+        static Ptr_predict_fast_lm p_predict_fast_lm = NULL;
+        if (p_predict_fast_lm == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_lm)(Rcpp::List&,arma::mat&,double)");
+            p_predict_fast_lm = (Ptr_predict_fast_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test) {
+        typedef SEXP(*Ptr_predict_fast_multi_lm)(SEXP,SEXP);
+        static Ptr_predict_fast_multi_lm p_predict_fast_multi_lm = NULL;
+        if (p_predict_fast_multi_lm == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_multi_lm)(Rcpp::List&,arma::mat&)");
+            p_predict_fast_multi_lm = (Ptr_predict_fast_multi_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_multi_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_multi_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test) {
+        typedef SEXP(*Ptr_predict_fast_mfvb_lm)(SEXP,SEXP);
+        static Ptr_predict_fast_mfvb_lm p_predict_fast_mfvb_lm = NULL;
+        if (p_predict_fast_mfvb_lm == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_mfvb_lm)(Rcpp::List&,arma::mat&)");
+            p_predict_fast_mfvb_lm = (Ptr_predict_fast_mfvb_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_mfvb_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_mfvb_lm(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95, double cutoff = 0.5) {
+        typedef SEXP(*Ptr_predict_fast_logit)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_predict_fast_logit p_predict_fast_logit = NULL;
+        if (p_predict_fast_logit == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_logit)(Rcpp::List&,arma::mat&,double,double)");
+            p_predict_fast_logit = (Ptr_predict_fast_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_logit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_logit(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(cutoff)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit, arma::mat& X_test) {
+        typedef SEXP(*Ptr_predict_fast_multiclass)(SEXP,SEXP);
+        static Ptr_predict_fast_multiclass p_predict_fast_multiclass = NULL;
+        if (p_predict_fast_multiclass == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_multiclass)(Rcpp::List&,arma::mat&)");
+            p_predict_fast_multiclass = (Ptr_predict_fast_multiclass)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_multiclass");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_multiclass(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95, double cutoff = 0.5) {
+        typedef SEXP(*Ptr_predict_fast_mfvb_logit)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_predict_fast_mfvb_logit p_predict_fast_mfvb_logit = NULL;
+        if (p_predict_fast_mfvb_logit == NULL) {
+            validateSignature("Rcpp::List(*predict_fast_mfvb_logit)(Rcpp::List&,arma::mat&,double,double)");
+            p_predict_fast_mfvb_logit = (Ptr_predict_fast_mfvb_logit)R_GetCCallable("fastBayesReg", "_fastBayesReg_predict_fast_mfvb_logit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_predict_fast_mfvb_logit(Shield<SEXP>(Rcpp::wrap(model_fit)), Shield<SEXP>(Rcpp::wrap(X_test)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(cutoff)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -845,6 +1328,321 @@ namespace fastBayesReg {
         return Rcpp::as<Rcpp::List >(rcpp_result_gen);
     }
 
+    inline Rcpp::List super_fast_normal_lm_batch(arma::vec& y, arma::mat& X, arma::ivec& group, double theta = -1.0, int n_threads = 0, bool numa_interleave = false) {
+        typedef SEXP(*Ptr_super_fast_normal_lm_batch)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_super_fast_normal_lm_batch p_super_fast_normal_lm_batch = NULL;
+        if (p_super_fast_normal_lm_batch == NULL) {
+            validateSignature("Rcpp::List(*super_fast_normal_lm_batch)(arma::vec&,arma::mat&,arma::ivec&,double,int,bool)");
+            p_super_fast_normal_lm_batch = (Ptr_super_fast_normal_lm_batch)R_GetCCallable("fastBayesReg", "_fastBayesReg_super_fast_normal_lm_batch");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_super_fast_normal_lm_batch(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(group)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(n_threads)), Shield<SEXP>(Rcpp::wrap(numa_interleave)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_lm_batch(arma::vec& y, arma::mat& X, arma::ivec& group, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.01, double b_sigma = 0.01, double A_tau = 10, bool display_progress = false) {
+        typedef SEXP(*Ptr_fast_normal_lm_batch)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_lm_batch p_fast_normal_lm_batch = NULL;
+        if (p_fast_normal_lm_batch == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_lm_batch)(arma::vec&,arma::mat&,arma::ivec&,int,int,int,double,double,double,bool)");
+            p_fast_normal_lm_batch = (Ptr_fast_normal_lm_batch)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm_batch");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_lm_batch(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(group)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(display_progress)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List super_fast_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& theta) {
+        typedef SEXP(*Ptr_super_fast_normal_lm_path)(SEXP,SEXP,SEXP);
+        static Ptr_super_fast_normal_lm_path p_super_fast_normal_lm_path = NULL;
+        if (p_super_fast_normal_lm_path == NULL) {
+            validateSignature("Rcpp::List(*super_fast_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&)");
+            p_super_fast_normal_lm_path = (Ptr_super_fast_normal_lm_path)R_GetCCallable("fastBayesReg", "_fastBayesReg_super_fast_normal_lm_path");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_super_fast_normal_lm_path(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(theta)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_mfvb_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector a_sigma = Rcpp::NumericVector::create(0.01), Rcpp::NumericVector b_sigma = Rcpp::NumericVector::create(0.01), int max_iter = 500, double tol = 1e-5) {
+        typedef SEXP(*Ptr_fast_mfvb_normal_lm_path)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_mfvb_normal_lm_path p_fast_mfvb_normal_lm_path = NULL;
+        if (p_fast_mfvb_normal_lm_path == NULL) {
+            validateSignature("Rcpp::List(*fast_mfvb_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,Rcpp::NumericVector,int,double)");
+            p_fast_mfvb_normal_lm_path = (Ptr_fast_mfvb_normal_lm_path)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_lm_path");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_mfvb_normal_lm_path(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_mfvb_normal_logit_path(arma::vec& y, arma::mat& X, arma::vec& A, int max_iter = 5000, double tol = 1e-05) {
+        typedef SEXP(*Ptr_fast_mfvb_normal_logit_path)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_mfvb_normal_logit_path p_fast_mfvb_normal_logit_path = NULL;
+        if (p_fast_mfvb_normal_logit_path == NULL) {
+            validateSignature("Rcpp::List(*fast_mfvb_normal_logit_path)(arma::vec&,arma::mat&,arma::vec&,int,double)");
+            p_fast_mfvb_normal_logit_path = (Ptr_fast_mfvb_normal_logit_path)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit_path");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_mfvb_normal_logit_path(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(A)), Shield<SEXP>(Rcpp::wrap(max_iter)), Shield<SEXP>(Rcpp::wrap(tol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector a_sigma = Rcpp::NumericVector::create(0.01), Rcpp::NumericVector b_sigma = Rcpp::NumericVector::create(0.01), int mcmc_sample = 500, int burnin = 500, int burnin_warm = 100, int thinning = 1) {
+        typedef SEXP(*Ptr_fast_normal_lm_path)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_normal_lm_path p_fast_normal_lm_path = NULL;
+        if (p_fast_normal_lm_path == NULL) {
+            validateSignature("Rcpp::List(*fast_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,Rcpp::NumericVector,int,int,int,int)");
+            p_fast_normal_lm_path = (Ptr_fast_normal_lm_path)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm_path");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_normal_lm_path(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(burnin_warm)), Shield<SEXP>(Rcpp::wrap(thinning)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_horseshoe_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector A_lambda = Rcpp::NumericVector::create(1), double a_sigma = 0.0, double b_sigma = 0.0, int mcmc_sample = 500, int burnin = 500, int burnin_warm = 100, int thinning = 1) {
+        typedef SEXP(*Ptr_fast_horseshoe_lm_path)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_horseshoe_lm_path p_fast_horseshoe_lm_path = NULL;
+        if (p_fast_horseshoe_lm_path == NULL) {
+            validateSignature("Rcpp::List(*fast_horseshoe_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,double,double,int,int,int,int)");
+            p_fast_horseshoe_lm_path = (Ptr_fast_horseshoe_lm_path)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_lm_path");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_horseshoe_lm_path(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(burnin_warm)), Shield<SEXP>(Rcpp::wrap(thinning)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline int register_design(arma::mat& X, bool numa_interleave = false) {
+        typedef SEXP(*Ptr_register_design)(SEXP,SEXP);
+        static Ptr_register_design p_register_design = NULL;
+        if (p_register_design == NULL) {
+            validateSignature("int(*register_design)(arma::mat&,bool)");
+            p_register_design = (Ptr_register_design)R_GetCCallable("fastBayesReg", "_fastBayesReg_register_design");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_register_design(Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(numa_interleave)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline bool release_design(int design) {
+        typedef SEXP(*Ptr_release_design)(SEXP);
+        static Ptr_release_design p_release_design = NULL;
+        if (p_release_design == NULL) {
+            validateSignature("bool(*release_design)(int)");
+            p_release_design = (Ptr_release_design)R_GetCCallable("fastBayesReg", "_fastBayesReg_release_design");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_release_design(Shield<SEXP>(Rcpp::wrap(design)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<bool >(rcpp_result_gen);
+    }
+
+    inline int submit_fit(std::string fun, arma::vec& y, int design, Rcpp::Nullable<Rcpp::List> args = R_NilValue) {
+        typedef SEXP(*Ptr_submit_fit)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_submit_fit p_submit_fit = NULL;
+        if (p_submit_fit == NULL) {
+            validateSignature("int(*submit_fit)(std::string,arma::vec&,int,Rcpp::Nullable<Rcpp::List>)");
+            p_submit_fit = (Ptr_submit_fit)R_GetCCallable("fastBayesReg", "_fastBayesReg_submit_fit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_submit_fit(Shield<SEXP>(Rcpp::wrap(fun)), Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(design)), Shield<SEXP>(Rcpp::wrap(args)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<int >(rcpp_result_gen);
+    }
+
+    inline std::string poll_fit(int job) {
+        typedef SEXP(*Ptr_poll_fit)(SEXP);
+        static Ptr_poll_fit p_poll_fit = NULL;
+        if (p_poll_fit == NULL) {
+            validateSignature("std::string(*poll_fit)(int)");
+            p_poll_fit = (Ptr_poll_fit)R_GetCCallable("fastBayesReg", "_fastBayesReg_poll_fit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_poll_fit(Shield<SEXP>(Rcpp::wrap(job)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<std::string >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List wait_fit(int job) {
+        typedef SEXP(*Ptr_wait_fit)(SEXP);
+        static Ptr_wait_fit p_wait_fit = NULL;
+        if (p_wait_fit == NULL) {
+            validateSignature("Rcpp::List(*wait_fit)(int)");
+            p_wait_fit = (Ptr_wait_fit)R_GetCCallable("fastBayesReg", "_fastBayesReg_wait_fit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_wait_fit(Shield<SEXP>(Rcpp::wrap(job)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline bool cancel_fit(int job) {
+        typedef SEXP(*Ptr_cancel_fit)(SEXP);
+        static Ptr_cancel_fit p_cancel_fit = NULL;
+        if (p_cancel_fit == NULL) {
+            validateSignature("bool(*cancel_fit)(int)");
+            p_cancel_fit = (Ptr_cancel_fit)R_GetCCallable("fastBayesReg", "_fastBayesReg_cancel_fit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cancel_fit(Shield<SEXP>(Rcpp::wrap(job)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<bool >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List cv_fit(std::string fun, arma::vec& y, int design, arma::ivec& fold, Rcpp::Nullable<Rcpp::List> args = R_NilValue, int n_threads = 0) {
+        typedef SEXP(*Ptr_cv_fit)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cv_fit p_cv_fit = NULL;
+        if (p_cv_fit == NULL) {
+            validateSignature("Rcpp::List(*cv_fit)(std::string,arma::vec&,int,arma::ivec&,Rcpp::Nullable<Rcpp::List>,int)");
+            p_cv_fit = (Ptr_cv_fit)R_GetCCallable("fastBayesReg", "_fastBayesReg_cv_fit");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cv_fit(Shield<SEXP>(Rcpp::wrap(fun)), Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(design)), Shield<SEXP>(Rcpp::wrap(fold)), Shield<SEXP>(Rcpp::wrap(args)), Shield<SEXP>(Rcpp::wrap(n_threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List fast_scalar_img_lm(arma::vec& y, arma::mat& X, arma::sp_mat& Phi, int mcmc_sample = 500, int burnin = 500, int thinning = 1, double a_sigma = 0.0, double b_sigma = 0.0, double A_tau = 1, double A_lambda = 1) {
+        typedef SEXP(*Ptr_fast_scalar_img_lm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_fast_scalar_img_lm p_fast_scalar_img_lm = NULL;
+        if (p_fast_scalar_img_lm == NULL) {
+            validateSignature("Rcpp::List(*fast_scalar_img_lm)(arma::vec&,arma::mat&,arma::sp_mat&,int,int,int,double,double,double,double)");
+            p_fast_scalar_img_lm = (Ptr_fast_scalar_img_lm)R_GetCCallable("fastBayesReg", "_fastBayesReg_fast_scalar_img_lm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_fast_scalar_img_lm(Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(Phi)), Shield<SEXP>(Rcpp::wrap(mcmc_sample)), Shield<SEXP>(Rcpp::wrap(burnin)), Shield<SEXP>(Rcpp::wrap(thinning)), Shield<SEXP>(Rcpp::wrap(a_sigma)), Shield<SEXP>(Rcpp::wrap(b_sigma)), Shield<SEXP>(Rcpp::wrap(A_tau)), Shield<SEXP>(Rcpp::wrap(A_lambda)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
 }
 
 #endif // RCPP_fastBayesReg_RCPPEXPORTS_H_GEN_
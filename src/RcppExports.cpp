@@ -278,9 +278,91 @@ RcppExport SEXP _fastBayesReg_sim_multiclass_reg(SEXP KSEXP, SEXP nSEXP, SEXP pS
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// sim_linear_reg_big
+Rcpp::List sim_linear_reg_big(SEXP bigX, int q, double R2, double X_cor, double beta_size, int seed, int block_size, int n_threads);
+static SEXP _fastBayesReg_sim_linear_reg_big_try(SEXP bigXSEXP, SEXP qSEXP, SEXP R2SEXP, SEXP X_corSEXP, SEXP beta_sizeSEXP, SEXP seedSEXP, SEXP block_sizeSEXP, SEXP n_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< int >::type q(qSEXP);
+    Rcpp::traits::input_parameter< double >::type R2(R2SEXP);
+    Rcpp::traits::input_parameter< double >::type X_cor(X_corSEXP);
+    Rcpp::traits::input_parameter< double >::type beta_size(beta_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
+    Rcpp::traits::input_parameter< int >::type block_size(block_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(sim_linear_reg_big(bigX, q, R2, X_cor, beta_size, seed, block_size, n_threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_sim_linear_reg_big(SEXP bigXSEXP, SEXP qSEXP, SEXP R2SEXP, SEXP X_corSEXP, SEXP beta_sizeSEXP, SEXP seedSEXP, SEXP block_sizeSEXP, SEXP n_threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_sim_linear_reg_big_try(bigXSEXP, qSEXP, R2SEXP, X_corSEXP, beta_sizeSEXP, seedSEXP, block_sizeSEXP, n_threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// sim_logit_reg_big
+Rcpp::List sim_logit_reg_big(SEXP bigX, int q, double X_cor, double X_var, double beta_size, int seed, int block_size, int n_threads);
+static SEXP _fastBayesReg_sim_logit_reg_big_try(SEXP bigXSEXP, SEXP qSEXP, SEXP X_corSEXP, SEXP X_varSEXP, SEXP beta_sizeSEXP, SEXP seedSEXP, SEXP block_sizeSEXP, SEXP n_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< int >::type q(qSEXP);
+    Rcpp::traits::input_parameter< double >::type X_cor(X_corSEXP);
+    Rcpp::traits::input_parameter< double >::type X_var(X_varSEXP);
+    Rcpp::traits::input_parameter< double >::type beta_size(beta_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
+    Rcpp::traits::input_parameter< int >::type block_size(block_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(sim_logit_reg_big(bigX, q, X_cor, X_var, beta_size, seed, block_size, n_threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_sim_logit_reg_big(SEXP bigXSEXP, SEXP qSEXP, SEXP X_corSEXP, SEXP X_varSEXP, SEXP beta_sizeSEXP, SEXP seedSEXP, SEXP block_sizeSEXP, SEXP n_threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_sim_logit_reg_big_try(bigXSEXP, qSEXP, X_corSEXP, X_varSEXP, beta_sizeSEXP, seedSEXP, block_sizeSEXP, n_threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // fast_normal_lm
-Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau);
-static SEXP _fastBayesReg_fast_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP) {
+Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, bool collapsed);
+static SEXP _fastBayesReg_fast_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP collapsedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
@@ -291,15 +373,16 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_normal_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau));
+    Rcpp::traits::input_parameter< bool >::type collapsed(collapsedSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, collapsed));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP collapsedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, collapsedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -440,26 +523,32 @@ RcppExport SEXP _fastBayesReg_fast_normal_multi_lm(SEXP ySEXP, SEXP XSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_normal_logit
-Rcpp::List fast_normal_logit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau);
-static SEXP _fastBayesReg_fast_normal_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+// big_normal_multi_lm
+Rcpp::List big_normal_multi_lm(SEXP bigY, arma::mat& X, SEXP bigB, int block_size, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, int seed, int n_threads);
+static SEXP _fastBayesReg_big_normal_multi_lm_try(SEXP bigYSEXP, SEXP XSEXP, SEXP bigBSEXP, SEXP block_sizeSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP seedSEXP, SEXP n_threadsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigY(bigYSEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigB(bigBSEXP);
+    Rcpp::traits::input_parameter< int >::type block_size(block_sizeSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_normal_logit(y, X, mcmc_sample, burnin, thinning, A_tau));
+    Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(big_normal_multi_lm(bigY, X, bigB, block_size, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, seed, n_threads));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_normal_logit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+RcppExport SEXP _fastBayesReg_big_normal_multi_lm(SEXP bigYSEXP, SEXP XSEXP, SEXP bigBSEXP, SEXP block_sizeSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP seedSEXP, SEXP n_threadsSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_normal_multi_lm_try(bigYSEXP, XSEXP, bigBSEXP, block_sizeSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, seedSEXP, n_threadsSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -479,9 +568,9 @@ RcppExport SEXP _fastBayesReg_fast_normal_logit(SEXP ySEXP, SEXP XSEXP, SEXP mcm
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_normal_logit_single_gibbs
-Rcpp::List fast_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_fast_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// fast_normal_logit
+Rcpp::List fast_normal_logit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, bool asis);
+static SEXP _fastBayesReg_fast_normal_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP asisSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
@@ -490,16 +579,16 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, verbose));
+    Rcpp::traits::input_parameter< bool >::type asis(asisSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_logit(y, X, mcmc_sample, burnin, thinning, A_tau, asis));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_logit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP asisSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, asisSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -519,28 +608,28 @@ RcppExport SEXP _fastBayesReg_fast_normal_logit_single_gibbs(SEXP ySEXP, SEXP XS
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// scalable_normal_logit_single_gibbs
-Rcpp::List scalable_normal_logit_single_gibbs(arma::vec& y, SEXP bigX, arma::uvec& rowidx, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_scalable_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP rowidxSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// fast_normal_logit_single_gibbs
+Rcpp::List fast_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose, std::string init);
+static SEXP _fastBayesReg_fast_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP initSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
-    Rcpp::traits::input_parameter< arma::uvec& >::type rowidx(rowidxSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
     Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(scalable_normal_logit_single_gibbs(y, bigX, rowidx, mcmc_sample, burnin, thinning, A_tau, verbose));
+    Rcpp::traits::input_parameter< std::string >::type init(initSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, verbose, init));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_scalable_normal_logit_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP rowidxSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP initSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_scalable_normal_logit_single_gibbs_try(ySEXP, bigXSEXP, rowidxSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP, initSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -560,27 +649,29 @@ RcppExport SEXP _fastBayesReg_scalable_normal_logit_single_gibbs(SEXP ySEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// big_normal_logit_single_gibbs
-Rcpp::List big_normal_logit_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_big_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// fast_normal_logit_block_gibbs
+Rcpp::List fast_normal_logit_block_gibbs(arma::vec& y, arma::mat& X, int block_size, int mcmc_sample, int burnin, int thinning, double A_tau, bool mcmc_output, int window);
+static SEXP _fastBayesReg_fast_normal_logit_block_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP block_sizeSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP mcmc_outputSEXP, SEXP windowSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type block_size(block_sizeSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(big_normal_logit_single_gibbs(y, bigX, mcmc_sample, burnin, thinning, A_tau, verbose));
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    Rcpp::traits::input_parameter< int >::type window(windowSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_logit_block_gibbs(y, X, block_size, mcmc_sample, burnin, thinning, A_tau, mcmc_output, window));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_big_normal_logit_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_logit_block_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP block_sizeSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP mcmc_outputSEXP, SEXP windowSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_big_normal_logit_single_gibbs_try(ySEXP, bigXSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_block_gibbs_try(ySEXP, XSEXP, block_sizeSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, mcmc_outputSEXP, windowSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -600,27 +691,29 @@ RcppExport SEXP _fastBayesReg_big_normal_logit_single_gibbs(SEXP ySEXP, SEXP big
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// sparse_normal_logit_single_gibbs
-Rcpp::List sparse_normal_logit_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_sparse_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// multilabel_normal_logit_single_gibbs
+Rcpp::List multilabel_normal_logit_single_gibbs(arma::mat& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, bool mcmc_output, int n_threads, bool numa_interleave);
+static SEXP _fastBayesReg_multilabel_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP mcmc_outputSEXP, SEXP n_threadsSEXP, SEXP numa_interleaveSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(sparse_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, verbose));
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    Rcpp::traits::input_parameter< bool >::type numa_interleave(numa_interleaveSEXP);
+    rcpp_result_gen = Rcpp::wrap(multilabel_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, mcmc_output, n_threads, numa_interleave));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_sparse_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_multilabel_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP mcmc_outputSEXP, SEXP n_threadsSEXP, SEXP numa_interleaveSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_multilabel_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, mcmc_outputSEXP, n_threadsSEXP, numa_interleaveSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -640,27 +733,29 @@ RcppExport SEXP _fastBayesReg_sparse_normal_logit_single_gibbs(SEXP ySEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_normal_multiclass
-Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau);
-static SEXP _fastBayesReg_fast_normal_multiclass_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+// fast_normal_logit_sel_single_gibbs
+Rcpp::List fast_normal_logit_sel_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, double a_pi, double b_pi, bool mcmc_output);
+static SEXP _fastBayesReg_fast_normal_logit_sel_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP a_piSEXP, SEXP b_piSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_normal_multiclass(y, X, num_class, mcmc_sample, burnin, thinning, A_tau));
+    Rcpp::traits::input_parameter< double >::type a_pi(a_piSEXP);
+    Rcpp::traits::input_parameter< double >::type b_pi(b_piSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_logit_sel_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, a_pi, b_pi, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_normal_multiclass(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_logit_sel_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP a_piSEXP, SEXP b_piSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_multiclass_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_logit_sel_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, a_piSEXP, b_piSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -680,28 +775,28 @@ RcppExport SEXP _fastBayesReg_fast_normal_multiclass(SEXP ySEXP, SEXP XSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_normal_multiclass_single_gibbs
-Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_fast_normal_multiclass_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// scalable_normal_logit_single_gibbs
+Rcpp::List scalable_normal_logit_single_gibbs(arma::vec& y, SEXP bigX, arma::uvec& rowidx, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
+static SEXP _fastBayesReg_scalable_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP rowidxSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< arma::uvec& >::type rowidx(rowidxSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
     Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_normal_multiclass_single_gibbs(y, X, num_class, mcmc_sample, burnin, thinning, A_tau, verbose));
+    rcpp_result_gen = Rcpp::wrap(scalable_normal_logit_single_gibbs(y, bigX, rowidx, mcmc_sample, burnin, thinning, A_tau, verbose));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_normal_multiclass_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_scalable_normal_logit_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP rowidxSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_multiclass_single_gibbs_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_scalable_normal_logit_single_gibbs_try(ySEXP, bigXSEXP, rowidxSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -721,28 +816,27 @@ RcppExport SEXP _fastBayesReg_fast_normal_multiclass_single_gibbs(SEXP ySEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// scalable_normal_multiclass_single_gibbs
-Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
-static SEXP _fastBayesReg_scalable_normal_multiclass_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+// big_normal_logit_single_gibbs
+Rcpp::List big_normal_logit_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
+static SEXP _fastBayesReg_big_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
     Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
-    rcpp_result_gen = Rcpp::wrap(scalable_normal_multiclass_single_gibbs(y, X, num_class, mcmc_sample, burnin, thinning, A_tau, verbose));
+    rcpp_result_gen = Rcpp::wrap(big_normal_logit_single_gibbs(y, bigX, mcmc_sample, burnin, thinning, A_tau, verbose));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_scalable_normal_multiclass_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+RcppExport SEXP _fastBayesReg_big_normal_logit_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_scalable_normal_multiclass_single_gibbs_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_normal_logit_single_gibbs_try(ySEXP, bigXSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -762,28 +856,27 @@ RcppExport SEXP _fastBayesReg_scalable_normal_multiclass_single_gibbs(SEXP ySEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_mfvb_normal_logit
-Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X, int max_iter, double tol, double A, double in_E_inv_tau_sq, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta);
-static SEXP _fastBayesReg_fast_mfvb_normal_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+// sparse_normal_logit_single_gibbs
+Rcpp::List sparse_normal_logit_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
+static SEXP _fastBayesReg_sparse_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
-    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
-    Rcpp::traits::input_parameter< double >::type A(ASEXP);
-    Rcpp::traits::input_parameter< double >::type in_E_inv_tau_sq(in_E_inv_tau_sqSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_omega(in_E_omegaSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_beta(in_E_betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_logit(y, X, max_iter, tol, A, in_E_inv_tau_sq, in_E_omega, in_E_beta));
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
+    rcpp_result_gen = Rcpp::wrap(sparse_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, verbose));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+RcppExport SEXP _fastBayesReg_sparse_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_logit_try(ySEXP, XSEXP, max_iterSEXP, tolSEXP, ASEXP, in_E_inv_tau_sqSEXP, in_E_omegaSEXP, in_E_betaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -803,28 +896,28 @@ RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit(SEXP ySEXP, SEXP XSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_mfvb_normal_logit_single
-Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X, int max_iter, double tol, double A, double in_E_inv_tau_sq, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta);
-static SEXP _fastBayesReg_fast_mfvb_normal_logit_single_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+// interaction_normal_logit_single_gibbs
+Rcpp::List interaction_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose, bool mcmc_output);
+static SEXP _fastBayesReg_interaction_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
-    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
-    Rcpp::traits::input_parameter< double >::type A(ASEXP);
-    Rcpp::traits::input_parameter< double >::type in_E_inv_tau_sq(in_E_inv_tau_sqSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_omega(in_E_omegaSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_beta(in_E_betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_logit_single(y, X, max_iter, tol, A, in_E_inv_tau_sq, in_E_omega, in_E_beta));
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(interaction_normal_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, verbose, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit_single(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+RcppExport SEXP _fastBayesReg_interaction_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_logit_single_try(ySEXP, XSEXP, max_iterSEXP, tolSEXP, ASEXP, in_E_inv_tau_sqSEXP, in_E_omegaSEXP, in_E_betaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_interaction_normal_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -844,27 +937,29 @@ RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit_single(SEXP ySEXP, SEXP XSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_mfvb_multiclass
-Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau);
-static SEXP _fastBayesReg_fast_mfvb_multiclass_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+// basis_normal_logit_single_gibbs
+Rcpp::List basis_normal_logit_single_gibbs(arma::vec& y, arma::mat& X, arma::sp_mat& Phi, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose, bool mcmc_output);
+static SEXP _fastBayesReg_basis_normal_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP PhiSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type Phi(PhiSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_mfvb_multiclass(y, X, num_class, mcmc_sample, burnin, thinning, A_tau));
+    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(basis_normal_logit_single_gibbs(y, X, Phi, mcmc_sample, burnin, thinning, A_tau, verbose, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_mfvb_multiclass(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+RcppExport SEXP _fastBayesReg_basis_normal_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP PhiSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_multiclass_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_basis_normal_logit_single_gibbs_try(ySEXP, XSEXP, PhiSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -884,27 +979,30 @@ RcppExport SEXP _fastBayesReg_fast_mfvb_multiclass(SEXP ySEXP, SEXP XSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_horseshoe_logit
-Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda);
-static SEXP _fastBayesReg_fast_horseshoe_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+// fast_binomial_single_gibbs
+Rcpp::List fast_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::mat& X, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_fast_binomial_single_gibbs_try(SEXP ySEXP, SEXP trialsSEXP, SEXP XSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type trials(trialsSEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
     Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_logit(y, X, mcmc_sample, burnin, thinning, A_tau, A_lambda));
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_binomial_single_gibbs(y, trials, X, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_horseshoe_logit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+RcppExport SEXP _fastBayesReg_fast_binomial_single_gibbs(SEXP ySEXP, SEXP trialsSEXP, SEXP XSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_logit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_binomial_single_gibbs_try(ySEXP, trialsSEXP, XSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -924,23 +1022,30 @@ RcppExport SEXP _fastBayesReg_fast_horseshoe_logit(SEXP ySEXP, SEXP XSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// rand_left_trucnorm0
-arma::vec rand_left_trucnorm0(int n, double lower, double ratio);
-static SEXP _fastBayesReg_rand_left_trucnorm0_try(SEXP nSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+// sparse_binomial_single_gibbs
+Rcpp::List sparse_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::sp_mat& X, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_sparse_binomial_single_gibbs_try(SEXP ySEXP, SEXP trialsSEXP, SEXP XSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< int >::type n(nSEXP);
-    Rcpp::traits::input_parameter< double >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
-    rcpp_result_gen = Rcpp::wrap(rand_left_trucnorm0(n, lower, ratio));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type trials(trialsSEXP);
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(sparse_binomial_single_gibbs(y, trials, X, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_rand_left_trucnorm0(SEXP nSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+RcppExport SEXP _fastBayesReg_sparse_binomial_single_gibbs(SEXP ySEXP, SEXP trialsSEXP, SEXP XSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_rand_left_trucnorm0_try(nSEXP, lowerSEXP, ratioSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_binomial_single_gibbs_try(ySEXP, trialsSEXP, XSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -960,25 +1065,30 @@ RcppExport SEXP _fastBayesReg_rand_left_trucnorm0(SEXP nSEXP, SEXP lowerSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// rand_left_trucnorm
-arma::vec rand_left_trucnorm(int n, double mu, double sigma, double lower, double ratio);
-static SEXP _fastBayesReg_rand_left_trucnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+// big_binomial_single_gibbs
+Rcpp::List big_binomial_single_gibbs(arma::vec& y, arma::vec& trials, SEXP bigX, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_big_binomial_single_gibbs_try(SEXP ySEXP, SEXP trialsSEXP, SEXP bigXSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< int >::type n(nSEXP);
-    Rcpp::traits::input_parameter< double >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
-    rcpp_result_gen = Rcpp::wrap(rand_left_trucnorm(n, mu, sigma, lower, ratio));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type trials(trialsSEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(big_binomial_single_gibbs(y, trials, bigX, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_rand_left_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+RcppExport SEXP _fastBayesReg_big_binomial_single_gibbs(SEXP ySEXP, SEXP trialsSEXP, SEXP bigXSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_rand_left_trucnorm_try(nSEXP, muSEXP, sigmaSEXP, lowerSEXP, ratioSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_binomial_single_gibbs_try(ySEXP, trialsSEXP, bigXSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -998,25 +1108,30 @@ RcppExport SEXP _fastBayesReg_rand_left_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP s
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// rand_right_trucnorm
-arma::vec rand_right_trucnorm(int n, double mu, double sigma, double upper, double ratio);
-static SEXP _fastBayesReg_rand_right_trucnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP upperSEXP, SEXP ratioSEXP) {
+// fast_negbin_single_gibbs
+Rcpp::List fast_negbin_single_gibbs(arma::vec& y, arma::mat& X, double r, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_fast_negbin_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< int >::type n(nSEXP);
-    Rcpp::traits::input_parameter< double >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type upper(upperSEXP);
-    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
-    rcpp_result_gen = Rcpp::wrap(rand_right_trucnorm(n, mu, sigma, upper, ratio));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< double >::type r(rSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_negbin_single_gibbs(y, X, r, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_rand_right_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP upperSEXP, SEXP ratioSEXP) {
+RcppExport SEXP _fastBayesReg_fast_negbin_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_rand_right_trucnorm_try(nSEXP, muSEXP, sigmaSEXP, upperSEXP, ratioSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_negbin_single_gibbs_try(ySEXP, XSEXP, rSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1036,29 +1151,1339 @@ RcppExport SEXP _fastBayesReg_rand_right_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_horseshoe_lm
-Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda);
-static SEXP _fastBayesReg_fast_horseshoe_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+// sparse_negbin_single_gibbs
+Rcpp::List sparse_negbin_single_gibbs(arma::vec& y, arma::sp_mat& X, double r, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_sparse_negbin_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< double >::type r(rSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
-    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
     Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda));
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(sparse_negbin_single_gibbs(y, X, r, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_sparse_negbin_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_negbin_single_gibbs_try(ySEXP, XSEXP, rSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// big_negbin_single_gibbs
+Rcpp::List big_negbin_single_gibbs(arma::vec& y, SEXP bigX, double r, std::string prior, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_big_negbin_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< double >::type r(rSEXP);
+    Rcpp::traits::input_parameter< std::string >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(big_negbin_single_gibbs(y, bigX, r, prior, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_big_negbin_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP rSEXP, SEXP priorSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_negbin_single_gibbs_try(ySEXP, bigXSEXP, rSEXP, priorSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// sparse_horseshoe_lm_single_gibbs
+Rcpp::List sparse_horseshoe_lm_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_sparse_horseshoe_lm_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(sparse_horseshoe_lm_single_gibbs(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_sparse_horseshoe_lm_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_horseshoe_lm_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// big_horseshoe_lm_single_gibbs
+Rcpp::List big_horseshoe_lm_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_big_horseshoe_lm_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(big_horseshoe_lm_single_gibbs(y, bigX, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_big_horseshoe_lm_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_horseshoe_lm_single_gibbs_try(ySEXP, bigXSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// sparse_horseshoe_logit_single_gibbs
+Rcpp::List sparse_horseshoe_logit_single_gibbs(arma::vec& y, arma::sp_mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_sparse_horseshoe_logit_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(sparse_horseshoe_logit_single_gibbs(y, X, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_sparse_horseshoe_logit_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_sparse_horseshoe_logit_single_gibbs_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// big_horseshoe_logit_single_gibbs
+Rcpp::List big_horseshoe_logit_single_gibbs(arma::vec& y, SEXP bigX, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool mcmc_output);
+static SEXP _fastBayesReg_big_horseshoe_logit_single_gibbs_try(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< SEXP >::type bigX(bigXSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    rcpp_result_gen = Rcpp::wrap(big_horseshoe_logit_single_gibbs(y, bigX, mcmc_sample, burnin, thinning, A_tau, A_lambda, mcmc_output));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_big_horseshoe_logit_single_gibbs(SEXP ySEXP, SEXP bigXSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_big_horseshoe_logit_single_gibbs_try(ySEXP, bigXSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_normal_multiclass
+Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau);
+static SEXP _fastBayesReg_fast_normal_multiclass_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_multiclass(y, X, num_class, mcmc_sample, burnin, thinning, A_tau));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_normal_multiclass(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_multiclass_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_normal_multiclass_single_gibbs
+Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
+static SEXP _fastBayesReg_fast_normal_multiclass_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_multiclass_single_gibbs(y, X, num_class, mcmc_sample, burnin, thinning, A_tau, verbose));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_normal_multiclass_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_multiclass_single_gibbs_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// scalable_normal_multiclass_single_gibbs
+Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau, int verbose);
+static SEXP _fastBayesReg_scalable_normal_multiclass_single_gibbs_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< int >::type verbose(verboseSEXP);
+    rcpp_result_gen = Rcpp::wrap(scalable_normal_multiclass_single_gibbs(y, X, num_class, mcmc_sample, burnin, thinning, A_tau, verbose));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_scalable_normal_multiclass_single_gibbs(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP verboseSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_scalable_normal_multiclass_single_gibbs_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, verboseSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_mfvb_normal_logit
+Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X, int max_iter, double tol, double A, double in_E_inv_tau_sq, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta);
+static SEXP _fastBayesReg_fast_mfvb_normal_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
+    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
+    Rcpp::traits::input_parameter< double >::type A(ASEXP);
+    Rcpp::traits::input_parameter< double >::type in_E_inv_tau_sq(in_E_inv_tau_sqSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_omega(in_E_omegaSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_beta(in_E_betaSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_logit(y, X, max_iter, tol, A, in_E_inv_tau_sq, in_E_omega, in_E_beta));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_logit_try(ySEXP, XSEXP, max_iterSEXP, tolSEXP, ASEXP, in_E_inv_tau_sqSEXP, in_E_omegaSEXP, in_E_betaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_mfvb_normal_logit_single
+Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X, int max_iter, double tol, double A, double in_E_inv_tau_sq, Rcpp::Nullable<Rcpp::NumericVector> in_E_omega, Rcpp::Nullable<Rcpp::NumericVector> in_E_beta);
+static SEXP _fastBayesReg_fast_mfvb_normal_logit_single_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
+    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
+    Rcpp::traits::input_parameter< double >::type A(ASEXP);
+    Rcpp::traits::input_parameter< double >::type in_E_inv_tau_sq(in_E_inv_tau_sqSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_omega(in_E_omegaSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type in_E_beta(in_E_betaSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_logit_single(y, X, max_iter, tol, A, in_E_inv_tau_sq, in_E_omega, in_E_beta));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit_single(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP tolSEXP, SEXP ASEXP, SEXP in_E_inv_tau_sqSEXP, SEXP in_E_omegaSEXP, SEXP in_E_betaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_logit_single_try(ySEXP, XSEXP, max_iterSEXP, tolSEXP, ASEXP, in_E_inv_tau_sqSEXP, in_E_omegaSEXP, in_E_betaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_mfvb_multiclass
+Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class, int mcmc_sample, int burnin, int thinning, double A_tau);
+static SEXP _fastBayesReg_fast_mfvb_multiclass_try(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type num_class(num_classSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_multiclass(y, X, num_class, mcmc_sample, burnin, thinning, A_tau));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_mfvb_multiclass(SEXP ySEXP, SEXP XSEXP, SEXP num_classSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_multiclass_try(ySEXP, XSEXP, num_classSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_logit
+Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda, bool asis);
+static SEXP _fastBayesReg_fast_horseshoe_logit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP asisSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type asis(asisSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_logit(y, X, mcmc_sample, burnin, thinning, A_tau, A_lambda, asis));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_logit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP asisSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_logit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP, asisSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// rand_left_trucnorm0
+arma::vec rand_left_trucnorm0(int n, double lower, double ratio);
+static SEXP _fastBayesReg_rand_left_trucnorm0_try(SEXP nSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
+    rcpp_result_gen = Rcpp::wrap(rand_left_trucnorm0(n, lower, ratio));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_rand_left_trucnorm0(SEXP nSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_rand_left_trucnorm0_try(nSEXP, lowerSEXP, ratioSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// rand_left_trucnorm
+arma::vec rand_left_trucnorm(int n, double mu, double sigma, double lower, double ratio);
+static SEXP _fastBayesReg_rand_left_trucnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
+    rcpp_result_gen = Rcpp::wrap(rand_left_trucnorm(n, mu, sigma, lower, ratio));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_rand_left_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP ratioSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_rand_left_trucnorm_try(nSEXP, muSEXP, sigmaSEXP, lowerSEXP, ratioSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// rand_right_trucnorm
+arma::vec rand_right_trucnorm(int n, double mu, double sigma, double upper, double ratio);
+static SEXP _fastBayesReg_rand_right_trucnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP upperSEXP, SEXP ratioSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< double >::type ratio(ratioSEXP);
+    rcpp_result_gen = Rcpp::wrap(rand_right_trucnorm(n, mu, sigma, upper, ratio));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_rand_right_trucnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP upperSEXP, SEXP ratioSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_rand_right_trucnorm_try(nSEXP, muSEXP, sigmaSEXP, upperSEXP, ratioSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// rand_trucnorm
+arma::vec rand_trucnorm(arma::vec& mu, arma::vec& sigma, arma::vec& lower, arma::vec& upper, int seed, int n_threads);
+static SEXP _fastBayesReg_rand_trucnorm_try(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP seedSEXP, SEXP n_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< int >::type seed(seedSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(rand_trucnorm(mu, sigma, lower, upper, seed, n_threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_rand_trucnorm(SEXP muSEXP, SEXP sigmaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP seedSEXP, SEXP n_threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_rand_trucnorm_try(muSEXP, sigmaSEXP, lowerSEXP, upperSEXP, seedSEXP, n_threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_normal_probit
+Rcpp::List fast_normal_probit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau);
+static SEXP _fastBayesReg_fast_normal_probit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_probit(y, X, mcmc_sample, burnin, thinning, A_tau));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_normal_probit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_probit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_probit
+Rcpp::List fast_horseshoe_probit(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double A_tau, double A_lambda);
+static SEXP _fastBayesReg_fast_horseshoe_probit_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_probit(y, X, mcmc_sample, burnin, thinning, A_tau, A_lambda));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_probit(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_probit_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, A_tauSEXP, A_lambdaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_normal_tobit
+Rcpp::List fast_normal_tobit(arma::vec& y, arma::mat& X, arma::vec& lower, arma::vec& upper, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau);
+static SEXP _fastBayesReg_fast_normal_tobit_try(SEXP ySEXP, SEXP XSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_tobit(y, X, lower, upper, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_normal_tobit(SEXP ySEXP, SEXP XSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_tobit_try(ySEXP, XSEXP, lowerSEXP, upperSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_lm
+Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda, bool asis);
+static SEXP _fastBayesReg_fast_horseshoe_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP asisSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type asis(asisSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda, asis));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP asisSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP, asisSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_ss_lm
+Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda);
+static SEXP _fastBayesReg_fast_horseshoe_ss_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_ss_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_ss_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_ss_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_hd_lm
+Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda, int screen_size, int screen_every, std::string init);
+static SEXP _fastBayesReg_fast_horseshoe_hd_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP screen_sizeSEXP, SEXP screen_everySEXP, SEXP initSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< int >::type screen_size(screen_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type screen_every(screen_everySEXP);
+    Rcpp::traits::input_parameter< std::string >::type init(initSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_hd_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda, screen_size, screen_every, init));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_hd_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP screen_sizeSEXP, SEXP screen_everySEXP, SEXP initSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_hd_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP, screen_sizeSEXP, screen_everySEXP, initSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_horseshoe_multi_lm
+Rcpp::List fast_horseshoe_multi_lm(arma::mat& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda, bool mcmc_output, int n_threads, bool display_progress);
+static SEXP _fastBayesReg_fast_horseshoe_multi_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP, SEXP n_threadsSEXP, SEXP display_progressSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::mat& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< bool >::type mcmc_output(mcmc_outputSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    Rcpp::traits::input_parameter< bool >::type display_progress(display_progressSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_multi_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda, mcmc_output, n_threads, display_progress));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_horseshoe_multi_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP mcmc_outputSEXP, SEXP n_threadsSEXP, SEXP display_progressSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_multi_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP, mcmc_outputSEXP, n_threadsSEXP, display_progressSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_lm
+Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha);
+static SEXP _fastBayesReg_predict_fast_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_lm(model_fit, X_test, alpha));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_lm(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_lm_try(model_fitSEXP, X_testSEXP, alphaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_multi_lm
+Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test);
+static SEXP _fastBayesReg_predict_fast_multi_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_multi_lm(model_fit, X_test));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_multi_lm(SEXP model_fitSEXP, SEXP X_testSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_multi_lm_try(model_fitSEXP, X_testSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_mfvb_lm
+Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test);
+static SEXP _fastBayesReg_predict_fast_mfvb_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_mfvb_lm(model_fit, X_test));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_mfvb_lm(SEXP model_fitSEXP, SEXP X_testSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_mfvb_lm_try(model_fitSEXP, X_testSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_logit
+Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha, double cutoff);
+static SEXP _fastBayesReg_predict_fast_logit_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< double >::type cutoff(cutoffSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_logit(model_fit, X_test, alpha, cutoff));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_logit(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_logit_try(model_fitSEXP, X_testSEXP, alphaSEXP, cutoffSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_multiclass
+Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit, arma::mat& X_test);
+static SEXP _fastBayesReg_predict_fast_multiclass_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_multiclass(model_fit, X_test));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_multiclass(SEXP model_fitSEXP, SEXP X_testSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_multiclass_try(model_fitSEXP, X_testSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// predict_fast_mfvb_logit
+Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha, double cutoff);
+static SEXP _fastBayesReg_predict_fast_mfvb_logit_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
+    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< double >::type cutoff(cutoffSEXP);
+    rcpp_result_gen = Rcpp::wrap(predict_fast_mfvb_logit(model_fit, X_test, alpha, cutoff));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_predict_fast_mfvb_logit(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_mfvb_logit_try(model_fitSEXP, X_testSEXP, alphaSEXP, cutoffSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_mfvb_normal_lm
+Rcpp::List fast_mfvb_normal_lm(arma::vec& y, arma::mat& X, int max_iter, double a_sigma, double b_sigma, double A_tau, double tol, double t_sigma2_eps_0, double t_tau2_0);
+static SEXP _fastBayesReg_fast_mfvb_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP tolSEXP, SEXP t_sigma2_eps_0SEXP, SEXP t_tau2_0SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
+    Rcpp::traits::input_parameter< double >::type t_sigma2_eps_0(t_sigma2_eps_0SEXP);
+    Rcpp::traits::input_parameter< double >::type t_tau2_0(t_tau2_0SEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_lm(y, X, max_iter, a_sigma, b_sigma, A_tau, tol, t_sigma2_eps_0, t_tau2_0));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_fast_mfvb_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP tolSEXP, SEXP t_sigma2_eps_0SEXP, SEXP t_tau2_0SEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_lm_try(ySEXP, XSEXP, max_iterSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, tolSEXP, t_sigma2_eps_0SEXP, t_tau2_0SEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// Rcpp_optimize_H
+double Rcpp_optimize_H(arma::mat& d_sq, arma::mat& z_sq);
+static SEXP _fastBayesReg_Rcpp_optimize_H_try(SEXP d_sqSEXP, SEXP z_sqSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::mat& >::type d_sq(d_sqSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type z_sq(z_sqSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_optimize_H(d_sq, z_sq));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_Rcpp_optimize_H(SEXP d_sqSEXP, SEXP z_sqSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_Rcpp_optimize_H_try(d_sqSEXP, z_sqSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// Rcpp_optimize_L
+double Rcpp_optimize_L(arma::mat& d_sq, arma::mat& z_sq, double& sum_y_sq, int& n);
+static SEXP _fastBayesReg_Rcpp_optimize_L_try(SEXP d_sqSEXP, SEXP z_sqSEXP, SEXP sum_y_sqSEXP, SEXP nSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::mat& >::type d_sq(d_sqSEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type z_sq(z_sqSEXP);
+    Rcpp::traits::input_parameter< double& >::type sum_y_sq(sum_y_sqSEXP);
+    Rcpp::traits::input_parameter< int& >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_optimize_L(d_sq, z_sq, sum_y_sq, n));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_Rcpp_optimize_L(SEXP d_sqSEXP, SEXP z_sqSEXP, SEXP sum_y_sqSEXP, SEXP nSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_Rcpp_optimize_L_try(d_sqSEXP, z_sqSEXP, sum_y_sqSEXP, nSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// super_fast_normal_lm
+Rcpp::List super_fast_normal_lm(arma::vec& y, arma::mat& X, double theta);
+static SEXP _fastBayesReg_super_fast_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< double >::type theta(thetaSEXP);
+    rcpp_result_gen = Rcpp::wrap(super_fast_normal_lm(y, X, theta));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_horseshoe_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+RcppExport SEXP _fastBayesReg_super_fast_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_super_fast_normal_lm_try(ySEXP, XSEXP, thetaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1078,29 +2503,26 @@ RcppExport SEXP _fastBayesReg_fast_horseshoe_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcm
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_horseshoe_ss_lm
-Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda);
-static SEXP _fastBayesReg_fast_horseshoe_ss_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+// super_fast_normal_lm_batch
+Rcpp::List super_fast_normal_lm_batch(arma::vec& y, arma::mat& X, arma::ivec& group, double theta, int n_threads, bool numa_interleave);
+static SEXP _fastBayesReg_super_fast_normal_lm_batch_try(SEXP ySEXP, SEXP XSEXP, SEXP groupSEXP, SEXP thetaSEXP, SEXP n_threadsSEXP, SEXP numa_interleaveSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
-    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
-    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
-    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_ss_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda));
+    Rcpp::traits::input_parameter< arma::ivec& >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< double >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    Rcpp::traits::input_parameter< bool >::type numa_interleave(numa_interleaveSEXP);
+    rcpp_result_gen = Rcpp::wrap(super_fast_normal_lm_batch(y, X, group, theta, n_threads, numa_interleave));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_horseshoe_ss_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+RcppExport SEXP _fastBayesReg_super_fast_normal_lm_batch(SEXP ySEXP, SEXP XSEXP, SEXP groupSEXP, SEXP thetaSEXP, SEXP n_threadsSEXP, SEXP numa_interleaveSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_ss_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_super_fast_normal_lm_batch_try(ySEXP, XSEXP, groupSEXP, thetaSEXP, n_threadsSEXP, numa_interleaveSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1120,29 +2542,30 @@ RcppExport SEXP _fastBayesReg_fast_horseshoe_ss_lm(SEXP ySEXP, SEXP XSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_horseshoe_hd_lm
-Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda);
-static SEXP _fastBayesReg_fast_horseshoe_hd_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+// fast_normal_lm_batch
+Rcpp::List fast_normal_lm_batch(arma::vec& y, arma::mat& X, arma::ivec& group, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, bool display_progress);
+static SEXP _fastBayesReg_fast_normal_lm_batch_try(SEXP ySEXP, SEXP XSEXP, SEXP groupSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP display_progressSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::ivec& >::type group(groupSEXP);
     Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
     Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
     Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
     Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
     Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_hd_lm(y, X, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda));
+    Rcpp::traits::input_parameter< bool >::type display_progress(display_progressSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_lm_batch(y, X, group, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, display_progress));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_horseshoe_hd_lm(SEXP ySEXP, SEXP XSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_lm_batch(SEXP ySEXP, SEXP XSEXP, SEXP groupSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP display_progressSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_hd_lm_try(ySEXP, XSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_lm_batch_try(ySEXP, XSEXP, groupSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, display_progressSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1162,23 +2585,23 @@ RcppExport SEXP _fastBayesReg_fast_horseshoe_hd_lm(SEXP ySEXP, SEXP XSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_lm
-Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha);
-static SEXP _fastBayesReg_predict_fast_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP) {
+// super_fast_normal_lm_path
+Rcpp::List super_fast_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& theta);
+static SEXP _fastBayesReg_super_fast_normal_lm_path_try(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_lm(model_fit, X_test, alpha));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type theta(thetaSEXP);
+    rcpp_result_gen = Rcpp::wrap(super_fast_normal_lm_path(y, X, theta));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_lm(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP) {
+RcppExport SEXP _fastBayesReg_super_fast_normal_lm_path(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_lm_try(model_fitSEXP, X_testSEXP, alphaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_super_fast_normal_lm_path_try(ySEXP, XSEXP, thetaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1198,22 +2621,27 @@ RcppExport SEXP _fastBayesReg_predict_fast_lm(SEXP model_fitSEXP, SEXP X_testSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_multi_lm
-Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test);
-static SEXP _fastBayesReg_predict_fast_multi_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+// fast_mfvb_normal_lm_path
+Rcpp::List fast_mfvb_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector a_sigma, Rcpp::NumericVector b_sigma, int max_iter, double tol);
+static SEXP _fastBayesReg_fast_mfvb_normal_lm_path_try(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP max_iterSEXP, SEXP tolSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_multi_lm(model_fit, X_test));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
+    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_lm_path(y, X, A_tau, a_sigma, b_sigma, max_iter, tol));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_multi_lm(SEXP model_fitSEXP, SEXP X_testSEXP) {
+RcppExport SEXP _fastBayesReg_fast_mfvb_normal_lm_path(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP max_iterSEXP, SEXP tolSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_multi_lm_try(model_fitSEXP, X_testSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_lm_path_try(ySEXP, XSEXP, A_tauSEXP, a_sigmaSEXP, b_sigmaSEXP, max_iterSEXP, tolSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1233,22 +2661,25 @@ RcppExport SEXP _fastBayesReg_predict_fast_multi_lm(SEXP model_fitSEXP, SEXP X_t
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_mfvb_lm
-Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test);
-static SEXP _fastBayesReg_predict_fast_mfvb_lm_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+// fast_mfvb_normal_logit_path
+Rcpp::List fast_mfvb_normal_logit_path(arma::vec& y, arma::mat& X, arma::vec& A, int max_iter, double tol);
+static SEXP _fastBayesReg_fast_mfvb_normal_logit_path_try(SEXP ySEXP, SEXP XSEXP, SEXP ASEXP, SEXP max_iterSEXP, SEXP tolSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_mfvb_lm(model_fit, X_test));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type A(ASEXP);
+    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
+    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_logit_path(y, X, A, max_iter, tol));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_mfvb_lm(SEXP model_fitSEXP, SEXP X_testSEXP) {
+RcppExport SEXP _fastBayesReg_fast_mfvb_normal_logit_path(SEXP ySEXP, SEXP XSEXP, SEXP ASEXP, SEXP max_iterSEXP, SEXP tolSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_mfvb_lm_try(model_fitSEXP, X_testSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_logit_path_try(ySEXP, XSEXP, ASEXP, max_iterSEXP, tolSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1268,24 +2699,29 @@ RcppExport SEXP _fastBayesReg_predict_fast_mfvb_lm(SEXP model_fitSEXP, SEXP X_te
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_logit
-Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha, double cutoff);
-static SEXP _fastBayesReg_predict_fast_logit_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+// fast_normal_lm_path
+Rcpp::List fast_normal_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector a_sigma, Rcpp::NumericVector b_sigma, int mcmc_sample, int burnin, int burnin_warm, int thinning);
+static SEXP _fastBayesReg_fast_normal_lm_path_try(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP burnin_warmSEXP, SEXP thinningSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< double >::type cutoff(cutoffSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_logit(model_fit, X_test, alpha, cutoff));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin_warm(burnin_warmSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_normal_lm_path(y, X, A_tau, a_sigma, b_sigma, mcmc_sample, burnin, burnin_warm, thinning));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_logit(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+RcppExport SEXP _fastBayesReg_fast_normal_lm_path(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP burnin_warmSEXP, SEXP thinningSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_logit_try(model_fitSEXP, X_testSEXP, alphaSEXP, cutoffSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_normal_lm_path_try(ySEXP, XSEXP, A_tauSEXP, a_sigmaSEXP, b_sigmaSEXP, mcmc_sampleSEXP, burninSEXP, burnin_warmSEXP, thinningSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1305,22 +2741,30 @@ RcppExport SEXP _fastBayesReg_predict_fast_logit(SEXP model_fitSEXP, SEXP X_test
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_multiclass
-Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit, arma::mat& X_test);
-static SEXP _fastBayesReg_predict_fast_multiclass_try(SEXP model_fitSEXP, SEXP X_testSEXP) {
+// fast_horseshoe_lm_path
+Rcpp::List fast_horseshoe_lm_path(arma::vec& y, arma::mat& X, arma::vec& A_tau, Rcpp::NumericVector A_lambda, double a_sigma, double b_sigma, int mcmc_sample, int burnin, int burnin_warm, int thinning);
+static SEXP _fastBayesReg_fast_horseshoe_lm_path_try(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP burnin_warmSEXP, SEXP thinningSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_multiclass(model_fit, X_test));
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type A_lambda(A_lambdaSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin_warm(burnin_warmSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_horseshoe_lm_path(y, X, A_tau, A_lambda, a_sigma, b_sigma, mcmc_sample, burnin, burnin_warm, thinning));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_multiclass(SEXP model_fitSEXP, SEXP X_testSEXP) {
+RcppExport SEXP _fastBayesReg_fast_horseshoe_lm_path(SEXP ySEXP, SEXP XSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP burnin_warmSEXP, SEXP thinningSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_multiclass_try(model_fitSEXP, X_testSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_horseshoe_lm_path_try(ySEXP, XSEXP, A_tauSEXP, A_lambdaSEXP, a_sigmaSEXP, b_sigmaSEXP, mcmc_sampleSEXP, burninSEXP, burnin_warmSEXP, thinningSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1340,24 +2784,22 @@ RcppExport SEXP _fastBayesReg_predict_fast_multiclass(SEXP model_fitSEXP, SEXP X
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// predict_fast_mfvb_logit
-Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test, double alpha, double cutoff);
-static SEXP _fastBayesReg_predict_fast_mfvb_logit_try(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+// register_design
+int register_design(arma::mat& X, bool numa_interleave);
+static SEXP _fastBayesReg_register_design_try(SEXP XSEXP, SEXP numa_interleaveSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< Rcpp::List& >::type model_fit(model_fitSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X_test(X_testSEXP);
-    Rcpp::traits::input_parameter< double >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< double >::type cutoff(cutoffSEXP);
-    rcpp_result_gen = Rcpp::wrap(predict_fast_mfvb_logit(model_fit, X_test, alpha, cutoff));
+    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< bool >::type numa_interleave(numa_interleaveSEXP);
+    rcpp_result_gen = Rcpp::wrap(register_design(X, numa_interleave));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_predict_fast_mfvb_logit(SEXP model_fitSEXP, SEXP X_testSEXP, SEXP alphaSEXP, SEXP cutoffSEXP) {
+RcppExport SEXP _fastBayesReg_register_design(SEXP XSEXP, SEXP numa_interleaveSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_predict_fast_mfvb_logit_try(model_fitSEXP, X_testSEXP, alphaSEXP, cutoffSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_register_design_try(XSEXP, numa_interleaveSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1377,29 +2819,58 @@ RcppExport SEXP _fastBayesReg_predict_fast_mfvb_logit(SEXP model_fitSEXP, SEXP X
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// fast_mfvb_normal_lm
-Rcpp::List fast_mfvb_normal_lm(arma::vec& y, arma::mat& X, int max_iter, double a_sigma, double b_sigma, double A_tau, double tol, double t_sigma2_eps_0, double t_tau2_0);
-static SEXP _fastBayesReg_fast_mfvb_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP tolSEXP, SEXP t_sigma2_eps_0SEXP, SEXP t_tau2_0SEXP) {
+// release_design
+bool release_design(int design);
+static SEXP _fastBayesReg_release_design_try(SEXP designSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type design(designSEXP);
+    rcpp_result_gen = Rcpp::wrap(release_design(design));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_release_design(SEXP designSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_release_design_try(designSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// submit_fit
+int submit_fit(std::string fun, arma::vec& y, int design, Rcpp::Nullable<Rcpp::List> args);
+static SEXP _fastBayesReg_submit_fit_try(SEXP funSEXP, SEXP ySEXP, SEXP designSEXP, SEXP argsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type fun(funSEXP);
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< int >::type max_iter(max_iterSEXP);
-    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
-    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
-    Rcpp::traits::input_parameter< double >::type tol(tolSEXP);
-    Rcpp::traits::input_parameter< double >::type t_sigma2_eps_0(t_sigma2_eps_0SEXP);
-    Rcpp::traits::input_parameter< double >::type t_tau2_0(t_tau2_0SEXP);
-    rcpp_result_gen = Rcpp::wrap(fast_mfvb_normal_lm(y, X, max_iter, a_sigma, b_sigma, A_tau, tol, t_sigma2_eps_0, t_tau2_0));
+    Rcpp::traits::input_parameter< int >::type design(designSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::List> >::type args(argsSEXP);
+    rcpp_result_gen = Rcpp::wrap(submit_fit(fun, y, design, args));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_fast_mfvb_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP max_iterSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP tolSEXP, SEXP t_sigma2_eps_0SEXP, SEXP t_tau2_0SEXP) {
+RcppExport SEXP _fastBayesReg_submit_fit(SEXP funSEXP, SEXP ySEXP, SEXP designSEXP, SEXP argsSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_fast_mfvb_normal_lm_try(ySEXP, XSEXP, max_iterSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, tolSEXP, t_sigma2_eps_0SEXP, t_tau2_0SEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_submit_fit_try(funSEXP, ySEXP, designSEXP, argsSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1419,22 +2890,21 @@ RcppExport SEXP _fastBayesReg_fast_mfvb_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP m
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// Rcpp_optimize_H
-double Rcpp_optimize_H(arma::mat& d_sq, arma::mat& z_sq);
-static SEXP _fastBayesReg_Rcpp_optimize_H_try(SEXP d_sqSEXP, SEXP z_sqSEXP) {
+// poll_fit
+std::string poll_fit(int job);
+static SEXP _fastBayesReg_poll_fit_try(SEXP jobSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< arma::mat& >::type d_sq(d_sqSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type z_sq(z_sqSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_optimize_H(d_sq, z_sq));
+    Rcpp::traits::input_parameter< int >::type job(jobSEXP);
+    rcpp_result_gen = Rcpp::wrap(poll_fit(job));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_Rcpp_optimize_H(SEXP d_sqSEXP, SEXP z_sqSEXP) {
+RcppExport SEXP _fastBayesReg_poll_fit(SEXP jobSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_Rcpp_optimize_H_try(d_sqSEXP, z_sqSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_poll_fit_try(jobSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1454,24 +2924,21 @@ RcppExport SEXP _fastBayesReg_Rcpp_optimize_H(SEXP d_sqSEXP, SEXP z_sqSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// Rcpp_optimize_L
-double Rcpp_optimize_L(arma::mat& d_sq, arma::mat& z_sq, double& sum_y_sq, int& n);
-static SEXP _fastBayesReg_Rcpp_optimize_L_try(SEXP d_sqSEXP, SEXP z_sqSEXP, SEXP sum_y_sqSEXP, SEXP nSEXP) {
+// wait_fit
+Rcpp::List wait_fit(int job);
+static SEXP _fastBayesReg_wait_fit_try(SEXP jobSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< arma::mat& >::type d_sq(d_sqSEXP);
-    Rcpp::traits::input_parameter< arma::mat& >::type z_sq(z_sqSEXP);
-    Rcpp::traits::input_parameter< double& >::type sum_y_sq(sum_y_sqSEXP);
-    Rcpp::traits::input_parameter< int& >::type n(nSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_optimize_L(d_sq, z_sq, sum_y_sq, n));
+    Rcpp::traits::input_parameter< int >::type job(jobSEXP);
+    rcpp_result_gen = Rcpp::wrap(wait_fit(job));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_Rcpp_optimize_L(SEXP d_sqSEXP, SEXP z_sqSEXP, SEXP sum_y_sqSEXP, SEXP nSEXP) {
+RcppExport SEXP _fastBayesReg_wait_fit(SEXP jobSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_Rcpp_optimize_L_try(d_sqSEXP, z_sqSEXP, sum_y_sqSEXP, nSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_wait_fit_try(jobSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1491,23 +2958,103 @@ RcppExport SEXP _fastBayesReg_Rcpp_optimize_L(SEXP d_sqSEXP, SEXP z_sqSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// super_fast_normal_lm
-Rcpp::List super_fast_normal_lm(arma::vec& y, arma::mat& X, double theta);
-static SEXP _fastBayesReg_super_fast_normal_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
+// cancel_fit
+bool cancel_fit(int job);
+static SEXP _fastBayesReg_cancel_fit_try(SEXP jobSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type job(jobSEXP);
+    rcpp_result_gen = Rcpp::wrap(cancel_fit(job));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_cancel_fit(SEXP jobSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_cancel_fit_try(jobSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cv_fit
+Rcpp::List cv_fit(std::string fun, arma::vec& y, int design, arma::ivec& fold, Rcpp::Nullable<Rcpp::List> args, int n_threads);
+static SEXP _fastBayesReg_cv_fit_try(SEXP funSEXP, SEXP ySEXP, SEXP designSEXP, SEXP foldSEXP, SEXP argsSEXP, SEXP n_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< std::string >::type fun(funSEXP);
+    Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< int >::type design(designSEXP);
+    Rcpp::traits::input_parameter< arma::ivec& >::type fold(foldSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::List> >::type args(argsSEXP);
+    Rcpp::traits::input_parameter< int >::type n_threads(n_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(cv_fit(fun, y, design, fold, args, n_threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _fastBayesReg_cv_fit(SEXP funSEXP, SEXP ySEXP, SEXP designSEXP, SEXP foldSEXP, SEXP argsSEXP, SEXP n_threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_fastBayesReg_cv_fit_try(funSEXP, ySEXP, designSEXP, foldSEXP, argsSEXP, n_threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// fast_scalar_img_lm
+Rcpp::List fast_scalar_img_lm(arma::vec& y, arma::mat& X, arma::sp_mat& Phi, int mcmc_sample, int burnin, int thinning, double a_sigma, double b_sigma, double A_tau, double A_lambda);
+static SEXP _fastBayesReg_fast_scalar_img_lm_try(SEXP ySEXP, SEXP XSEXP, SEXP PhiSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< arma::vec& >::type y(ySEXP);
     Rcpp::traits::input_parameter< arma::mat& >::type X(XSEXP);
-    Rcpp::traits::input_parameter< double >::type theta(thetaSEXP);
-    rcpp_result_gen = Rcpp::wrap(super_fast_normal_lm(y, X, theta));
+    Rcpp::traits::input_parameter< arma::sp_mat& >::type Phi(PhiSEXP);
+    Rcpp::traits::input_parameter< int >::type mcmc_sample(mcmc_sampleSEXP);
+    Rcpp::traits::input_parameter< int >::type burnin(burninSEXP);
+    Rcpp::traits::input_parameter< int >::type thinning(thinningSEXP);
+    Rcpp::traits::input_parameter< double >::type a_sigma(a_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type b_sigma(b_sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type A_tau(A_tauSEXP);
+    Rcpp::traits::input_parameter< double >::type A_lambda(A_lambdaSEXP);
+    rcpp_result_gen = Rcpp::wrap(fast_scalar_img_lm(y, X, Phi, mcmc_sample, burnin, thinning, a_sigma, b_sigma, A_tau, A_lambda));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _fastBayesReg_super_fast_normal_lm(SEXP ySEXP, SEXP XSEXP, SEXP thetaSEXP) {
+RcppExport SEXP _fastBayesReg_fast_scalar_img_lm(SEXP ySEXP, SEXP XSEXP, SEXP PhiSEXP, SEXP mcmc_sampleSEXP, SEXP burninSEXP, SEXP thinningSEXP, SEXP a_sigmaSEXP, SEXP b_sigmaSEXP, SEXP A_tauSEXP, SEXP A_lambdaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_fastBayesReg_super_fast_normal_lm_try(ySEXP, XSEXP, thetaSEXP));
+        rcpp_result_gen = PROTECT(_fastBayesReg_fast_scalar_img_lm_try(ySEXP, XSEXP, PhiSEXP, mcmc_sampleSEXP, burninSEXP, thinningSEXP, a_sigmaSEXP, b_sigmaSEXP, A_tauSEXP, A_lambdaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1539,28 +3086,51 @@ static int _fastBayesReg_RcppExport_validate(const char* sig) {
         signatures.insert("Rcpp::List(*sim_linear_reg_multi)(int,int,int,int,double,double,double)");
         signatures.insert("Rcpp::List(*sim_logit_reg)(int,int,int,double,double,double,double)");
         signatures.insert("Rcpp::List(*sim_multiclass_reg)(int,int,int,int,double,double,double,double,Rcpp::Nullable<Rcpp::NumericMatrix>)");
-        signatures.insert("Rcpp::List(*fast_normal_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double)");
+        signatures.insert("Rcpp::List(*sim_linear_reg_big)(SEXP,int,double,double,double,int,int,int)");
+        signatures.insert("Rcpp::List(*sim_logit_reg_big)(SEXP,int,double,double,double,int,int,int)");
+        signatures.insert("Rcpp::List(*fast_normal_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,bool)");
         signatures.insert("arma::mat(*special_rmvnorm)(int,arma::vec&,arma::mat&)");
         signatures.insert("Rcpp::List(*fast_normal_lm_sel)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
         signatures.insert("Rcpp::List(*fast_normal_multi_lm)(arma::mat&,arma::mat&,int,int,int,double,double,double,bool,bool)");
-        signatures.insert("Rcpp::List(*fast_normal_logit)(arma::vec&,arma::mat&,int,int,int,double)");
-        signatures.insert("Rcpp::List(*fast_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int)");
+        signatures.insert("Rcpp::List(*big_normal_multi_lm)(SEXP,arma::mat&,SEXP,int,int,int,int,double,double,double,int,int)");
+        signatures.insert("Rcpp::List(*fast_normal_logit)(arma::vec&,arma::mat&,int,int,int,double,bool)");
+        signatures.insert("Rcpp::List(*fast_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int,std::string)");
+        signatures.insert("Rcpp::List(*fast_normal_logit_block_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,bool,int)");
+        signatures.insert("Rcpp::List(*multilabel_normal_logit_single_gibbs)(arma::mat&,arma::mat&,int,int,int,double,bool,int,bool)");
+        signatures.insert("Rcpp::List(*fast_normal_logit_sel_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,double,double,bool)");
         signatures.insert("Rcpp::List(*scalable_normal_logit_single_gibbs)(arma::vec&,SEXP,arma::uvec&,int,int,int,double,int)");
         signatures.insert("Rcpp::List(*big_normal_logit_single_gibbs)(arma::vec&,SEXP,int,int,int,double,int)");
         signatures.insert("Rcpp::List(*sparse_normal_logit_single_gibbs)(arma::vec&,arma::sp_mat&,int,int,int,double,int)");
+        signatures.insert("Rcpp::List(*interaction_normal_logit_single_gibbs)(arma::vec&,arma::mat&,int,int,int,double,int,bool)");
+        signatures.insert("Rcpp::List(*basis_normal_logit_single_gibbs)(arma::vec&,arma::mat&,arma::sp_mat&,int,int,int,double,int,bool)");
+        signatures.insert("Rcpp::List(*fast_binomial_single_gibbs)(arma::vec&,arma::vec&,arma::mat&,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*sparse_binomial_single_gibbs)(arma::vec&,arma::vec&,arma::sp_mat&,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*big_binomial_single_gibbs)(arma::vec&,arma::vec&,SEXP,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*fast_negbin_single_gibbs)(arma::vec&,arma::mat&,double,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*sparse_negbin_single_gibbs)(arma::vec&,arma::sp_mat&,double,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*big_negbin_single_gibbs)(arma::vec&,SEXP,double,std::string,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*sparse_horseshoe_lm_single_gibbs)(arma::vec&,arma::sp_mat&,int,int,int,double,double,double,double,bool)");
+        signatures.insert("Rcpp::List(*big_horseshoe_lm_single_gibbs)(arma::vec&,SEXP,int,int,int,double,double,double,double,bool)");
+        signatures.insert("Rcpp::List(*sparse_horseshoe_logit_single_gibbs)(arma::vec&,arma::sp_mat&,int,int,int,double,double,bool)");
+        signatures.insert("Rcpp::List(*big_horseshoe_logit_single_gibbs)(arma::vec&,SEXP,int,int,int,double,double,bool)");
         signatures.insert("Rcpp::List(*fast_normal_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
         signatures.insert("Rcpp::List(*fast_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
         signatures.insert("Rcpp::List(*scalable_normal_multiclass_single_gibbs)(arma::vec&,arma::mat&,int,int,int,int,double,int)");
         signatures.insert("Rcpp::List(*fast_mfvb_normal_logit)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
         signatures.insert("Rcpp::List(*fast_mfvb_normal_logit_single)(arma::vec&,arma::mat&,int,double,double,double,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
         signatures.insert("Rcpp::List(*fast_mfvb_multiclass)(arma::vec&,arma::mat&,int,int,int,int,double)");
-        signatures.insert("Rcpp::List(*fast_horseshoe_logit)(arma::vec&,arma::mat&,int,int,int,double,double)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_logit)(arma::vec&,arma::mat&,int,int,int,double,double,bool)");
         signatures.insert("arma::vec(*rand_left_trucnorm0)(int,double,double)");
         signatures.insert("arma::vec(*rand_left_trucnorm)(int,double,double,double,double)");
         signatures.insert("arma::vec(*rand_right_trucnorm)(int,double,double,double,double)");
-        signatures.insert("Rcpp::List(*fast_horseshoe_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
+        signatures.insert("arma::vec(*rand_trucnorm)(arma::vec&,arma::vec&,arma::vec&,arma::vec&,int,int)");
+        signatures.insert("Rcpp::List(*fast_normal_probit)(arma::vec&,arma::mat&,int,int,int,double)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_probit)(arma::vec&,arma::mat&,int,int,int,double,double)");
+        signatures.insert("Rcpp::List(*fast_normal_tobit)(arma::vec&,arma::mat&,arma::vec&,arma::vec&,int,int,int,double,double,double)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double,bool)");
         signatures.insert("Rcpp::List(*fast_horseshoe_ss_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
-        signatures.insert("Rcpp::List(*fast_horseshoe_hd_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_hd_lm)(arma::vec&,arma::mat&,int,int,int,double,double,double,double,int,int,std::string)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_multi_lm)(arma::mat&,arma::mat&,int,int,int,double,double,double,double,bool,int,bool)");
         signatures.insert("Rcpp::List(*predict_fast_lm)(Rcpp::List&,arma::mat&,double)");
         signatures.insert("Rcpp::List(*predict_fast_multi_lm)(Rcpp::List&,arma::mat&)");
         signatures.insert("Rcpp::List(*predict_fast_mfvb_lm)(Rcpp::List&,arma::mat&)");
@@ -1571,6 +3141,21 @@ static int _fastBayesReg_RcppExport_validate(const char* sig) {
         signatures.insert("double(*Rcpp_optimize_H)(arma::mat&,arma::mat&)");
         signatures.insert("double(*Rcpp_optimize_L)(arma::mat&,arma::mat&,double&,int&)");
         signatures.insert("Rcpp::List(*super_fast_normal_lm)(arma::vec&,arma::mat&,double)");
+        signatures.insert("Rcpp::List(*super_fast_normal_lm_batch)(arma::vec&,arma::mat&,arma::ivec&,double,int,bool)");
+        signatures.insert("Rcpp::List(*fast_normal_lm_batch)(arma::vec&,arma::mat&,arma::ivec&,int,int,int,double,double,double,bool)");
+        signatures.insert("Rcpp::List(*super_fast_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&)");
+        signatures.insert("Rcpp::List(*fast_mfvb_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,Rcpp::NumericVector,int,double)");
+        signatures.insert("Rcpp::List(*fast_mfvb_normal_logit_path)(arma::vec&,arma::mat&,arma::vec&,int,double)");
+        signatures.insert("Rcpp::List(*fast_normal_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,Rcpp::NumericVector,int,int,int,int)");
+        signatures.insert("Rcpp::List(*fast_horseshoe_lm_path)(arma::vec&,arma::mat&,arma::vec&,Rcpp::NumericVector,double,double,int,int,int,int)");
+        signatures.insert("int(*register_design)(arma::mat&,bool)");
+        signatures.insert("bool(*release_design)(int)");
+        signatures.insert("int(*submit_fit)(std::string,arma::vec&,int,Rcpp::Nullable<Rcpp::List>)");
+        signatures.insert("std::string(*poll_fit)(int)");
+        signatures.insert("Rcpp::List(*wait_fit)(int)");
+        signatures.insert("bool(*cancel_fit)(int)");
+        signatures.insert("Rcpp::List(*cv_fit)(std::string,arma::vec&,int,arma::ivec&,Rcpp::Nullable<Rcpp::List>,int)");
+        signatures.insert("Rcpp::List(*fast_scalar_img_lm)(arma::vec&,arma::mat&,arma::sp_mat&,int,int,int,double,double,double,double)");
     }
     return signatures.find(sig) != signatures.end();
 }
@@ -1584,15 +3169,33 @@ RcppExport SEXP _fastBayesReg_RcppExport_registerCCallable() {
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sim_linear_reg_multi", (DL_FUNC)_fastBayesReg_sim_linear_reg_multi_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sim_logit_reg", (DL_FUNC)_fastBayesReg_sim_logit_reg_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sim_multiclass_reg", (DL_FUNC)_fastBayesReg_sim_multiclass_reg_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sim_linear_reg_big", (DL_FUNC)_fastBayesReg_sim_linear_reg_big_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sim_logit_reg_big", (DL_FUNC)_fastBayesReg_sim_logit_reg_big_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm", (DL_FUNC)_fastBayesReg_fast_normal_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_special_rmvnorm", (DL_FUNC)_fastBayesReg_special_rmvnorm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm_sel", (DL_FUNC)_fastBayesReg_fast_normal_lm_sel_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multi_lm", (DL_FUNC)_fastBayesReg_fast_normal_multi_lm_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_normal_multi_lm", (DL_FUNC)_fastBayesReg_big_normal_multi_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit", (DL_FUNC)_fastBayesReg_fast_normal_logit_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_fast_normal_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_block_gibbs", (DL_FUNC)_fastBayesReg_fast_normal_logit_block_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_multilabel_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_multilabel_normal_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_logit_sel_single_gibbs", (DL_FUNC)_fastBayesReg_fast_normal_logit_sel_single_gibbs_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_scalable_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_scalable_normal_logit_single_gibbs_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_big_normal_logit_single_gibbs_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sparse_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_sparse_normal_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_interaction_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_interaction_normal_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_basis_normal_logit_single_gibbs", (DL_FUNC)_fastBayesReg_basis_normal_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_binomial_single_gibbs", (DL_FUNC)_fastBayesReg_fast_binomial_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sparse_binomial_single_gibbs", (DL_FUNC)_fastBayesReg_sparse_binomial_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_binomial_single_gibbs", (DL_FUNC)_fastBayesReg_big_binomial_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_negbin_single_gibbs", (DL_FUNC)_fastBayesReg_fast_negbin_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sparse_negbin_single_gibbs", (DL_FUNC)_fastBayesReg_sparse_negbin_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_negbin_single_gibbs", (DL_FUNC)_fastBayesReg_big_negbin_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sparse_horseshoe_lm_single_gibbs", (DL_FUNC)_fastBayesReg_sparse_horseshoe_lm_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_horseshoe_lm_single_gibbs", (DL_FUNC)_fastBayesReg_big_horseshoe_lm_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_sparse_horseshoe_logit_single_gibbs", (DL_FUNC)_fastBayesReg_sparse_horseshoe_logit_single_gibbs_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_big_horseshoe_logit_single_gibbs", (DL_FUNC)_fastBayesReg_big_horseshoe_logit_single_gibbs_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass", (DL_FUNC)_fastBayesReg_fast_normal_multiclass_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_multiclass_single_gibbs", (DL_FUNC)_fastBayesReg_fast_normal_multiclass_single_gibbs_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_scalable_normal_multiclass_single_gibbs", (DL_FUNC)_fastBayesReg_scalable_normal_multiclass_single_gibbs_try);
@@ -1603,9 +3206,14 @@ RcppExport SEXP _fastBayesReg_RcppExport_registerCCallable() {
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm0", (DL_FUNC)_fastBayesReg_rand_left_trucnorm0_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_rand_left_trucnorm", (DL_FUNC)_fastBayesReg_rand_left_trucnorm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_rand_right_trucnorm", (DL_FUNC)_fastBayesReg_rand_right_trucnorm_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_rand_trucnorm", (DL_FUNC)_fastBayesReg_rand_trucnorm_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_probit", (DL_FUNC)_fastBayesReg_fast_normal_probit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_probit", (DL_FUNC)_fastBayesReg_fast_horseshoe_probit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_tobit", (DL_FUNC)_fastBayesReg_fast_normal_tobit_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_lm", (DL_FUNC)_fastBayesReg_fast_horseshoe_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_ss_lm", (DL_FUNC)_fastBayesReg_fast_horseshoe_ss_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_hd_lm", (DL_FUNC)_fastBayesReg_fast_horseshoe_hd_lm_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_multi_lm", (DL_FUNC)_fastBayesReg_fast_horseshoe_multi_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_predict_fast_lm", (DL_FUNC)_fastBayesReg_predict_fast_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_predict_fast_multi_lm", (DL_FUNC)_fastBayesReg_predict_fast_multi_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_predict_fast_mfvb_lm", (DL_FUNC)_fastBayesReg_predict_fast_mfvb_lm_try);
@@ -1616,10 +3224,27 @@ RcppExport SEXP _fastBayesReg_RcppExport_registerCCallable() {
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_Rcpp_optimize_H", (DL_FUNC)_fastBayesReg_Rcpp_optimize_H_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_Rcpp_optimize_L", (DL_FUNC)_fastBayesReg_Rcpp_optimize_L_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_super_fast_normal_lm", (DL_FUNC)_fastBayesReg_super_fast_normal_lm_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_super_fast_normal_lm_batch", (DL_FUNC)_fastBayesReg_super_fast_normal_lm_batch_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm_batch", (DL_FUNC)_fastBayesReg_fast_normal_lm_batch_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_super_fast_normal_lm_path", (DL_FUNC)_fastBayesReg_super_fast_normal_lm_path_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_lm_path", (DL_FUNC)_fastBayesReg_fast_mfvb_normal_lm_path_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_mfvb_normal_logit_path", (DL_FUNC)_fastBayesReg_fast_mfvb_normal_logit_path_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_normal_lm_path", (DL_FUNC)_fastBayesReg_fast_normal_lm_path_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_horseshoe_lm_path", (DL_FUNC)_fastBayesReg_fast_horseshoe_lm_path_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_register_design", (DL_FUNC)_fastBayesReg_register_design_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_release_design", (DL_FUNC)_fastBayesReg_release_design_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_submit_fit", (DL_FUNC)_fastBayesReg_submit_fit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_poll_fit", (DL_FUNC)_fastBayesReg_poll_fit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_wait_fit", (DL_FUNC)_fastBayesReg_wait_fit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_cancel_fit", (DL_FUNC)_fastBayesReg_cancel_fit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_cv_fit", (DL_FUNC)_fastBayesReg_cv_fit_try);
+    R_RegisterCCallable("fastBayesReg", "_fastBayesReg_fast_scalar_img_lm", (DL_FUNC)_fastBayesReg_fast_scalar_img_lm_try);
     R_RegisterCCallable("fastBayesReg", "_fastBayesReg_RcppExport_validate", (DL_FUNC)_fastBayesReg_RcppExport_validate);
     return R_NilValue;
 }
 
+void register_lazy_outputs(DllInfo* dll);
+
 static const R_CallMethodDef CallEntries[] = {
     {"_fastBayesReg_log1mexpm", (DL_FUNC) &_fastBayesReg_log1mexpm, 1},
     {"_fastBayesReg_log1pexp", (DL_FUNC) &_fastBayesReg_log1pexp, 1},
@@ -1628,28 +3253,51 @@ static const R_CallMethodDef CallEntries[] = {
     {"_fastBayesReg_sim_linear_reg_multi", (DL_FUNC) &_fastBayesReg_sim_linear_reg_multi, 7},
     {"_fastBayesReg_sim_logit_reg", (DL_FUNC) &_fastBayesReg_sim_logit_reg, 7},
     {"_fastBayesReg_sim_multiclass_reg", (DL_FUNC) &_fastBayesReg_sim_multiclass_reg, 9},
-    {"_fastBayesReg_fast_normal_lm", (DL_FUNC) &_fastBayesReg_fast_normal_lm, 8},
+    {"_fastBayesReg_sim_linear_reg_big", (DL_FUNC) &_fastBayesReg_sim_linear_reg_big, 8},
+    {"_fastBayesReg_sim_logit_reg_big", (DL_FUNC) &_fastBayesReg_sim_logit_reg_big, 8},
+    {"_fastBayesReg_fast_normal_lm", (DL_FUNC) &_fastBayesReg_fast_normal_lm, 9},
     {"_fastBayesReg_special_rmvnorm", (DL_FUNC) &_fastBayesReg_special_rmvnorm, 3},
     {"_fastBayesReg_fast_normal_lm_sel", (DL_FUNC) &_fastBayesReg_fast_normal_lm_sel, 9},
     {"_fastBayesReg_fast_normal_multi_lm", (DL_FUNC) &_fastBayesReg_fast_normal_multi_lm, 10},
-    {"_fastBayesReg_fast_normal_logit", (DL_FUNC) &_fastBayesReg_fast_normal_logit, 6},
-    {"_fastBayesReg_fast_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_normal_logit_single_gibbs, 7},
+    {"_fastBayesReg_big_normal_multi_lm", (DL_FUNC) &_fastBayesReg_big_normal_multi_lm, 12},
+    {"_fastBayesReg_fast_normal_logit", (DL_FUNC) &_fastBayesReg_fast_normal_logit, 7},
+    {"_fastBayesReg_fast_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_normal_logit_single_gibbs, 8},
+    {"_fastBayesReg_fast_normal_logit_block_gibbs", (DL_FUNC) &_fastBayesReg_fast_normal_logit_block_gibbs, 9},
+    {"_fastBayesReg_multilabel_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_multilabel_normal_logit_single_gibbs, 9},
+    {"_fastBayesReg_fast_normal_logit_sel_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_normal_logit_sel_single_gibbs, 9},
     {"_fastBayesReg_scalable_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_scalable_normal_logit_single_gibbs, 8},
     {"_fastBayesReg_big_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_big_normal_logit_single_gibbs, 7},
     {"_fastBayesReg_sparse_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_sparse_normal_logit_single_gibbs, 7},
+    {"_fastBayesReg_interaction_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_interaction_normal_logit_single_gibbs, 8},
+    {"_fastBayesReg_basis_normal_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_basis_normal_logit_single_gibbs, 9},
+    {"_fastBayesReg_fast_binomial_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_binomial_single_gibbs, 10},
+    {"_fastBayesReg_sparse_binomial_single_gibbs", (DL_FUNC) &_fastBayesReg_sparse_binomial_single_gibbs, 10},
+    {"_fastBayesReg_big_binomial_single_gibbs", (DL_FUNC) &_fastBayesReg_big_binomial_single_gibbs, 10},
+    {"_fastBayesReg_fast_negbin_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_negbin_single_gibbs, 10},
+    {"_fastBayesReg_sparse_negbin_single_gibbs", (DL_FUNC) &_fastBayesReg_sparse_negbin_single_gibbs, 10},
+    {"_fastBayesReg_big_negbin_single_gibbs", (DL_FUNC) &_fastBayesReg_big_negbin_single_gibbs, 10},
+    {"_fastBayesReg_sparse_horseshoe_lm_single_gibbs", (DL_FUNC) &_fastBayesReg_sparse_horseshoe_lm_single_gibbs, 10},
+    {"_fastBayesReg_big_horseshoe_lm_single_gibbs", (DL_FUNC) &_fastBayesReg_big_horseshoe_lm_single_gibbs, 10},
+    {"_fastBayesReg_sparse_horseshoe_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_sparse_horseshoe_logit_single_gibbs, 8},
+    {"_fastBayesReg_big_horseshoe_logit_single_gibbs", (DL_FUNC) &_fastBayesReg_big_horseshoe_logit_single_gibbs, 8},
     {"_fastBayesReg_fast_normal_multiclass", (DL_FUNC) &_fastBayesReg_fast_normal_multiclass, 7},
     {"_fastBayesReg_fast_normal_multiclass_single_gibbs", (DL_FUNC) &_fastBayesReg_fast_normal_multiclass_single_gibbs, 8},
     {"_fastBayesReg_scalable_normal_multiclass_single_gibbs", (DL_FUNC) &_fastBayesReg_scalable_normal_multiclass_single_gibbs, 8},
     {"_fastBayesReg_fast_mfvb_normal_logit", (DL_FUNC) &_fastBayesReg_fast_mfvb_normal_logit, 8},
     {"_fastBayesReg_fast_mfvb_normal_logit_single", (DL_FUNC) &_fastBayesReg_fast_mfvb_normal_logit_single, 8},
     {"_fastBayesReg_fast_mfvb_multiclass", (DL_FUNC) &_fastBayesReg_fast_mfvb_multiclass, 7},
-    {"_fastBayesReg_fast_horseshoe_logit", (DL_FUNC) &_fastBayesReg_fast_horseshoe_logit, 7},
+    {"_fastBayesReg_fast_horseshoe_logit", (DL_FUNC) &_fastBayesReg_fast_horseshoe_logit, 8},
     {"_fastBayesReg_rand_left_trucnorm0", (DL_FUNC) &_fastBayesReg_rand_left_trucnorm0, 3},
     {"_fastBayesReg_rand_left_trucnorm", (DL_FUNC) &_fastBayesReg_rand_left_trucnorm, 5},
     {"_fastBayesReg_rand_right_trucnorm", (DL_FUNC) &_fastBayesReg_rand_right_trucnorm, 5},
-    {"_fastBayesReg_fast_horseshoe_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_lm, 9},
+    {"_fastBayesReg_rand_trucnorm", (DL_FUNC) &_fastBayesReg_rand_trucnorm, 6},
+    {"_fastBayesReg_fast_normal_probit", (DL_FUNC) &_fastBayesReg_fast_normal_probit, 6},
+    {"_fastBayesReg_fast_horseshoe_probit", (DL_FUNC) &_fastBayesReg_fast_horseshoe_probit, 7},
+    {"_fastBayesReg_fast_normal_tobit", (DL_FUNC) &_fastBayesReg_fast_normal_tobit, 10},
+    {"_fastBayesReg_fast_horseshoe_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_lm, 10},
     {"_fastBayesReg_fast_horseshoe_ss_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_ss_lm, 9},
-    {"_fastBayesReg_fast_horseshoe_hd_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_hd_lm, 9},
+    {"_fastBayesReg_fast_horseshoe_hd_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_hd_lm, 12},
+    {"_fastBayesReg_fast_horseshoe_multi_lm", (DL_FUNC) &_fastBayesReg_fast_horseshoe_multi_lm, 12},
     {"_fastBayesReg_predict_fast_lm", (DL_FUNC) &_fastBayesReg_predict_fast_lm, 3},
     {"_fastBayesReg_predict_fast_multi_lm", (DL_FUNC) &_fastBayesReg_predict_fast_multi_lm, 2},
     {"_fastBayesReg_predict_fast_mfvb_lm", (DL_FUNC) &_fastBayesReg_predict_fast_mfvb_lm, 2},
@@ -1660,6 +3308,21 @@ static const R_CallMethodDef CallEntries[] = {
     {"_fastBayesReg_Rcpp_optimize_H", (DL_FUNC) &_fastBayesReg_Rcpp_optimize_H, 2},
     {"_fastBayesReg_Rcpp_optimize_L", (DL_FUNC) &_fastBayesReg_Rcpp_optimize_L, 4},
     {"_fastBayesReg_super_fast_normal_lm", (DL_FUNC) &_fastBayesReg_super_fast_normal_lm, 3},
+    {"_fastBayesReg_super_fast_normal_lm_batch", (DL_FUNC) &_fastBayesReg_super_fast_normal_lm_batch, 6},
+    {"_fastBayesReg_fast_normal_lm_batch", (DL_FUNC) &_fastBayesReg_fast_normal_lm_batch, 10},
+    {"_fastBayesReg_super_fast_normal_lm_path", (DL_FUNC) &_fastBayesReg_super_fast_normal_lm_path, 3},
+    {"_fastBayesReg_fast_mfvb_normal_lm_path", (DL_FUNC) &_fastBayesReg_fast_mfvb_normal_lm_path, 7},
+    {"_fastBayesReg_fast_mfvb_normal_logit_path", (DL_FUNC) &_fastBayesReg_fast_mfvb_normal_logit_path, 5},
+    {"_fastBayesReg_fast_normal_lm_path", (DL_FUNC) &_fastBayesReg_fast_normal_lm_path, 9},
+    {"_fastBayesReg_fast_horseshoe_lm_path", (DL_FUNC) &_fastBayesReg_fast_horseshoe_lm_path, 10},
+    {"_fastBayesReg_register_design", (DL_FUNC) &_fastBayesReg_register_design, 2},
+    {"_fastBayesReg_release_design", (DL_FUNC) &_fastBayesReg_release_design, 1},
+    {"_fastBayesReg_submit_fit", (DL_FUNC) &_fastBayesReg_submit_fit, 4},
+    {"_fastBayesReg_poll_fit", (DL_FUNC) &_fastBayesReg_poll_fit, 1},
+    {"_fastBayesReg_wait_fit", (DL_FUNC) &_fastBayesReg_wait_fit, 1},
+    {"_fastBayesReg_cancel_fit", (DL_FUNC) &_fastBayesReg_cancel_fit, 1},
+    {"_fastBayesReg_cv_fit", (DL_FUNC) &_fastBayesReg_cv_fit, 6},
+    {"_fastBayesReg_fast_scalar_img_lm", (DL_FUNC) &_fastBayesReg_fast_scalar_img_lm, 10},
     {"_fastBayesReg_RcppExport_registerCCallable", (DL_FUNC) &_fastBayesReg_RcppExport_registerCCallable, 0},
     {NULL, NULL, 0}
 };
@@ -1667,4 +3330,5 @@ static const R_CallMethodDef CallEntries[] = {
 RcppExport void R_init_fastBayesReg(DllInfo *dll) {
     R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
     R_useDynamicSymbols(dll, FALSE);
+    register_lazy_outputs(dll);
 }
@@ -15,6 +15,21 @@ using namespace arma;
 
 
 #include <bigmemory/BigMatrix.h>
+#include <R_ext/Altrep.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <random>
 
 //'@importFrom Rcpp evalCpp
 //'@importFrom pgdraw pgdraw
@@ -26,7 +41,81 @@ using namespace arma;
 
 #define LOG2 0.693147180559945
 
+// number of OpenMP threads used by the multi-threaded routines;
+// n_threads <= 0 means all available threads
+int get_num_threads(int n_threads){
+#ifdef _OPENMP
+	if(n_threads <= 0)
+		n_threads = omp_get_max_threads();
+	return n_threads;
+#else
+	return 1;
+#endif
+}
+
+// first-touch copy of X: the columns are written by the OpenMP threads in
+// static blocks, so under OMP_PROC_BIND=spread and OMP_PLACES=sockets the
+// pages of the copy are interleaved across the NUMA nodes instead of all
+// sitting on the node where R allocated X. Used by the numa_interleave option
+// of the multi-threaded routines; n_threads = 1 gives a plain copy
+void first_touch_copy(arma::mat& X_local, const arma::mat& X, int n_threads){
+	X_local.set_size(X.n_rows, X.n_cols);
+	int p = X.n_cols;
+	#pragma omp parallel for schedule(static) num_threads(get_num_threads(n_threads))
+	for(int j=0;j<p;j++){
+		std::copy(X.colptr(j),X.colptr(j)+X.n_rows,X_local.colptr(j));
+	}
+}
+
+
+
+// branch-free kernels of the link functions: each piece of the stable
+// formula is evaluated and selected rather than branched on, so the
+// single-pass loops of link_apply are vectorized by the compiler
+inline double log1pexp_kernel(double x){
+	return std::max(x,0.0) + std::log1p(std::exp(-std::fabs(x)));
+}
 
+inline double sigmoid_kernel(double x){
+	double e = std::exp(-std::fabs(x));
+	double r = 1.0/(1.0+e);
+	return x>=0 ? r : e*r;
+}
+
+inline double log1mexp_kernel(double x){
+	double y0 = std::log(-std::expm1(-x));
+	double y1 = std::log1p(-std::exp(-x));
+	return x<=LOG2 ? y0 : y1;
+}
+
+// y = f(x) elementwise in one pass; y may be x itself
+template<double (*f)(double)>
+void link_apply(const arma::mat& x, arma::mat& y){
+	y.set_size(x.n_rows, x.n_cols);
+	const double* x_mem = x.memptr();
+	double* y_mem = y.memptr();
+	arma::uword n = x.n_elem;
+	#pragma omp simd
+	for(arma::uword i=0;i<n;i++)
+		y_mem[i] = f(x_mem[i]);
+}
+
+// log(1/(1+exp(-x))) and log(1-1/(1+exp(-x))) in one pass, as used by the
+// stick-breaking class probabilities of the multiclass models
+void log_sigmoid_both(const arma::mat& x, arma::mat& log_p, arma::mat& log_1_p){
+	log_p.set_size(x.n_rows, x.n_cols);
+	log_1_p.set_size(x.n_rows, x.n_cols);
+	const double* x_mem = x.memptr();
+	double* p_mem = log_p.memptr();
+	double* q_mem = log_1_p.memptr();
+	arma::uword n = x.n_elem;
+	#pragma omp simd
+	for(arma::uword i=0;i<n;i++){
+		double l = std::log1p(std::exp(-std::fabs(x_mem[i])));
+		p_mem[i] = std::min(x_mem[i],0.0) - l;
+		q_mem[i] = std::min(-x_mem[i],0.0) - l;
+	}
+}
 
 //'@title Accurately compute log(1-exp(-x)) for x > 0
 //'@param x a vector of nonnegative numbers
@@ -39,12 +128,8 @@ using namespace arma;
 //'@export
 //[[Rcpp::export]]
  arma::vec log1mexpm(arma::vec& x){
- 	arma::uvec idx1 = arma::find(x<=LOG2);
- 	arma::uvec idx0 = arma::find(x>LOG2);
  	arma::vec y;
- 	y.zeros(x.n_elem);
- 	y.elem(idx1) = arma::log(0.0 - arma::expm1(0.0-x.elem(idx1)));
- 	y.elem(idx0) = arma::log1p(0.0 - arma::exp(0.0-x.elem(idx0)));
+ 	link_apply<log1mexp_kernel>(x, y);
  	return y;
  }
 
@@ -60,32 +145,16 @@ using namespace arma;
 //'@export
 //[[Rcpp::export]]
  arma::vec log1pexp(arma::vec& x){
- 	arma::uvec idx0 = arma::find(x<=-37);
- 	arma::uvec idx1 = arma::find(x>-37 && x<=18);
- 	arma::uvec idx2 = arma::find(x>18 && x<=33.3);
- 	arma::uvec idx3 = arma::find(x>33.3);
  	arma::vec y;
- 	y.zeros(x.n_elem);
- 	y.elem(idx0) = arma::exp(x.elem(idx0));
- 	y.elem(idx1) = arma::log1p(arma::exp(x.elem(idx1)));
- 	y.elem(idx2) = x.elem(idx2) + arma::exp(0.0-x.elem(idx2));
- 	y.elem(idx3) = x.elem(idx3);
+ 	link_apply<log1pexp_kernel>(x, y);
  	return y;
  }
 
 
 //[[Rcpp::export]]
  arma::mat log1pexp_mat(arma::mat& x){
- 	arma::uvec idx0 = arma::find(x<=-37);
- 	arma::uvec idx1 = arma::find(x>-37 && x<=18);
- 	arma::uvec idx2 = arma::find(x>18 && x<=33.3);
- 	arma::uvec idx3 = arma::find(x>33.3);
  	arma::mat y;
- 	y.zeros(x.n_rows,x.n_cols);
- 	y.elem(idx0) = arma::exp(x.elem(idx0));
- 	y.elem(idx1) = arma::log1p(arma::exp(x.elem(idx1)));
- 	y.elem(idx2) = x.elem(idx2) + arma::exp(0.0-x.elem(idx2));
- 	y.elem(idx3) = x.elem(idx3);
+ 	link_apply<log1pexp_kernel>(x, y);
  	return y;
  }
 
@@ -121,9 +190,7 @@ using namespace arma;
  	if(q>2*qh){
  		beta_nonzero = arma::join_cols(beta_nonzero,vec({beta_size}));
  	}
- 	for(arma::uword i=0;i<x.n_cols;i++){
- 		x.col(i) += z;
- 	}
+ 	x.each_col() += z;
  	arma::vec y = x.cols(0,q-1L)*beta_nonzero;
  	double var_y = arma::var(y);
  	double sigma2 = var_y*(1.0 - R2)/R2;
@@ -170,9 +237,7 @@ Rcpp::List sim_linear_reg_multi(int n = 100, int p = 20, int m = 5,
  	if(q>2*qh){
  		beta_nonzero = arma::join_cols(beta_nonzero,arma::ones<arma::mat>(1,m)*beta_size);
  	}
- 	for(arma::uword i=0;i<x.n_cols;i++){
- 		x.col(i) += z;
- 	}
+ 	x.each_col() += z;
  	arma::mat y = x.cols(0,q-1L)*beta_nonzero;
  	arma::rowvec var_y = arma::var(y,0,0);
  	arma::rowvec sigma2 = var_y*(1.0 - R2)/R2;
@@ -217,9 +282,7 @@ Rcpp::List sim_logit_reg(int n = 100, int p = 20, int q = 5,
  	if(density==1.0){
  		arma::mat x = sqrt(1.0 - X_cor)*arma::randn<arma::mat>(n,p);
  		arma::vec z = sqrt(X_cor)*arma::randn<arma::vec>(n);
- 		for(arma::uword i=0;i<x.n_cols;i++){
- 			x.col(i) += z;
- 		}
+ 		x.each_col() += z;
  		x *= sqrt(X_var);
  		int qh = q/2;
  		arma::vec beta_nonzero = arma::repmat(vec({beta_size,-beta_size}),qh,1);
@@ -228,7 +291,8 @@ Rcpp::List sim_logit_reg(int n = 100, int p = 20, int q = 5,
  		}
 
  		arma::vec mu = x.cols(0,q-1L)*beta_nonzero;
- 		arma::vec prob = 1.0/(1+exp(-mu));
+ 		arma::vec prob;
+ 		link_apply<sigmoid_kernel>(mu, prob);
  		arma::uvec y;
  		y.zeros(n);
  		arma::uvec idx1 = arma::find(arma::randu(n) < prob);
@@ -259,7 +323,8 @@ Rcpp::List sim_logit_reg(int n = 100, int p = 20, int q = 5,
  		}
 
  		arma::vec mu = x.cols(0,q-1L)*beta_nonzero;
- 		arma::vec prob = 1.0/(1+exp(-mu));
+ 		arma::vec prob;
+ 		link_apply<sigmoid_kernel>(mu, prob);
  		arma::uvec y;
  		y.zeros(n);
  		arma::uvec idx1 = arma::find(arma::randu(n) < prob);
@@ -337,9 +402,7 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
  		beta_nonzero_mat.col(k) = beta_nonzero;
  	}
 
- 	for(arma::uword i=0;i<x.n_cols;i++){
- 		x.col(i) += z;
- 	}
+ 	x.each_col() += z;
  	x *= sqrt(X_var);
  	arma::mat mu = x.cols(0,q-1L)*beta_nonzero_mat;
  	mu.each_row() += intercept.t();
@@ -347,9 +410,10 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
  	arma::mat log_1_prob(n,K-1);
  	for(int k=K-1; k>=1;k--){
  		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
- 		arma::vec log_prob = mu.col(k-1);
- 		log_1_prob.col(k-1) = -log1pexp(log_prob);
- 		log_prob += log_1_prob.col(k-1);
+ 		arma::vec log_prob;
+ 		arma::vec log_1_prob_k;
+ 		log_sigmoid_both(mu.col(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.col(k-1) = log_1_prob_k;
  		prob.col(k-1) = log_prob;
  		if(k<K-1){
  			for(int j=k; j<K-1; j++){
@@ -382,12 +446,260 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
  }
 
 
- void one_step_update_big_p(arma::vec& betacoef, double& sigma2_eps, double& tau2,
+// fill a big.matrix with equicorrelated normal covariates
+// x_ij = sqrt(X_var)*(sqrt(1-X_cor)*e_ij + sqrt(X_cor)*z_i). The shared
+// factor z uses stream 0 and column block b uses stream b+1 of the seed, so
+// the result does not depend on the number of threads
+void sim_fill_big(arma::mat& X, double X_cor, double X_var,
+                  int seed, int block_size, int n_threads){
+	int n = X.n_rows;
+	int p = X.n_cols;
+	if(block_size<1)
+		block_size = 1;
+	int num_blocks = (p + block_size - 1)/block_size;
+	arma::vec z(n);
+	std::seed_seq seq0{seed, 0};
+	std::mt19937_64 rng0(seq0);
+	std::normal_distribution<double> rnorm0(0.0, 1.0);
+	for(int i=0;i<n;i++)
+		z(i) = sqrt(X_cor)*rnorm0(rng0);
+
+	double sd = sqrt(1.0 - X_cor);
+	double scale = sqrt(X_var);
+	#pragma omp parallel for schedule(dynamic) num_threads(get_num_threads(n_threads))
+	for(int b=0;b<num_blocks;b++){
+		std::seed_seq seq{seed, b+1};
+		std::mt19937_64 rng(seq);
+		std::normal_distribution<double> rnorm(0.0, 1.0);
+		int j_end = std::min(p, (b+1)*block_size);
+		for(int j=b*block_size;j<j_end;j++){
+			double* x_j = X.colptr(j);
+			for(int i=0;i<n;i++)
+				x_j[i] = scale*(sd*rnorm(rng) + z(i));
+		}
+	}
+}
+
+void check_big_double(Rcpp::XPtr<BigMatrix>& xpMat, std::string name = "bigX"){
+	if(xpMat->matrix_type()!=8)
+		Rcpp::stop(name + " must be a big.matrix of type double");
+	if(xpMat->separated_columns())
+		Rcpp::stop(name + " must not have separated columns");
+}
+
+// Lazily evaluated outputs: the fitted probabilities of a binary regression
+// are returned as ALTREP vectors that are only computed when R first reads
+// them. data1 holds mu and the link and data2 the values once they have been
+// computed. mu itself is always computed eagerly, since a big.matrix design
+// may be overwritten after the fit
+enum lazy_link {LAZY_LINK_LOGIT, LAZY_LINK_PROBIT};
+
+R_altrep_class_t lazy_prob_class;
+
+SEXP lazy_values(SEXP x){
+	SEXP values = R_altrep_data2(x);
+	if(values!=R_NilValue)
+		return values;
+	SEXP state = R_altrep_data1(x);
+	SEXP mu_r = VECTOR_ELT(state,0);
+	int link = INTEGER(VECTOR_ELT(state,1))[0];
+	R_xlen_t n = XLENGTH(mu_r);
+	values = PROTECT(Rf_allocVector(REALSXP, n));
+	const double* mu = REAL(mu_r);
+	double* prob = REAL(values);
+	for(R_xlen_t i=0;i<n;i++){
+		if(link==LAZY_LINK_LOGIT)
+			prob[i] = sigmoid_kernel(mu[i]);
+		else
+			prob[i] = R::pnorm(mu[i],0.0,1.0,1,0);
+	}
+	R_set_altrep_data2(x, values);
+	UNPROTECT(1);
+	return values;
+}
+
+R_xlen_t lazy_length(SEXP x){
+	return XLENGTH(VECTOR_ELT(R_altrep_data1(x),0));
+}
+
+void* lazy_dataptr(SEXP x, Rboolean writeable){
+	return REAL(lazy_values(x));
+}
+
+const void* lazy_dataptr_or_null(SEXP x){
+	SEXP values = R_altrep_data2(x);
+	return values==R_NilValue ? NULL : REAL(values);
+}
+
+double lazy_elt(SEXP x, R_xlen_t i){
+	return REAL(lazy_values(x))[i];
+}
+
+// no ALTREP state is serialized: the values are computed here and R writes
+// an ordinary double vector, so a saved fit can be read without the package
+SEXP lazy_serialized_state(SEXP x){
+	lazy_values(x);
+	return NULL;
+}
+
+//[[Rcpp::init]]
+void register_lazy_outputs(DllInfo* dll){
+	lazy_prob_class = R_make_altreal_class("lazy_prob", "fastBayesReg", dll);
+	R_set_altrep_Length_method(lazy_prob_class, lazy_length);
+	R_set_altvec_Dataptr_method(lazy_prob_class, lazy_dataptr);
+	R_set_altvec_Dataptr_or_null_method(lazy_prob_class, lazy_dataptr_or_null);
+	R_set_altreal_Elt_method(lazy_prob_class, lazy_elt);
+	R_set_altrep_Serialized_state_method(lazy_prob_class, lazy_serialized_state);
+}
+
+// fitted probabilities F(mu) of a binary regression, computed on first access
+SEXP lazy_prob(SEXP mu, int link){
+	Rcpp::List state = Rcpp::List::create(mu, Rcpp::IntegerVector::create(link));
+	Rcpp::RObject x = R_new_altrep(lazy_prob_class, state, R_NilValue);
+	x.attr("dim") = Rf_getAttrib(mu, R_DimSymbol);
+	return x;
+}
+
+//'@title Simulate data from the linear regression model into a big.matrix
+//'@param bigX address of an n x p big.matrix of type double, e.g. a
+//'filebacked.big.matrix, which is overwritten by the candidate predictors
+//'@param q number of nonzero predictors
+//'@param R2 R-squared indicating the proportion of variation explained by the predictors
+//'@param X_cor correlation between covariates
+//'@param beta_size effect size of beta coefficients
+//'@param seed seed of the random number streams; the output does not depend on n_threads
+//'@param block_size number of columns simulated by one random number stream
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@return a list objects consisting of the following components
+//'\describe{
+//'\item{y}{vector of n outcome variables}
+//'\item{betacoef}{vector of p regression coeficients}
+//'\item{R2}{R-squared indicating the proportion of variation explained by the predictors}
+//'\item{sigma2}{noise variance}
+//'\item{X_cor}{correlation between covariates}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'X <- filebacked.big.matrix(1000,5000,type="double",backingfile="X.bin",
+//'descriptorfile="X.desc",backingpath=tempdir())
+//'dat <- sim_linear_reg_big(X@address,q=6,X_cor=0.9)
+//'res <- super_fast_normal_lm(dat$y,X[,])
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List sim_linear_reg_big(SEXP bigX, int q = 5,
+                               double R2 = 0.95, double X_cor = 0.5,
+                               double beta_size = 1, int seed = 2022,
+                               int block_size = 256, int n_threads = 0){
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat x((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	int n = x.n_rows;
+ 	int p = x.n_cols;
+ 	if(q>p)
+ 		Rcpp::stop("q must not be larger than the number of columns of bigX");
+ 	sim_fill_big(x, X_cor, 1.0, seed, block_size, n_threads);
+
+ 	int qh = q/2;
+ 	arma::vec beta_nonzero = arma::repmat(vec({beta_size,-beta_size}),qh,1);
+ 	if(q>2*qh){
+ 		beta_nonzero = arma::join_cols(beta_nonzero,vec({beta_size}));
+ 	}
+ 	arma::vec y = x.cols(0,q-1L)*beta_nonzero;
+ 	double var_y = arma::var(y);
+ 	double sigma2 = var_y*(1.0 - R2)/R2;
+ 	std::seed_seq seq{seed, -1};
+ 	std::mt19937_64 rng(seq);
+ 	std::normal_distribution<double> rnorm(0.0, sqrt(sigma2));
+ 	for(int i=0;i<n;i++)
+ 		y(i) += rnorm(rng);
+ 	return Rcpp::List::create(Named("y") = y,
+                            Named("betacoef") = arma::join_cols(beta_nonzero,arma::zeros<arma::vec>(p-q)),
+                            Named("R2") = R2,
+                            Named("sigma2") = sigma2,
+                            Named("X_cor") = X_cor);
+ }
+
+//'@title Simulate data from the logistic regression model into a big.matrix
+//'@param bigX address of an n x p big.matrix of type double, e.g. a
+//'filebacked.big.matrix, which is overwritten by the candidate predictors
+//'@param q number of nonzero predictors
+//'@param X_cor correlation between covariates
+//'@param X_var marginal variance of covariates
+//'@param beta_size effect size of beta coefficients
+//'@param seed seed of the random number streams; the output does not depend on n_threads
+//'@param block_size number of columns simulated by one random number stream
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@return a list objects consisting of the following components
+//'\describe{
+//'\item{y}{vector of n outcome variables}
+//'\item{betacoef}{vector of p regression coeficients}
+//'\item{R2}{R-squared indicating the proportion of variation explained by the predictors}
+//'\item{prob}{vector of n success probabilities}
+//'\item{X_cor}{correlation between covariates}
+//'\item{X_var}{marginal variance of covariates}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'X <- filebacked.big.matrix(1000,5000,type="double",backingfile="X.bin",
+//'descriptorfile="X.desc",backingpath=tempdir())
+//'dat <- sim_logit_reg_big(X@address,q=10,X_var=1)
+//'res <- big_normal_logit_single_gibbs(dat$y,X@address)
+//'@export
+//[[Rcpp::export]]
+Rcpp::List sim_logit_reg_big(SEXP bigX, int q = 5,
+                             double X_cor = 0.5, double X_var = 10,
+                             double beta_size = 1, int seed = 2022,
+                             int block_size = 256, int n_threads = 0){
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat x((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	int n = x.n_rows;
+ 	int p = x.n_cols;
+ 	if(q>p)
+ 		Rcpp::stop("q must not be larger than the number of columns of bigX");
+ 	sim_fill_big(x, X_cor, X_var, seed, block_size, n_threads);
+
+ 	int qh = q/2;
+ 	arma::vec beta_nonzero = arma::repmat(vec({beta_size,-beta_size}),qh,1);
+ 	if(q>2*qh){
+ 		beta_nonzero = arma::join_cols(beta_nonzero,vec({beta_size}));
+ 	}
+
+ 	arma::vec mu = x.cols(0,q-1L)*beta_nonzero;
+ 	arma::vec prob;
+ 	link_apply<sigmoid_kernel>(mu, prob);
+ 	arma::uvec y;
+ 	y.zeros(n);
+ 	std::seed_seq seq{seed, -1};
+ 	std::mt19937_64 rng(seq);
+ 	std::uniform_real_distribution<double> runif(0.0, 1.0);
+ 	for(int i=0;i<n;i++){
+ 		if(runif(rng) < prob(i))
+ 			y(i) = 1;
+ 	}
+ 	double var_y = arma::var(arma::conv_to<arma::vec>::from(y));
+ 	double R2 = 0.0;
+ 	if(var_y>0)
+ 		R2 = arma::var(prob)/var_y;
+
+ 	return Rcpp::List::create(Named("y") = y,
+                            Named("betacoef") = arma::join_cols(beta_nonzero,arma::zeros<arma::vec>(p-q)),
+                            Named("R2") = R2,
+                            Named("prob") = prob,
+                            Named("X_cor") = X_cor,
+                            Named("X_var") = X_var);
+ }
+
+// beta_s_mean = d%ys/(d2 + 1/tau2) returns E(betacoef | tau2, sigma2_eps, y)
+// in the coordinates of V, so callers can average V*beta_s_mean as the
+// Rao-Blackwellized posterior mean at no extra cost
+ void one_step_update_big_p(arma::vec& betacoef, arma::vec& beta_s_mean, double& sigma2_eps, double& tau2,
                             double& b_tau, arma::vec& mu, arma::vec& ys,  arma::mat& V, arma::vec& d,arma::vec& d2,
                             arma::vec& y, arma::mat& X,
                             double A2, double a_sigma, double b_sigma,
                             int p, int n){
 
+ 	beta_s_mean = d%ys/(d2 + 1.0/tau2);
  	arma::vec alpha_1 = arma::randn<arma::vec>(p)*sqrt(sigma2_eps*tau2);
  	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sqrt(sigma2_eps);
  	arma::vec beta_s = (ys - d%(V.t()*alpha_1) - alpha_2)%d/(1.0 + tau2*d2);
@@ -404,7 +716,7 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
  }
 
 
- void one_step_update_big_n(arma::vec& betacoef, double& sigma2_eps, double& tau2,
+ void one_step_update_big_n(arma::vec& betacoef, arma::vec& beta_s_mean, double& sigma2_eps, double& tau2,
                             double& b_tau, arma::vec& mu, arma::vec& ys,  arma::mat& V, arma::vec& d,arma::vec& d2,
                             arma::vec& y, arma::mat& X,
                             double A2, double a_sigma, double b_sigma,
@@ -412,7 +724,8 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
 
  	double inv_tau2 = 1.0/tau2;
  	arma::vec alpha_1 = arma::randn<arma::vec>(p)%sqrt(sigma2_eps/(d2 + inv_tau2));
- 	arma::vec beta_s = d%ys/(d2 + inv_tau2) + alpha_1;
+ 	beta_s_mean = d%ys/(d2 + inv_tau2);
+ 	arma::vec beta_s = beta_s_mean + alpha_1;
  	betacoef = V*beta_s;
  	mu = d%beta_s;
  	arma::vec eps = ys - mu;
@@ -425,6 +738,58 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
  	sigma2_eps = 1.0/inv_sigma2_eps;
  }
 
+// log density of log(tau2) given b_tau with betacoef and sigma2_eps integrated
+// out, up to a constant; with X = UDV', ys = U'y and rss0 = ||y||^2 - ||ys||^2
+// each evaluation costs O(min(n,p))
+ double normal_lm_log_tau2_marginal(double log_tau2, double b_tau,
+                                    arma::vec& ys, arma::vec& d2, double rss0,
+                                    double a_sigma, double b_sigma, int n){
+ 	arma::vec s = 1.0 + exp(log_tau2)*d2;
+ 	double sum_eps2 = arma::accu(ys%ys/s) + rss0;
+ 	return -0.5*arma::accu(arma::log(s)) - (a_sigma+0.5*n)*log(b_sigma+0.5*sum_eps2)
+ 		- 0.5*log_tau2 - b_tau*exp(-log_tau2);
+ }
+
+// partially collapsed Gibbs step: tau2 by random walk Metropolis on log(tau2)
+// from its marginal, b_tau given tau2, sigma2_eps given tau2 with betacoef
+// integrated out, and finally betacoef from its full conditional
+ void one_step_update_collapsed(arma::vec& betacoef, arma::vec& beta_s_mean, double& sigma2_eps, double& tau2,
+                                double& b_tau, double log_tau2_step, int& n_accept,
+                                arma::vec& ys, arma::mat& V, arma::vec& d, arma::vec& d2,
+                                double rss0, double A2, double a_sigma, double b_sigma,
+                                int p, int n){
+
+ 	//update tau2
+ 	double log_tau2 = log(tau2);
+ 	double log_tau2_new = log_tau2 + log_tau2_step*arma::randn<double>();
+ 	double log_ratio = normal_lm_log_tau2_marginal(log_tau2_new, b_tau, ys, d2, rss0, a_sigma, b_sigma, n)
+ 		- normal_lm_log_tau2_marginal(log_tau2, b_tau, ys, d2, rss0, a_sigma, b_sigma, n);
+ 	if(log(arma::randu<double>())<log_ratio){
+ 		tau2 = exp(log_tau2_new);
+ 		n_accept++;
+ 	}
+ 	double inv_tau2 = 1.0/tau2;
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+
+ 	//update sigma2_eps
+ 	arma::vec s = 1.0 + tau2*d2;
+ 	double sum_eps2 = arma::accu(ys%ys/s) + rss0;
+ 	double inv_sigma2_eps = randg<double>(distr_param(a_sigma+0.5*n, 1.0/(b_sigma+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+
+ 	//update beta
+ 	beta_s_mean = d%ys/(d2 + inv_tau2);
+ 	if(p<n){
+ 		arma::vec alpha_1 = arma::randn<arma::vec>(p)%sqrt(sigma2_eps/(d2 + inv_tau2));
+ 		betacoef = V*(beta_s_mean + alpha_1);
+ 	} else{
+ 		arma::vec alpha_1 = arma::randn<arma::vec>(p)*sqrt(sigma2_eps*tau2);
+ 		arma::vec alpha_2 = arma::randn<arma::vec>(ys.n_elem)*sqrt(sigma2_eps);
+ 		arma::vec beta_s = (ys - d%(V.t()*alpha_1) - alpha_2)%d/s;
+ 		betacoef = alpha_1 + tau2*V*beta_s;
+ 	}
+ }
+
 //'@title Fast Bayesian linear regression with normal priors
 //'@param y vector of n outcome variables
 //'@param X n x p matrix of candidate predictors
@@ -434,6 +799,10 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
 //'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
 //'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param collapsed logical value; if true, tau2 is updated by a random walk Metropolis step on log(tau2)
+//'with betacoef and sigma2_eps integrated out, and sigma2_eps is drawn with betacoef integrated out.
+//'Both use the SVD of X, so each step costs O(min(n,p)) and the chains of tau2 and sigma2_eps mix much faster
+//'when p is large relative to the signal. The step size is tuned during burnin. Default value is false
 //'@return a list object consisting of two components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
@@ -443,12 +812,12 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
 //'\item{sigma2_eps}{posterior mean of the noise variance}
 //'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
 //'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\item{mcmc}{a list object of four components for MCMC samples}
 //'\describe{
-//'\item{mu}{a vector of posterior predictive mean of the n training sample}
-//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{sigma2_eps}{posterior mean of the noise variance}
-//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{tau2}{a vector of MCMC samples of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{tau2_accept}{acceptance rate of the tau2 updates after burnin; always 1 when collapsed is false}
 //'}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
@@ -464,13 +833,16 @@ Rcpp::List sim_multiclass_reg(int K = 5, int n = 100, int p = 20, int q = 5,
 //'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
 //'fast_normal_tab <- tab
 //'print(fast_normal_tab)
+//'res3 <- with(dat2,fast_normal_lm(y,X,collapsed=TRUE))
+//'print(c(conditional=acf(res2$mcmc$tau2,plot=FALSE)$acf[2],
+//'collapsed=acf(res3$mcmc$tau2,plot=FALSE)$acf[2]))
 //'@export
 //[[Rcpp::export]]
 Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
                            int mcmc_sample = 500,
                            int burnin = 500, int thinning = 1,
                            double a_sigma = 0.01, double b_sigma = 0.01,
-                           double A_tau = 10){
+                           double A_tau = 10, bool collapsed = false){
 
  	arma::wall_clock timer;
  	timer.tic();
@@ -491,6 +863,8 @@ Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
 
  	arma::vec betacoef;
  	arma::vec mu;
+ 	arma::vec beta_s_mean;
+ 	arma::vec beta_s_sum = arma::zeros<arma::vec>(d.n_elem);
 
 
  	int p = X.n_cols;
@@ -504,6 +878,7 @@ Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
  	double A2 = A_tau*A_tau;
  	double b_tau = A2;
  	double tau2 = b_tau;
+ 	double tau2_accept = 1.0;
 
  	if(U.n_rows>0){
 
@@ -514,35 +889,64 @@ Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
 
 
 
- 		if(p<n){
+ 		if(collapsed){
+ 			double rss0 = std::max(arma::accu(y%y) - arma::accu(ys%ys), 0.0);
+ 			double log_tau2_step = 1.0;
+ 			int n_accept = 0;
+ 			//tune the step size towards an acceptance rate of 0.44 every 50 iterations
+ 			for(int iter=0;iter<burnin;iter++){
+ 				one_step_update_collapsed(betacoef, beta_s_mean, sigma2_eps, tau2, b_tau,
+                              log_tau2_step, n_accept, ys, V, d, d2, rss0,
+                              A2, a_sigma, b_sigma, p, n);
+ 				if((iter+1)%50==0){
+ 					log_tau2_step *= exp(n_accept/50.0 - 0.44);
+ 					n_accept = 0;
+ 				}
+ 			}
+ 			n_accept = 0;
+ 			for(int iter=0;iter<mcmc_sample;iter++){
+ 				for(int j=0;j<thinning;j++){
+ 					one_step_update_collapsed(betacoef, beta_s_mean, sigma2_eps, tau2, b_tau,
+                               log_tau2_step, n_accept, ys, V, d, d2, rss0,
+                               A2, a_sigma, b_sigma, p, n);
+ 				}
+ 				betacoef_list.col(iter) = betacoef;
+ 				beta_s_sum += beta_s_mean;
+ 				sigma2_eps_list(iter) = sigma2_eps;
+ 				tau2_list(iter) = tau2;
+ 			}
+ 			tau2_accept = n_accept/(double)(mcmc_sample*thinning);
+ 		} else if(p<n){
  			for(int iter=0;iter<burnin;iter++){
- 				one_step_update_big_n(betacoef, sigma2_eps, tau2,
+ 				one_step_update_big_n(betacoef, beta_s_mean, sigma2_eps, tau2,
                            b_tau, mu, ys,  V,  d, d2, y,  X,
                            A2,  a_sigma,  b_sigma, p,  n);
  			}
  			for(int iter=0;iter<mcmc_sample;iter++){
  				for(int j=0;j<thinning;j++){
- 					one_step_update_big_n(betacoef, sigma2_eps, tau2,
+ 					one_step_update_big_n(betacoef, beta_s_mean, sigma2_eps, tau2,
                             b_tau, mu, ys,  V,  d, d2, y,  X,
                             A2,  a_sigma,  b_sigma, p,  n);
  				}
  				betacoef_list.col(iter) = betacoef;
+ 				beta_s_sum += beta_s_mean;
  				sigma2_eps_list(iter) = sigma2_eps;
  				tau2_list(iter) = tau2;
  			}
  		} else{
  			for(int iter=0;iter<burnin;iter++){
- 				one_step_update_big_p(betacoef, sigma2_eps, tau2,
+ 				one_step_update_big_p(betacoef, beta_s_mean, sigma2_eps, tau2,
                            b_tau, mu, ys,  V,  d, d2, y,  X,
                            A2,  a_sigma,  b_sigma, p,  n);
  			}
  			for(int iter=0;iter<mcmc_sample;iter++){
  				for(int j=0;j<thinning;j++){
- 					one_step_update_big_p(betacoef, sigma2_eps, tau2,
+ 					one_step_update_big_p(betacoef, beta_s_mean, sigma2_eps, tau2,
                             b_tau, mu, ys,  V,  d, d2, y,  X,
                             A2,  a_sigma,  b_sigma, p,  n);
  				}
  				betacoef_list.col(iter) = betacoef;
+ 				beta_s_sum += beta_s_mean;
  				sigma2_eps_list(iter) = sigma2_eps;
  				tau2_list(iter) = tau2;
  			}
@@ -550,7 +954,8 @@ Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
  		}
  	}
 
- 	betacoef = arma::mean(betacoef_list,1);
+ 	//Rao-Blackwellized posterior mean
+ 	betacoef = V*(beta_s_sum/mcmc_sample);
  	sigma2_eps = arma::mean(sigma2_eps_list);
  	tau2 = arma::mean(tau2_list);
 
@@ -560,7 +965,8 @@ Rcpp::List fast_normal_lm(arma::vec& y, arma::mat& X,
                                             Named("tau2") = tau2);
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("sigma2_eps") = sigma2_eps_list,
-                                       Named("tau2") = tau2_list);
+                                       Named("tau2") = tau2_list,
+                                       Named("tau2_accept") = tau2_accept);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
@@ -597,9 +1003,11 @@ arma::mat special_rmvnorm(int n, arma::vec& mu, arma::mat & Omega){
 	return X;
 }
 
-
+// delta_prob returns the conditional inclusion probability of each predictor
+// at the time its indicator is updated, for Rao-Blackwellized estimates
 void one_step_update_big_p_delta(arma::vec& betacoef,
                                  arma::vec& delta,
+                                 arma::vec& delta_prob,
                                  double& sigma2_eps,
                                  double& tau2,
                                  double& b_tau,
@@ -668,6 +1076,7 @@ void one_step_update_big_p_delta(arma::vec& betacoef,
 			eps_a = eps + X.col(non_zero_idx(k))*betacoef(non_zero_idx(k));
 			log_prob_diff = 0.5*(sum(eps_a%eps_a) - sum(eps%eps))/sigma2_eps;
 			prob = 1.0/(1.0 + exp(log_prob_diff));
+			delta_prob(non_zero_idx(k)) = 1.0 - prob;
 			if(arma::randu<double>() < prob){
 				delta(non_zero_idx(k)) = 0;
 				eps = eps_a;
@@ -680,6 +1089,7 @@ void one_step_update_big_p_delta(arma::vec& betacoef,
 			eps_a = eps - X.col(zero_idx(k))*betacoef(zero_idx(k));
 			log_prob_diff = 0.5*(sum(eps_a%eps_a) - sum(eps%eps))/sigma2_eps;
 			prob = 1.0/(1.0 + exp(log_prob_diff));
+			delta_prob(zero_idx(k)) = prob;
 			if(arma::randu<double>() < prob){
 				delta(zero_idx(k)) = 1;
 				eps = eps_a;
@@ -692,6 +1102,7 @@ void one_step_update_big_p_delta(arma::vec& betacoef,
 
 void one_step_update_big_n_delta(arma::vec& betacoef,
                                  arma::vec& delta,
+                                 arma::vec& delta_prob,
                                  double& sigma2_eps,
                                  double& tau2,
                                  double& b_tau,
@@ -765,6 +1176,7 @@ void one_step_update_big_n_delta(arma::vec& betacoef,
 			eps_a = eps + X.col(non_zero_idx(k))*betacoef(non_zero_idx(k));
 			log_prob_diff = 0.5*(sum(eps_a%eps_a) - sum(eps%eps))/sigma2_eps;
 			prob = 1.0/(1.0 + exp(log_prob_diff));
+			delta_prob(non_zero_idx(k)) = 1.0 - prob;
 			if(arma::randu<double>() < prob){
 				delta(non_zero_idx(k)) = 0;
 				eps = eps_a;
@@ -777,6 +1189,7 @@ void one_step_update_big_n_delta(arma::vec& betacoef,
 			eps_a = eps - X.col(zero_idx(k))*betacoef(zero_idx(k));
 			log_prob_diff = 0.5*(sum(eps_a%eps_a) - sum(eps%eps))/sigma2_eps;
 			prob = 1.0/(1.0 + exp(log_prob_diff));
+			delta_prob(zero_idx(k)) = prob;
 			if(arma::randu<double>() < prob){
 				delta(zero_idx(k)) = 1;
 				eps = eps_a;
@@ -861,6 +1274,8 @@ Rcpp::List fast_normal_lm_sel(arma::vec& y, arma::mat& X,
  	betacoef.zeros(p);
  	mu.zeros(n);
  	delta.zeros(p);
+ 	arma::vec delta_prob = arma::zeros<arma::vec>(p);
+ 	arma::vec delta_prob_sum = arma::zeros<arma::vec>(p);
 
  	betacoef_list.zeros(p,mcmc_sample);
  	delta_list.zeros(p,mcmc_sample);
@@ -879,7 +1294,7 @@ Rcpp::List fast_normal_lm_sel(arma::vec& y, arma::mat& X,
 
  		if(p<n){
  			for(int iter=0;iter<burnin;iter++){
- 				one_step_update_big_n_delta(betacoef, delta, sigma2_eps, tau2,
+ 				one_step_update_big_n_delta(betacoef, delta, delta_prob, sigma2_eps, tau2,
                            b_tau, mu, ys,  V,  d, d2, y,  X,
                            A2,  a_sigma,  b_sigma, p,  n);
 
@@ -887,28 +1302,30 @@ Rcpp::List fast_normal_lm_sel(arma::vec& y, arma::mat& X,
  			}
  			for(int iter=0;iter<mcmc_sample;iter++){
  				for(int j=0;j<thinning;j++){
- 					one_step_update_big_n_delta(betacoef, delta, sigma2_eps, tau2,
+ 					one_step_update_big_n_delta(betacoef, delta, delta_prob, sigma2_eps, tau2,
                             b_tau, mu, ys,  V,  d, d2, y,  X,
                             A2,  a_sigma,  b_sigma, p,  n);
  				}
  				delta_list.col(iter) = delta;
+ 				delta_prob_sum += delta_prob;
  				betacoef_list.col(iter) = betacoef;
  				sigma2_eps_list(iter) = sigma2_eps;
  				tau2_list(iter) = tau2;
  			}
  		} else{
  			for(int iter=0;iter<burnin;iter++){
- 				one_step_update_big_p_delta(betacoef, delta, sigma2_eps, tau2,
+ 				one_step_update_big_p_delta(betacoef, delta, delta_prob, sigma2_eps, tau2,
                            b_tau, mu, ys,  V,  d, d2, y,  X,
                            A2,  a_sigma,  b_sigma, p,  n);
  			}
  			for(int iter=0;iter<mcmc_sample;iter++){
  				for(int j=0;j<thinning;j++){
- 					one_step_update_big_p_delta(betacoef, delta, sigma2_eps, tau2,
+ 					one_step_update_big_p_delta(betacoef, delta, delta_prob, sigma2_eps, tau2,
                             b_tau, mu, ys,  V,  d, d2, y,  X,
                             A2,  a_sigma,  b_sigma, p,  n);
  				}
  				delta_list.col(iter) = delta;
+ 				delta_prob_sum += delta_prob;
  				betacoef_list.col(iter) = betacoef;
  				sigma2_eps_list(iter) = sigma2_eps;
  				tau2_list(iter) = tau2;
@@ -917,7 +1334,8 @@ Rcpp::List fast_normal_lm_sel(arma::vec& y, arma::mat& X,
  		}
  	}
 
- 	delta = arma::mean(delta_list,1);
+ 	//Rao-Blackwellized posterior inclusion probabilities
+ 	delta = delta_prob_sum/mcmc_sample;
  	arma::uvec non_zero_idx = arma::find(delta>sel_thres);
  	betacoef.zeros(p);
 
@@ -1224,6 +1642,202 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	 }
 
 
+// Gibbs sampler of fast_normal_multi_lm for one block of outcomes, run in
+// the rotated coordinates gamma = V'beta of the thin SVD X = U D V'. The
+// component of beta orthogonal to V is a priori and a posteriori
+// N(0, sigma2_eps*tau2*I), so only its squared norm enters the updates and
+// it is drawn as a scaled chi-square with p - r degrees of freedom. The
+// chain uses its own generator, so blocks can run on different threads
+void normal_multi_block_chain(arma::mat& gamma_mean, arma::vec& sigma2_eps_mean,
+                              arma::vec& tau2_mean, const arma::mat& ys,
+                              const arma::vec& rss0, const arma::vec& d,
+                              const arma::vec& d2, int p, int n,
+                              int mcmc_sample, int burnin, int thinning,
+                              double A2, double a_sigma, double b_sigma,
+                              std::mt19937_64& rng){
+	int r = ys.n_rows;
+	int q = ys.n_cols;
+	std::normal_distribution<double> rnorm(0.0, 1.0);
+	std::gamma_distribution<double> rgamma_1(1.0, 1.0);
+	std::gamma_distribution<double> rgamma_tau((1.0+p)/2.0, 1.0);
+	std::gamma_distribution<double> rgamma_sigma(a_sigma+(p+n)/2.0, 1.0);
+	std::gamma_distribution<double> rgamma_perp(p>r ? (p-r)/2.0 : 1.0, 1.0);
+
+	gamma_mean.zeros(r,q);
+	sigma2_eps_mean.zeros(q);
+	tau2_mean.zeros(q);
+	arma::vec gamma(r);
+	arma::vec dys(r);
+	arma::vec z(r);
+	int total_iter = burnin+thinning*mcmc_sample;
+	for(int i=0;i<q;i++){
+		double sigma2_eps = 1.0;
+		if(a_sigma!=0.0)
+			sigma2_eps = b_sigma/a_sigma;
+		double tau2 = A2;
+		double b_tau = A2;
+		dys = d%ys.col(i);
+		for(int iter=0;iter<total_iter;iter++){
+			//update beta
+			double inv_tau2 = 1.0/tau2;
+			for(int k=0;k<r;k++){
+				double prec = d2(k) + inv_tau2;
+				gamma(k) = dys(k)/prec + sqrt(sigma2_eps/prec)*rnorm(rng);
+			}
+			double sum_beta2 = arma::accu(gamma%gamma);
+			if(p>r)
+				sum_beta2 += 2.0*sigma2_eps*tau2*rgamma_perp(rng);
+			z = ys.col(i) - d%gamma;
+			double sum_eps2 = arma::accu(z%z) + rss0(i);
+
+			//update tau2, sigma2_eps and b_tau
+			inv_tau2 = rgamma_tau(rng)/(b_tau+0.5*sum_beta2/sigma2_eps);
+			b_tau = rgamma_1(rng)/(1.0/A2 + inv_tau2);
+			tau2 = 1.0/inv_tau2;
+			sigma2_eps = (b_sigma+0.5*sum_beta2*inv_tau2+0.5*sum_eps2)/rgamma_sigma(rng);
+
+			if(iter>=burnin && (iter-burnin+1)%thinning==0){
+				gamma_mean.col(i) += gamma;
+				sigma2_eps_mean(i) += sigma2_eps;
+				tau2_mean(i) += tau2;
+			}
+		}
+	}
+	gamma_mean /= mcmc_sample;
+	sigma2_eps_mean /= mcmc_sample;
+	tau2_mean /= mcmc_sample;
+}
+
+//'@title Fast Bayesian linear regression with normal priors for a big.matrix of outcome variables
+//'@param bigY address of an n x q big.matrix of type double holding q outcome
+//'variables, e.g. a filebacked.big.matrix
+//'@param X n x p matrix of p candidate predictors with n observations
+//'@param bigB address of a p x q big.matrix of type double, which is overwritten
+//'by the posterior mean of the regression coefficients
+//'@param block_size number of outcome variables read and fitted at a time
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param seed seed of the random number streams; the output does not depend on n_threads
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of two components for posterior mean statistics;
+//'the posterior mean of the regression coefficients is written to bigB}
+//'\describe{
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance of each outcome}
+//'\item{tau2}{a vector of posterior mean of the ratio between prior regression coefficient variances and the noise variance of each outcome}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2024)
+//'dat <- sim_linear_reg_multi(n=500,p=50,m=2000,X_cor=0.9,q=6)
+//'Y <- as.big.matrix(dat$y,type="double")
+//'B <- big.matrix(50,2000,type="double")
+//'res <- big_normal_multi_lm(Y@address,dat$X,B@address)
+//'print(comp_sparse_SSE(dat$betacoef,B[,]))
+//'@export
+//[[Rcpp::export]]
+Rcpp::List big_normal_multi_lm(SEXP bigY, arma::mat& X, SEXP bigB,
+                               int block_size = 1000,
+                               int mcmc_sample = 500,
+                               int burnin = 500, int thinning = 1,
+                               double a_sigma = 0.01, double b_sigma = 0.01,
+                               double A_tau = 10, int seed = 2022,
+                               int n_threads = 0){
+
+	arma::wall_clock timer;
+	timer.tic();
+	Rcpp::XPtr<BigMatrix> xpY(bigY);
+	Rcpp::XPtr<BigMatrix> xpB(bigB);
+	check_big_double(xpY, "bigY");
+	check_big_double(xpB, "bigB");
+	int p = X.n_cols;
+	int n = X.n_rows;
+	int q = xpY->ncol();
+	if(xpY->nrow()!=n)
+		Rcpp::stop("bigY and X must have the same number of rows");
+	if(xpB->nrow()!=p || xpB->ncol()!=q)
+		Rcpp::stop("bigB must be a p x q big.matrix");
+	if(block_size<1)
+		block_size = 1;
+
+	arma::vec d;
+	arma::mat U;
+	arma::mat V;
+	arma::svd_econ(U,d,V,X);
+	arma::vec d2 = d%d;
+	double A2 = A_tau*A_tau;
+
+	double* y_ptr = (double*)xpY->matrix();
+	double* b_ptr = (double*)xpB->matrix();
+	arma::vec sigma2_eps(q);
+	arma::vec tau2(q);
+	int num_blocks = (q + block_size - 1)/block_size;
+
+	#pragma omp parallel for schedule(dynamic) num_threads(get_num_threads(n_threads))
+	for(int b=0;b<num_blocks;b++){
+		int j_begin = b*block_size;
+		int j_end = std::min(q, (b+1)*block_size);
+		const arma::mat y_b(y_ptr+(std::size_t)j_begin*n, n, j_end-j_begin, false, true);
+		arma::mat ys = U.t()*y_b;
+		arma::vec rss0 = arma::sum(y_b%y_b,0).t() - arma::sum(ys%ys,0).t();
+		rss0.elem(arma::find(rss0<0)).zeros();
+
+		std::seed_seq seq{seed, b};
+		std::mt19937_64 rng(seq);
+		arma::mat gamma_mean;
+		arma::vec sigma2_eps_b;
+		arma::vec tau2_b;
+		normal_multi_block_chain(gamma_mean, sigma2_eps_b, tau2_b, ys, rss0, d, d2,
+                           p, n, mcmc_sample, burnin, thinning,
+                           A2, a_sigma, b_sigma, rng);
+
+		arma::mat betacoef_b(b_ptr+(std::size_t)j_begin*p, p, j_end-j_begin, false, true);
+		betacoef_b = V*gamma_mean;
+		sigma2_eps.subvec(j_begin,j_end-1) = sigma2_eps_b;
+		tau2.subvec(j_begin,j_end-1) = tau2_b;
+	}
+
+	Rcpp::List post_mean = Rcpp::List::create(Named("sigma2_eps") = sigma2_eps,
+                                           Named("tau2") = tau2);
+	double elapsed = timer.toc();
+	return Rcpp::List::create(Named("post_mean") = post_mean,
+                           Named("elapsed") = elapsed);
+}
+
+arma::vec rand_left_trucnorm(int n, double mu, double sigma,
+                             double lower, double ratio);
+
+// ancillarity-sufficiency interweaving (Yu and Meng, 2011) for the global
+// scale tau: after the centred update, tau is redrawn given the non-centred
+// coefficients gamma = betacoef/tau. With eta = X*betacoef, the likelihood of
+// tau is normal with mean c/a and variance sigma2/a, where a = sum(w*eta^2)/tau2
+// and c = sum(z*eta)/tau. tau is proposed from that normal truncated at zero
+// and accepted by the ratio of its prior tau2 ~ IG(1/2, b_tau); betacoef and
+// eta are rescaled on acceptance. The caller passes sum(w*eta^2) and sum(z*eta)
+ void asis_update_tau2(arma::vec& betacoef, arma::vec& eta, double& tau2, double& b_tau,
+                       double w_eta2, double z_eta, double sigma2, double A2){
+ 	double tau = sqrt(tau2);
+ 	double a = w_eta2/tau2;
+ 	if(a>0){
+ 		double c = z_eta/tau;
+ 		double tau_new = rand_left_trucnorm(1, c/a, sqrt(sigma2/a), 0.0, 1.0)(0);
+ 		double log_ratio = -2.0*log(tau_new/tau) - b_tau*(1.0/(tau_new*tau_new) - 1.0/tau2);
+ 		if(tau_new>0 && log(arma::randu<double>())<log_ratio){
+ 			betacoef *= tau_new/tau;
+ 			eta *= tau_new/tau;
+ 			tau2 = tau_new*tau_new;
+ 		}
+ 	}
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + 1.0/tau2)));
+ }
+
  void one_step_logit_normal_big_n(arma::vec& betacoef, double& tau2, double& b_tau,
                                   arma::vec& omega, arma::vec& mu,
                                   arma::vec& y_s, arma::vec& Xty_s, arma::mat& X,
@@ -1300,6 +1914,9 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param asis logical value; if true, each iteration is followed by an ancillarity-sufficiency
+//'interweaving step that redraws the global scale given the non-centred coefficients betacoef/sqrt(tau2).
+//'It costs O(n+p) per iteration and much improves the mixing of tau2 when the signal is weak. Default value is false
 //'@return a list object consisting of three components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
@@ -1339,7 +1956,7 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	 Rcpp::List fast_normal_logit(arma::vec& y, arma::mat& X,
                                 int mcmc_sample = 500,
                                 int burnin = 500, int thinning = 1,
-                                double A_tau = 1){
+                                double A_tau = 1, bool asis = false){
 
  	 	arma::wall_clock timer;
  	 	timer.tic();
@@ -1365,13 +1982,11 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
 
  	 	arma::mat betacoef_list;
- 	 	arma::mat mu_list;
  	 	arma::vec tau2_list;
  	 	arma::vec mean_omega;
  	 	mean_omega.zeros(n);
 
  	 	betacoef_list.zeros(p,mcmc_sample);
- 	 	mu_list.zeros(n,mcmc_sample);
  	 	tau2_list.zeros(mcmc_sample);
 
 
@@ -1382,6 +1997,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                                   omega, mu,
                                   y_s, Xty_s,  X,
                                   A2_tau, p, n, pgdraw);
+ 	 			if(asis)
+ 	 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
  	 		}
  	 		for(int iter=0;iter<mcmc_sample;iter++){
  	 			for(int j=0;j<thinning;j++){
@@ -1389,6 +2006,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                                    omega, mu,
                                    y_s, Xty_s,  X,
                                    A2_tau, p, n, pgdraw);
+ 	 				if(asis)
+ 	 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
  	 			}
  	 			betacoef_list.col(iter) = betacoef;
  	 			tau2_list(iter) = tau2;
@@ -1401,6 +2020,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                                   omega, mu,
                                   y_s, XXt,  X,
                                   A2_tau, p, n, pgdraw);
+ 	 			if(asis)
+ 	 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
  	 		}
  	 		for(int iter=0;iter<mcmc_sample;iter++){
  	 			for(int j=0;j<thinning;j++){
@@ -1408,6 +2029,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                                    omega, mu,
                                    y_s, XXt,  X,
                                    A2_tau, p, n, pgdraw);
+ 	 				if(asis)
+ 	 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
  	 			}
  	 			betacoef_list.col(iter) = betacoef;
  	 			tau2_list(iter) = tau2;
@@ -1421,11 +2044,12 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	 	mean_omega /= mcmc_sample;
  	 	mu =  X*betacoef;
 
+ 	 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
                                               Named("tau2") = tau2,
                                               Named("omega") = mean_omega,
-                                              Named("mu") = mu,
-                                              Named("prob") = 1.0/(1.0+exp(-mu)));
+                                              Named("mu") = mu_r,
+                                              Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                          Named("tau2") = tau2_list);
 
@@ -1435,14 +2059,24 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                               Named("elapsed") = elapsed);
  	 }
 
+Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X,
+                                         int max_iter, double tol, double A,
+                                         double in_E_inv_tau_sq,
+                                         Rcpp::Nullable<Rcpp::NumericVector> in_E_omega,
+                                         Rcpp::Nullable<Rcpp::NumericVector> in_E_beta);
+
 //'@title Fast Bayesian logistic regression with normal priors by single
 //'variable update Gibbs sampler
 //'@param y vector of n binrary outcome variables taking values 0 or 1
 //'@param X n x p matrix of candidate predictors
 //'@param mcmc_sample number of MCMC iterations saved
-//'@param burnin number of iterations before start to save
+//'@param burnin number of iterations before start to save; a negative value
+//'means 500, or 100 when init is "mfvb"
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param verbose print the training error every verbose iterations; 0 means no printing
+//'@param init "zero" to start from zero coefficients or "mfvb" to start from the
+//'posterior means of \link{fast_mfvb_normal_logit_single}
 //'@return a list object consisting of three components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
@@ -1466,7 +2100,7 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'res1 <- with(dat1,fast_normal_logit_single_gibbs(y,X))
 //'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
 //'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res2 <- with(dat2,fast_normal_logit_single_gibbs(y,X,burnin=5000))
+//'res2 <- with(dat2,fast_normal_logit_single_gibbs(y,X,init="mfvb"))
 //'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
 //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
 //'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
@@ -1481,9 +2115,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //[[Rcpp::export]]
  Rcpp::List fast_normal_logit_single_gibbs(arma::vec& y, arma::mat& X,
                                            int mcmc_sample = 500,
-                                           int burnin = 500, int thinning = 1,
+                                           int burnin = -1, int thinning = 1,
                                            double A_tau = 1,
-                                           int verbose = 0){
+                                           int verbose = 0,
+                                           std::string init = "zero"){
 
  	arma::wall_clock timer;
  	timer.tic();
@@ -1491,6 +2126,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 
  	int p = X.n_cols;
  	int n = X.n_rows;
+ 	if(init!="zero" && init!="mfvb")
+ 		Rcpp::stop("init must be \"zero\" or \"mfvb\"");
+ 	if(burnin<0)
+ 		burnin = init=="mfvb" ? 100 : 500;
 
  	double A2_tau = A_tau*A_tau;
  	double b_tau = A2_tau;
@@ -1507,21 +2146,35 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	arma::vec mu;
  	mu.zeros(n);
  	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
+ 	if(init=="mfvb"){
+ 		//start from the mean field variational Bayes fit
+ 		Rcpp::List fit = fast_mfvb_normal_logit_single(y, X, 5000, 1e-05, A_tau, 1,
+                                                  R_NilValue, R_NilValue);
+ 		Rcpp::List fit_mean = fit["post_mean"];
+ 		betacoef = Rcpp::as<arma::vec>(fit_mean["betacoef"]);
+ 		omega = Rcpp::as<arma::vec>(fit_mean["omega"]);
+ 		inv_tau2 = Rcpp::as<double>(fit_mean["inv_tau_sq"]);
+ 		mu = X*betacoef;
+ 	}
 
  	arma::mat betacoef_list;
- 	arma::mat mu_list;
  	arma::vec tau2_list;
  	arma::vec mean_omega;
  	double mean_tau2;
  	mean_omega.zeros(n);
 
  	betacoef_list.zeros(p,mcmc_sample);
- 	mu_list.zeros(n,mcmc_sample);
+ 	arma::vec betacoef_rb = arma::zeros<arma::vec>(p);
+ 	int num_rb = 0;
  	tau2_list.zeros(mcmc_sample);
 
  	int total_iter = burnin + mcmc_sample*thinning;
  	for(int iter=0;iter<total_iter;iter++){
- 		//update beta
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter > burnin && (iter-burnin)%thinning==0;
+ 		if(rb_iter)
+ 			num_rb++;
  		for(int k=0;k<p;k++){
  			//compute posterior variance
  			double beta_var = arma::accu(omega%X2.col(k));
@@ -1536,6 +2189,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  			//compute posterior mean
  			double beta_mean = arma::accu(mu_minus_k%X.col(k));
  			beta_mean *= beta_var;
+ 			if(rb_iter)
+ 				betacoef_rb(k) += beta_mean;
  			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
  			//update mu
  			mu += X.col(k)*betacoef(k);
@@ -1555,7 +2210,6 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  			if((iter-burnin)%thinning==0){
  				int mcmc_iter = (iter-burnin)/thinning;
  				betacoef_list.col(mcmc_iter) = betacoef;
- 				mu_list.col(mcmc_iter) = mu;
  				tau2_list(mcmc_iter) = 1.0/inv_tau2;
  			}
  		}
@@ -1573,16 +2227,17 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	}
 
 
- 	betacoef = arma::mean(betacoef_list,1);
+ 	betacoef = betacoef_rb/std::max(num_rb,1);
  	mean_tau2 = arma::mean(tau2_list);
  	mean_omega /= mcmc_sample;
  	mu =  X*betacoef;
 
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
                                             Named("tau2") = mean_tau2,
                                             Named("omega") = mean_omega,
-                                            Named("mu") = mu,
-                                            Named("prob") = 1.0/(1.0+exp(-mu)));
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("tau2") = tau2_list);
 
@@ -1592,77 +2247,137 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
-//'@title Scalable Bayesian logistic regression with normal priors by single
-//'variable update Gibbs sampler
+// panels of at most block_size columns for the blocked Gibbs sampler: each
+// panel is seeded by the first unassigned column and filled with the most
+// correlated of the next window unassigned columns, so strongly correlated
+// neighbouring predictors are updated jointly. Only the correlations of each
+// seed with its window are computed, which costs O(n*p*window/block_size)
+// time and O(window) memory instead of forming the p x p correlation matrix
+std::vector<arma::uvec> correlation_panels(arma::mat& X, int block_size, int window){
+	int p = X.n_cols;
+	arma::rowvec X_mean = arma::mean(X,0);
+	arma::vec X_norm(p);
+	for(int k=0;k<p;k++)
+		X_norm(k) = arma::norm(X.col(k) - X_mean(k));
+	//doubly linked list of the unassigned columns in their original order
+	std::vector<int> next(p);
+	std::vector<int> prev(p);
+	for(int k=0;k<p;k++){
+		next[k] = k+1;
+		prev[k] = k-1;
+	}
+	int head = 0;
+	arma::uvec cand(window);
+	arma::vec c(window);
+	std::vector<arma::uvec> panels;
+	while(head<p){
+		int j = head;
+		arma::vec x_j = X.col(j) - X_mean(j);
+		int m = 0;
+		for(int k=next[j];k<p && m<window;k=next[k]){
+			double s = X_norm(j)*X_norm(k);
+			cand(m) = k;
+			c(m) = s>0 ? std::fabs(arma::dot(X.col(k),x_j))/s : 0.0;
+			m++;
+		}
+		int b = std::min(block_size-1, m);
+		arma::uvec panel(b+1);
+		panel(0) = j;
+		if(b>0){
+			arma::uvec order = arma::sort_index(c.head(m),"descend");
+			arma::uvec cand_m = cand.head(m);
+			panel.tail(b) = cand_m.elem(order.head(b));
+		}
+		for(arma::uword i=0;i<panel.n_elem;i++){
+			int k = panel(i);
+			if(prev[k]>=0)
+				next[prev[k]] = next[k];
+			else
+				head = next[k];
+			if(next[k]<p)
+				prev[next[k]] = prev[k];
+		}
+		panels.push_back(arma::sort(panel));
+	}
+	return panels;
+}
+
+//'@title Fast Bayesian logistic regression with normal priors by blocked
+//'Gibbs sampler over panels of correlated columns
 //'@param y vector of n binrary outcome variables taking values 0 or 1
 //'@param X n x p matrix of candidate predictors
+//'@param block_size maximum number of columns updated jointly in one panel
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
-//'@return a list object consisting of three components
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@param window number of unassigned columns following the seed of a panel
+//'that are candidates for the panel; 0 means 4*block_size
+//'@return a list object consisting of four components
 //'\describe{
-//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
 //'\describe{
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
 //'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{omega}{a vector of posterior mean of the Polya-Gamma latent variables}
 //'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
 //'\item{prob}{a vector of posterior predictive probability of the n training sample}
 //'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\item{mcmc}{a list object of two components for MCMC samples}
 //'\describe{
-//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients if mcmc_output is true. Each column is one MCMC sample}
 //'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
 //'}
+//'\item{panel}{a vector of p panel labels of the predictors}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res1 <- with(dat1,scalable_normal_logit_single_gibbs(y,X))
-//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
-//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res2 <- with(dat2,scalable_normal_logit_single_gibbs(y,X,burnin=5000))
-//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
-//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
-//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
-//'normal_logit_tab <- tab
-//'print(normal_logit_tab)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res1 <- with(dat,fast_normal_logit_single_gibbs(y,X))
+//'res2 <- with(dat,fast_normal_logit_block_gibbs(y,X,block_size=20))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("single site","blocked")
+//'print(tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List scalable_normal_logit_single_gibbs(arma::vec& y, SEXP bigX,
-                                               arma::uvec& rowidx,
-                                               int mcmc_sample = 500,
-                                               int burnin = 500, int thinning = 1,
-                                               double A_tau = 1,
-                                               int verbose = 0){
-
-
-
- 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ Rcpp::List fast_normal_logit_block_gibbs(arma::vec& y, arma::mat& X,
+                                          int block_size = 32,
+                                          int mcmc_sample = 500,
+                                          int burnin = 500, int thinning = 1,
+                                          double A_tau = 1,
+                                          bool mcmc_output = true,
+                                          int window = 0){
 
  	arma::wall_clock timer;
  	timer.tic();
+ 	if(block_size<1)
+ 		Rcpp::stop("block_size must be positive");
+ 	if(window<=0)
+ 		window = 4*block_size;
 
-
- 	long p = xpMat->ncol();
- 	long n = xpMat->nrow();
-
- 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
-
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
 
  	double A2_tau = A_tau*A_tau;
  	double b_tau = A2_tau;
  	double inv_tau2 = 1.0/b_tau;
 
  	arma::vec y_s = y - 0.5;
- 	arma::mat X2 = X%X;
+
+ 	//contiguous copies of the panels so that the panel products are BLAS-3
+ 	std::vector<arma::uvec> panels = correlation_panels(X, block_size, window);
+ 	int n_panels = panels.size();
+ 	std::vector<arma::mat> X_panels(n_panels);
+ 	arma::uvec panel_label(p);
+ 	for(int g=0;g<n_panels;g++){
+ 		X_panels[g] = X.cols(panels[g]);
+ 		panel_label.elem(panels[g]).fill(g+1);
+ 	}
 
  	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
  	Rcpp::Function pgdraw = pkg["pgdraw"];
@@ -1674,36 +2389,41 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
 
  	arma::mat betacoef_list;
- 	arma::mat mu_list;
  	arma::vec tau2_list;
  	arma::vec mean_omega;
- 	double mean_tau2;
  	mean_omega.zeros(n);
-
- 	betacoef_list.zeros(p,mcmc_sample);
- 	mu_list.zeros(n,mcmc_sample);
+ 	if(mcmc_output)
+ 		betacoef_list.zeros(p,mcmc_sample);
+ 	arma::vec betacoef_mean = arma::zeros<arma::vec>(p);
  	tau2_list.zeros(mcmc_sample);
 
  	int total_iter = burnin + mcmc_sample*thinning;
  	for(int iter=0;iter<total_iter;iter++){
- 		//update beta
- 		for(int k=0;k<p;k++){
- 			//compute posterior variance
- 			double beta_var = arma::accu(omega%X2.col(k));
- 			beta_var += inv_tau2;
- 			beta_var = 1.0/beta_var;
- 			mu -= X.col(k)*betacoef(k);
- 			vec mu_minus_k = mu;
- 			//vec mu_minus_k = mu - X.col(k)*betacoef(k);
- 			//mu = mu_minus_k;
- 			mu_minus_k %= -omega;
- 			mu_minus_k += y_s;
- 			//compute posterior mean
- 			double beta_mean = arma::accu(mu_minus_k%X.col(k));
- 			beta_mean *= beta_var;
- 			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
+ 		//update beta panel by panel; on saved iterations the conditional
+ 		//means are accumulated for the Rao-Blackwellized posterior mean
+ 		bool save_iter = iter>=burnin && (iter-burnin+1)%thinning==0;
+ 		for(int g=0;g<n_panels;g++){
+ 			const arma::uvec& idx = panels[g];
+ 			const arma::mat& X_g = X_panels[g];
+ 			arma::vec beta_old = betacoef.elem(idx);
+ 			arma::mat OmegaX_g = X_g;
+ 			OmegaX_g.each_col() %= omega;
+ 			arma::mat P = X_g.t()*OmegaX_g;
+ 			P.diag() += inv_tau2;
+ 			arma::mat R;
+ 			if(!arma::chol(R,P))
+ 				Rcpp::stop("Cholesky decomposition failed for panel %d", g+1);
+ 			//X_g'(y_s - omega%mu_minus_g) with mu_minus_g = mu - X_g*beta_old
+ 			arma::vec b = X_g.t()*y_s - OmegaX_g.t()*mu + P*beta_old;
+ 			b -= inv_tau2*beta_old;
+ 			arma::vec z = arma::solve(arma::trimatl(R.t()),b,solve_opts::fast);
+ 			arma::vec beta_mean = arma::solve(arma::trimatu(R),z,solve_opts::fast);
+ 			if(save_iter)
+ 				betacoef_mean.elem(idx) += beta_mean;
+ 			arma::vec beta_new = beta_mean + arma::solve(arma::trimatu(R),arma::randn<arma::vec>(idx.n_elem),solve_opts::fast);
+ 			betacoef.elem(idx) = beta_new;
  			//update mu
- 			mu += X.col(k)*betacoef(k);
+ 			mu += X_g*(beta_new - beta_old);
  		}
 
  		//update omega
@@ -1714,206 +2434,391 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
  		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
 
- 		//update b
-
- 		if(iter > burnin){
- 			if((iter-burnin)%thinning==0){
- 				int mcmc_iter = (iter-burnin)/thinning;
+ 		if(save_iter){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			if(mcmc_output)
  				betacoef_list.col(mcmc_iter) = betacoef;
- 				mu_list.col(mcmc_iter) = mu;
- 				tau2_list(mcmc_iter) = 1.0/inv_tau2;
- 			}
- 		}
-
- 		if(verbose>0){
- 			if((iter+1)%verbose==0){
- 				vec prob = 1/(1+exp(-mu));
- 				uvec yfit = (prob>0.5);
- 				double err = arma::mean(abs(y-yfit));
- 				std::cout << iter+1 << " err = " << err <<
- 					std::endl;
- 			}
+ 			tau2_list(mcmc_iter) = 1.0/inv_tau2;
+ 			mean_omega += omega;
  		}
-
  	}
 
-
- 	betacoef = arma::mean(betacoef_list,1);
- 	mean_tau2 = arma::mean(tau2_list);
+ 	betacoef = betacoef_mean/mcmc_sample;
  	mean_omega /= mcmc_sample;
- 	mu =  X*betacoef;
+ 	mu = X*betacoef;
 
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
-                                            Named("tau2") = mean_tau2,
+                                            Named("tau2") = arma::mean(tau2_list),
                                             Named("omega") = mean_omega,
-                                            Named("mu") = mu,
-                                            Named("prob") = 1.0/(1.0+exp(-mu)));
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("tau2") = tau2_list);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
                             Named("mcmc") = mcmc,
+                            Named("panel") = panel_label,
                             Named("elapsed") = elapsed);
  }
 
-//'@title Bayesian logistic regression with normal priors by single
-//'variable update Gibbs sampler when predictor matrix is a big.matrix
-//'@param y vector of n binary outcome variables taking values 0 or 1
-//'@param X n x p sparse matrix of candidate predictors
+//'@title Fast Bayesian multi-label logistic regression with normal priors by single
+//'variable update Gibbs sampler
+//'@param y n x L matrix of L binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors shared by all labels
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param mcmc_output logical value; if false only posterior means are returned. Default value is true
+//'@param n_threads number of OpenMP threads for the updates across labels; 0 means all available threads
+//'@param numa_interleave logical value; if true X and its squares are copied by
+//'the OpenMP threads, so that with OMP_PROC_BIND=spread their pages are spread
+//'over the NUMA nodes of the threads. Default value is false
 //'@return a list object consisting of three components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
 //'\describe{
+//'\item{betacoef}{a p x L matrix of posterior mean of regression coeficients}
+//'\item{tau2}{a vector of posterior mean of the ratio between prior regression coefficient variances and the noise variance of each label}
+//'\item{mu}{an n x L matrix of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{an n x L matrix of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of two components for MCMC samples, returned when mcmc_output is true}
+//'\describe{
+//'\item{betacoef}{an array of MCMC samples of p by L regression coeficients}
+//'\item{tau2}{an L x mcmc_sample matrix of MCMC samples of global shrinkage parameters}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'y2 <- rbinom(2000,1,1/(1+exp(-dat$X[,11:15]%*%rep(1,5))))
+//'res <- with(dat,multilabel_normal_logit_single_gibbs(cbind(y,y2),X))
+//'res1 <- with(dat,fast_normal_logit_single_gibbs(y,X))
+//'print(cbind(res$post_mean$betacoef[1:20,1],res1$post_mean$betacoef[1:20]))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List multilabel_normal_logit_single_gibbs(arma::mat& y, arma::mat& X,
+                                                 int mcmc_sample = 500,
+                                                 int burnin = 500, int thinning = 1,
+                                                 double A_tau = 1,
+                                                 bool mcmc_output = true,
+                                                 int n_threads = 0,
+                                                 bool numa_interleave = false){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	int L = y.n_cols;
+ 	if((int)y.n_rows != n)
+ 		Rcpp::stop("y and X must have the same number of rows");
+
+ 	double A2_tau = A_tau*A_tau;
+ 	arma::vec b_tau = arma::ones<arma::vec>(L)*A2_tau;
+ 	arma::vec inv_tau2 = 1.0/b_tau;
+
+ 	arma::mat y_s = y - 0.5;
+ 	arma::mat X_local;
+ 	if(numa_interleave)
+ 		first_touch_copy(X_local, X, n_threads);
+ 	const arma::mat& X_w = numa_interleave ? X_local : X;
+ 	arma::mat X2;
+ 	first_touch_copy(X2, X, numa_interleave ? n_threads : 1);
+ 	X2 %= X2;
+
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
+ 	Rcpp::Function pgdraw = pkg["pgdraw"];
+ 	Rcpp::NumericVector zeros(n*L,0.0);
+ 	arma::mat betacoef;
+ 	betacoef.zeros(p,L);
+ 	arma::mat mu;
+ 	mu.zeros(n,L);
+ 	arma::mat omega(Rcpp::as<arma::vec>(pgdraw(1.0,zeros)).memptr(),n,L);
+
+ 	arma::cube betacoef_list;
+ 	arma::mat tau2_list;
+ 	arma::mat betacoef_mean = arma::zeros<arma::mat>(p,L);
+ 	arma::vec tau2_mean = arma::zeros<arma::vec>(L);
+ 	if(mcmc_output){
+ 		betacoef_list.zeros(p,L,mcmc_sample);
+ 		tau2_list.zeros(L,mcmc_sample);
+ 	}
+
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update beta: one parallel region per sweep, in which every thread owns
+ 		//a fixed range of labels and runs through all coordinates, so X.col(k)
+ 		//is shared by the labels of a thread while it is in cache; the normal
+ 		//draws of the sweep are made beforehand from R's generator. On saved
+ 		//iterations the conditional means are accumulated for the
+ 		//Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter>=burnin && (iter-burnin+1)%thinning==0;
+ 		arma::mat z = arma::randn<arma::mat>(p,L);
+ 		#pragma omp parallel if(L>1) num_threads(get_num_threads(n_threads))
+ 		{
+ 			int num_threads = 1;
+ 			int thread_id = 0;
+#ifdef _OPENMP
+ 			num_threads = omp_get_num_threads();
+ 			thread_id = omp_get_thread_num();
+#endif
+ 			int l_begin = (int)(((long)L*thread_id)/num_threads);
+ 			int l_end = (int)(((long)L*(thread_id+1))/num_threads);
+ 			for(int k=0;k<p;k++){
+ 				const double* x_k = X_w.colptr(k);
+ 				const double* x2_k = X2.colptr(k);
+ 				for(int l=l_begin;l<l_end;l++){
+ 					double* mu_l = mu.colptr(l);
+ 					const double* omega_l = omega.colptr(l);
+ 					const double* y_s_l = y_s.colptr(l);
+ 					double beta_old = betacoef(k,l);
+ 					double beta_prec = inv_tau2(l);
+ 					double beta_mean = 0.0;
+ 					for(int i=0;i<n;i++){
+ 						double mu_minus_k = mu_l[i] - x_k[i]*beta_old;
+ 						beta_prec += omega_l[i]*x2_k[i];
+ 						beta_mean += (y_s_l[i] - omega_l[i]*mu_minus_k)*x_k[i];
+ 					}
+ 					double beta_var = 1.0/beta_prec;
+ 					if(rb_iter)
+ 						betacoef_mean(k,l) += beta_mean*beta_var;
+ 					double beta_new = beta_mean*beta_var + sqrt(beta_var)*z(k,l);
+ 					double beta_diff = beta_new - beta_old;
+ 					for(int i=0;i<n;i++)
+ 						mu_l[i] += x_k[i]*beta_diff;
+ 					betacoef(k,l) = beta_new;
+ 				}
+ 			}
+ 		}
+
+ 		//update omega of all labels in one call
+ 		arma::vec omega_vec = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+ 		omega = arma::reshape(omega_vec,n,L);
+
+ 		//update tau2
+ 		arma::rowvec sum_beta2 = arma::sum(betacoef%betacoef,0);
+ 		for(int l=0;l<L;l++){
+ 			inv_tau2(l) = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau(l)+0.5*sum_beta2(l))));
+ 			b_tau(l) = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2(l))));
+ 		}
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			if(mcmc_output){
+ 				betacoef_list.slice(mcmc_iter) = betacoef;
+ 				tau2_list.col(mcmc_iter) = 1.0/inv_tau2;
+ 			}
+ 			tau2_mean += 1.0/inv_tau2;
+ 		}
+ 	}
+
+ 	betacoef = betacoef_mean/mcmc_sample;
+ 	tau2_mean /= mcmc_sample;
+ 	mu = X*betacoef;
+
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2_mean,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
+ 	double elapsed = timer.toc();
+ 	if(mcmc_output){
+ 		Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                         Named("tau2") = tau2_list);
+ 		return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("mcmc") = mcmc,
+                              Named("elapsed") = elapsed);
+ 	} else{
+ 		return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("elapsed") = elapsed);
+ 	}
+ }
+
+//'@title Fast Bayesian logistic regression with spike-and-slab priors by single
+//'variable update Gibbs sampler
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the slab standard deviation
+//'@param a_pi first shape parameter in the beta prior of the inclusion probability
+//'@param b_pi second shape parameter in the beta prior of the inclusion probability
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of six components for posterior mean statistics}
+//'\describe{
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{delta_prob}{a vector of posterior inclusion probabilities of p predictors}
+//'\item{tau2}{posterior mean of the slab variance}
+//'\item{pi}{posterior mean of the inclusion probability}
 //'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
 //'\item{prob}{a vector of posterior predictive probability of the n training sample}
 //'}
 //'\item{mcmc}{a list object of three components for MCMC samples}
 //'\describe{
-//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
-//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients if mcmc_output is true. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of the slab variance}
+//'\item{num_active}{a vector of MCMC samples of the number of selected predictors}
 //'}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'library(bigmemory)
 //'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'dat1$X <- as.big.matrix(dat1$X)
-//'res1 <- with(dat1,big_normal_logit_single_gibbs(y,X@address))
-//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'res1 <- with(dat1,fast_normal_logit_sel_single_gibbs(y,X))
 //'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res2 <- with(dat2,big_normal_logit_single_gibbs(y,X@address,burnin=5000))
-//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'res2 <- with(dat2,fast_normal_logit_sel_single_gibbs(y,X,burnin=5000))
 //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
-//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
-//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
-//'normal_logit_tab <- tab
-//'print(normal_logit_tab)
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'print(tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List big_normal_logit_single_gibbs(arma::vec& y, SEXP bigX,
-                                          int mcmc_sample = 500,
-                                          int burnin = 500, int thinning = 1,
-                                          double A_tau = 1,
-                                          int verbose = 0){
-
- 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ Rcpp::List fast_normal_logit_sel_single_gibbs(arma::vec& y, arma::mat& X,
+                                               int mcmc_sample = 500,
+                                               int burnin = 500, int thinning = 1,
+                                               double A_tau = 1,
+                                               double a_pi = 1, double b_pi = 1,
+                                               bool mcmc_output = true){
 
  	arma::wall_clock timer;
  	timer.tic();
 
-
- 	long p = xpMat->ncol();
- 	long n = xpMat->nrow();
-
- 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
 
  	double A2_tau = A_tau*A_tau;
  	double b_tau = A2_tau;
- 	double inv_tau2 = 1.0/b_tau;
+ 	double tau2 = b_tau;
+ 	double incl_prob = 0.5;
 
  	arma::vec y_s = y - 0.5;
- 	//arma::mat X2 = X%X;
 
  	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
  	Rcpp::Function pgdraw = pkg["pgdraw"];
  	Rcpp::NumericVector zeros(n,0.0);
  	arma::vec betacoef;
  	betacoef.zeros(p);
+ 	arma::uvec delta;
+ 	delta.zeros(p);
  	arma::vec mu;
  	mu.zeros(n);
  	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
+ 	//working residual y_s - omega*mu, kept current with mu
+ 	arma::vec res = y_s - omega%mu;
 
  	arma::mat betacoef_list;
- 	arma::mat mu_list;
+ 	arma::vec betacoef_mean;
+ 	arma::vec delta_mean;
  	arma::vec tau2_list;
- 	arma::vec mean_omega;
- 	double mean_tau2;
- 	mean_omega.zeros(n);
-
- 	betacoef_list.zeros(p,mcmc_sample);
- 	mu_list.zeros(n,mcmc_sample);
+ 	arma::vec num_active_list;
+ 	double incl_prob_mean = 0.0;
+ 	betacoef_mean.zeros(p);
+ 	delta_mean.zeros(p);
+ 	if(mcmc_output)
+ 		betacoef_list.zeros(p,mcmc_sample);
  	tau2_list.zeros(mcmc_sample);
+ 	num_active_list.zeros(mcmc_sample);
 
  	int total_iter = burnin + mcmc_sample*thinning;
- 	for(long iter=0;iter<total_iter;iter++){
- 		//update beta
- 		for(long k=0;k<p;k++){
- 			//compute posterior variance
-
- 			double beta_var = arma::accu(omega%X.col(k)%X.col(k));
- 			beta_var += inv_tau2;
- 			beta_var = 1.0/beta_var;
- 			mu -= X.col(k)*betacoef(k);
- 			vec mu_minus_k = mu;
- 			//vec mu_minus_k = mu - X.col(k)*betacoef(k);
- 			//mu = mu_minus_k;
- 			mu_minus_k %= -omega;
- 			mu_minus_k += y_s;
- 			//compute posterior mean
- 			double beta_mean = arma::accu(mu_minus_k%X.col(k));
- 			beta_mean *= beta_var;
- 			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
- 			//update mu
- 			mu += X.col(k)*betacoef(k);
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update delta and beta jointly with beta integrated out of the
+ 		//inclusion probability; columns that stay excluded are only read.
+ 		//On saved iterations the conditional inclusion probabilities and
+ 		//means are accumulated for the Rao-Blackwellized estimates
+ 		bool rb_iter = iter>=burnin && (iter-burnin+1)%thinning==0;
+ 		double log_prior_odds = log(incl_prob) - log(1.0 - incl_prob);
+ 		double inv_tau2 = 1.0/tau2;
+ 		for(int k=0;k<p;k++){
+ 			//x_k'diag(omega)x_k and x_k'res in one pass over the column
+ 			const double* x_k = X.colptr(k);
+ 			double beta_prec = 0.0;
+ 			double s_k = 0.0;
+ 			for(int i=0;i<n;i++){
+ 				beta_prec += omega(i)*x_k[i]*x_k[i];
+ 				s_k += x_k[i]*res(i);
+ 			}
+ 			double beta_old = betacoef(k);
+ 			s_k += beta_prec*beta_old;
+ 			double log_bf = -0.5*log(1.0 + tau2*beta_prec);
+ 			beta_prec += inv_tau2;
+ 			log_bf += 0.5*s_k*s_k/beta_prec;
+ 			double log_odds = log_bf + log_prior_odds;
+ 			double prob = 0.0;
+ 			if(log_odds>0){
+ 				prob = 1.0/(1.0+exp(-log_odds));
+ 			} else{
+ 				prob = exp(log_odds);
+ 				prob = prob/(1.0+prob);
+ 			}
+ 			if(rb_iter){
+ 				delta_mean(k) += prob;
+ 				betacoef_mean(k) += prob*s_k/beta_prec;
+ 			}
+ 			double beta_new = 0.0;
+ 			if(arma::randu<double>() < prob){
+ 				delta(k) = 1;
+ 				beta_new = s_k/beta_prec + arma::randn<double>()/sqrt(beta_prec);
+ 			} else{
+ 				delta(k) = 0;
+ 			}
+ 			double beta_diff = beta_new - beta_old;
+ 			if(beta_diff!=0.0){
+ 				for(int i=0;i<n;i++){
+ 					mu(i) += x_k[i]*beta_diff;
+ 					res(i) -= omega(i)*x_k[i]*beta_diff;
+ 				}
+ 				betacoef(k) = beta_new;
+ 			}
  		}
 
  		//update omega
  		omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+ 		res = y_s - omega%mu;
 
- 		//update tau2
+ 		//update tau2 and pi
+ 		double num_active = arma::accu(delta);
  		double sum_beta2 = arma::accu(betacoef%betacoef);
- 		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
+ 		inv_tau2 = randg<double>(distr_param((1.0+num_active)/2.0,1.0/(b_tau+0.5*sum_beta2)));
  		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
-
- 		//update b
-
- 		if(iter > burnin){
- 			if((iter-burnin)%thinning==0){
- 				int mcmc_iter = (iter-burnin)/thinning;
+ 		tau2 = 1.0/inv_tau2;
+ 		double g_1 = randg<double>(distr_param(a_pi+num_active,1.0));
+ 		double g_0 = randg<double>(distr_param(b_pi+p-num_active,1.0));
+ 		incl_prob = g_1/(g_1+g_0);
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			incl_prob_mean += incl_prob;
+ 			if(mcmc_output)
  				betacoef_list.col(mcmc_iter) = betacoef;
- 				mu_list.col(mcmc_iter) = mu;
- 				tau2_list(mcmc_iter) = 1.0/inv_tau2;
- 			}
- 		}
-
- 		if(verbose>0){
- 			if((iter+1)%verbose==0){
- 				vec prob = 1/(1+exp(-mu));
- 				uvec yfit = (prob>0.5);
- 				double err = arma::mean(abs(y-yfit));
- 				std::cout << iter+1 << " err = " << err <<
- 					std::endl;
- 			}
+ 			tau2_list(mcmc_iter) = tau2;
+ 			num_active_list(mcmc_iter) = num_active;
  		}
-
  	}
 
+ 	betacoef = betacoef_mean/mcmc_sample;
+ 	mu = X*betacoef;
 
- 	betacoef = arma::mean(betacoef_list,1);
- 	mean_tau2 = arma::mean(tau2_list);
- 	mean_omega /= mcmc_sample;
- 	mu =  X*betacoef;
-
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
-                                            Named("tau2") = mean_tau2,
-                                            Named("omega") = mean_omega,
-                                            Named("mu") = mu,
-                                            Named("prob") = 1.0/(1.0+exp(-mu)));
+                                            Named("delta_prob") = delta_mean/mcmc_sample,
+                                            Named("tau2") = arma::mean(tau2_list),
+                                            Named("pi") = incl_prob_mean/mcmc_sample,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                       Named("tau2") = tau2_list);
+                                       Named("tau2") = tau2_list,
+                                       Named("num_active") = num_active_list);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
@@ -1921,10 +2826,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
-//'@title Bayesian logistic regression with normal priors by single
-//'variable update Gibbs sampler sparse predictor matrices
-//'@param y vector of n binary outcome variables taking values 0 or 1
-//'@param X n x p sparse matrix of candidate predictors
+//'@title Scalable Bayesian logistic regression with normal priors by single
+//'variable update Gibbs sampler
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
@@ -1948,11 +2853,11 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5,density=0.1)
-//'res1 <- with(dat1,sparse_normal_logit_single_gibbs(y,X))
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res1 <- with(dat1,scalable_normal_logit_single_gibbs(y,X))
 //'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
-//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5,density=0.1)
-//'res2 <- with(dat2,sparse_normal_logit_single_gibbs(y,X,burnin=5000))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res2 <- with(dat2,scalable_normal_logit_single_gibbs(y,X,burnin=5000))
 //'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
 //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
 //'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
@@ -1965,25 +2870,33 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'print(normal_logit_tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List sparse_normal_logit_single_gibbs(arma::vec& y, arma::sp_mat& X,
-                                             int mcmc_sample = 500,
-                                             int burnin = 500, int thinning = 1,
-                                             double A_tau = 1,
-                                             int verbose = 0){
+ Rcpp::List scalable_normal_logit_single_gibbs(arma::vec& y, SEXP bigX,
+                                               arma::uvec& rowidx,
+                                               int mcmc_sample = 500,
+                                               int burnin = 500, int thinning = 1,
+                                               double A_tau = 1,
+                                               int verbose = 0){
+
+
+
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
 
  	arma::wall_clock timer;
  	timer.tic();
 
 
- 	int p = X.n_cols;
- 	int n = X.n_rows;
+ 	long p = xpMat->ncol();
+ 	long n = xpMat->nrow();
+
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+
 
  	double A2_tau = A_tau*A_tau;
  	double b_tau = A2_tau;
  	double inv_tau2 = 1.0/b_tau;
 
  	arma::vec y_s = y - 0.5;
- 	arma::sp_mat X2 = X%X;
+ 	arma::mat X2 = X%X;
 
  	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
  	Rcpp::Function pgdraw = pkg["pgdraw"];
@@ -1995,19 +2908,23 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
 
  	arma::mat betacoef_list;
- 	arma::mat mu_list;
  	arma::vec tau2_list;
  	arma::vec mean_omega;
  	double mean_tau2;
  	mean_omega.zeros(n);
 
  	betacoef_list.zeros(p,mcmc_sample);
- 	mu_list.zeros(n,mcmc_sample);
+ 	arma::vec betacoef_rb = arma::zeros<arma::vec>(p);
+ 	int num_rb = 0;
  	tau2_list.zeros(mcmc_sample);
 
  	int total_iter = burnin + mcmc_sample*thinning;
  	for(int iter=0;iter<total_iter;iter++){
- 		//update beta
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter > burnin && (iter-burnin)%thinning==0;
+ 		if(rb_iter)
+ 			num_rb++;
  		for(int k=0;k<p;k++){
  			//compute posterior variance
  			double beta_var = arma::accu(omega%X2.col(k));
@@ -2022,6 +2939,8 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  			//compute posterior mean
  			double beta_mean = arma::accu(mu_minus_k%X.col(k));
  			beta_mean *= beta_var;
+ 			if(rb_iter)
+ 				betacoef_rb(k) += beta_mean;
  			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
  			//update mu
  			mu += X.col(k)*betacoef(k);
@@ -2041,7 +2960,6 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  			if((iter-burnin)%thinning==0){
  				int mcmc_iter = (iter-burnin)/thinning;
  				betacoef_list.col(mcmc_iter) = betacoef;
- 				mu_list.col(mcmc_iter) = mu;
  				tau2_list(mcmc_iter) = 1.0/inv_tau2;
  			}
  		}
@@ -2059,16 +2977,16 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
  	}
 
 
- 	betacoef = arma::mean(betacoef_list,1);
+ 	betacoef = betacoef_rb/std::max(num_rb,1);
  	mean_tau2 = arma::mean(tau2_list);
  	mean_omega /= mcmc_sample;
- 	mu =  X*betacoef;
-
+ 	mu = X*betacoef;
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
                                             Named("tau2") = mean_tau2,
                                             Named("omega") = mean_omega,
-                                            Named("mu") = mu,
-                                            Named("prob") = 1.0/(1.0+exp(-mu)));
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("tau2") = tau2_list);
 
@@ -2078,10 +2996,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
-//'@title Fast Bayesian multinomial logistic regression with normal priors
-//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
-//'@param X n x p matrix of candidate predictors
-//'@param num_class an integer indicating the number of classes
+//'@title Bayesian logistic regression with normal priors by single
+//'variable update Gibbs sampler when predictor matrix is a big.matrix
+//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@param X n x p sparse matrix of candidate predictors
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
@@ -2105,84 +3023,139 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
-//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
-//'Bayes_res <- with(dat,fast_normal_multiclass(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
-//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
-//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
-//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
+//'library(bigmemory)
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'dat1$X <- as.big.matrix(dat1$X)
+//'res1 <- with(dat1,big_normal_logit_single_gibbs(y,X@address))
+//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res2 <- with(dat2,big_normal_logit_single_gibbs(y,X@address,burnin=5000))
+//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
+//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
+//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
+//'normal_logit_tab <- tab
+//'print(normal_logit_tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class,
-                                   int mcmc_sample = 500,
-                                   int burnin = 500, int thinning = 1,
-                                   double A_tau = 1){
+ Rcpp::List big_normal_logit_single_gibbs(arma::vec& y, SEXP bigX,
+                                          int mcmc_sample = 500,
+                                          int burnin = 500, int thinning = 1,
+                                          double A_tau = 1,
+                                          int verbose = 0){
+
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
 
  	arma::wall_clock timer;
  	timer.tic();
 
- 	arma::mat betacoef;
- 	arma::vec tau2;
- 	arma::mat mu;
- 	arma::mat prob;
- 	arma::mat log_1_prob;
- 	arma::cube betacoef_list;
- 	arma::mat tau2_list;
- 	betacoef.zeros(X.n_cols,num_class-1);
- 	mu.zeros(X.n_rows,num_class-1);
- 	prob.zeros(X.n_rows,num_class-1);
- 	tau2.zeros(num_class-1);
- 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
- 	tau2_list.zeros(mcmc_sample,num_class-1);
- 	log_1_prob.zeros(X.n_rows,num_class-1);
 
+ 	long p = xpMat->ncol();
+ 	long n = xpMat->nrow();
 
- 	for(int k=num_class-1;k>=1;k--){
- 		arma::uvec idx1 = arma::find(y==k);
- 		arma::uvec idx0 = arma::find(y<k);
- 		arma::vec y01;
- 		int n01 = idx0.n_elem+idx1.n_elem;
- 		y01.zeros(n01);
- 		y01.rows(idx0.n_elem,n01-1) += 1.0;
- 		arma::mat X01;
- 		X01.zeros(n01,X.n_cols);
- 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
- 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
- 		Rcpp::List fit01 = fast_normal_logit(y01,X01,mcmc_sample,burnin,thinning,A_tau);
- 		Rcpp::List post_mean01 = fit01["post_mean"];
- 		Rcpp::List mcmc01 = fit01["mcmc"];
- 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
- 		betacoef_list.slice(k-1) = temp_betacoef_list;
- 		arma::vec temp_tau2_list = mcmc01["tau2"];
- 		tau2_list.col(k-1) = temp_tau2_list;
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
 
- 		arma::vec temp_beta = post_mean01["betacoef"];
- 		betacoef.col(k-1) = temp_beta;
- 		mu.col(k-1) = X*temp_beta;
+ 	double A2_tau = A_tau*A_tau;
+ 	double b_tau = A2_tau;
+ 	double inv_tau2 = 1.0/b_tau;
 
+ 	arma::vec y_s = y - 0.5;
+ 	//arma::mat X2 = X%X;
 
- 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
- 		arma::vec log_prob = mu.col(k-1);
- 		log_1_prob.col(k-1) = -log1pexp(log_prob);
- 		log_prob += log_1_prob.col(k-1);
- 		prob.col(k-1) = log_prob;
- 		if(k<num_class-1){
- 			for(int j=k; j<num_class-1;j++){
- 				prob.col(k-1) += log_1_prob.col(j);
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
+ 	Rcpp::Function pgdraw = pkg["pgdraw"];
+ 	Rcpp::NumericVector zeros(n,0.0);
+ 	arma::vec betacoef;
+ 	betacoef.zeros(p);
+ 	arma::vec mu;
+ 	mu.zeros(n);
+ 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
+
+ 	arma::mat betacoef_list;
+ 	arma::vec tau2_list;
+ 	arma::vec mean_omega;
+ 	double mean_tau2;
+ 	mean_omega.zeros(n);
+
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	arma::vec betacoef_rb = arma::zeros<arma::vec>(p);
+ 	int num_rb = 0;
+ 	tau2_list.zeros(mcmc_sample);
+
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(long iter=0;iter<total_iter;iter++){
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter > burnin && (iter-burnin)%thinning==0;
+ 		if(rb_iter)
+ 			num_rb++;
+ 		for(long k=0;k<p;k++){
+ 			//compute posterior variance
+
+ 			double beta_var = arma::accu(omega%X.col(k)%X.col(k));
+ 			beta_var += inv_tau2;
+ 			beta_var = 1.0/beta_var;
+ 			mu -= X.col(k)*betacoef(k);
+ 			vec mu_minus_k = mu;
+ 			//vec mu_minus_k = mu - X.col(k)*betacoef(k);
+ 			//mu = mu_minus_k;
+ 			mu_minus_k %= -omega;
+ 			mu_minus_k += y_s;
+ 			//compute posterior mean
+ 			double beta_mean = arma::accu(mu_minus_k%X.col(k));
+ 			beta_mean *= beta_var;
+ 			if(rb_iter)
+ 				betacoef_rb(k) += beta_mean;
+ 			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
+ 			//update mu
+ 			mu += X.col(k)*betacoef(k);
+ 		}
+
+ 		//update omega
+ 		omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+
+ 		//update tau2
+ 		double sum_beta2 = arma::accu(betacoef%betacoef);
+ 		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
+ 		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+
+ 		//update b
+
+ 		if(iter > burnin){
+ 			if((iter-burnin)%thinning==0){
+ 				int mcmc_iter = (iter-burnin)/thinning;
+ 				betacoef_list.col(mcmc_iter) = betacoef;
+ 				tau2_list(mcmc_iter) = 1.0/inv_tau2;
  			}
  		}
- 		double temp_tau2 = post_mean01["tau2"];
- 		tau2(k-1) = temp_tau2;
+
+ 		if(verbose>0){
+ 			if((iter+1)%verbose==0){
+ 				vec prob = 1/(1+exp(-mu));
+ 				uvec yfit = (prob>0.5);
+ 				double err = arma::mean(abs(y-yfit));
+ 				std::cout << iter+1 << " err = " << err <<
+ 					std::endl;
+ 			}
+ 		}
+
  	}
 
- 	prob = exp(prob);
- 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
- 	prob = arma::join_rows(prob0,prob);
 
+ 	betacoef = betacoef_rb/std::max(num_rb,1);
+ 	mean_tau2 = arma::mean(tau2_list);
+ 	mean_omega /= mcmc_sample;
+ 	mu = X*betacoef;
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
-                                            Named("tau2") = tau2,
-                                            Named("mu") = mu,
-                                            Named("prob") = prob);
+                                            Named("tau2") = mean_tau2,
+                                            Named("omega") = mean_omega,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("tau2") = tau2_list);
 
@@ -2192,11 +3165,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
-
-//'@title Fast Bayesian multinomial logistic regression with normal priors using single gibbs samplers
-//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
-//'@param X n x p matrix of candidate predictors
-//'@param num_class an integer indicating the number of classes
+//'@title Bayesian logistic regression with normal priors by single
+//'variable update Gibbs sampler sparse predictor matrices
+//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@param X n x p sparse matrix of candidate predictors
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
@@ -2220,85 +3192,133 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
-//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
-//'Bayes_res <- with(dat,fast_normal_multiclass_single_gibbs(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
-//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
-//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
-//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5,density=0.1)
+//'res1 <- with(dat1,sparse_normal_logit_single_gibbs(y,X))
+//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5,density=0.1)
+//'res2 <- with(dat2,sparse_normal_logit_single_gibbs(y,X,burnin=5000))
+//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
+//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
+//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
+//'normal_logit_tab <- tab
+//'print(normal_logit_tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class,
-                                                int mcmc_sample = 500,
-                                                int burnin = 500, int thinning = 1,
-                                                double A_tau = 1,
-                                                int verbose = 0){
+ Rcpp::List sparse_normal_logit_single_gibbs(arma::vec& y, arma::sp_mat& X,
+                                             int mcmc_sample = 500,
+                                             int burnin = 500, int thinning = 1,
+                                             double A_tau = 1,
+                                             int verbose = 0){
 
  	arma::wall_clock timer;
  	timer.tic();
 
- 	arma::mat betacoef;
- 	arma::vec tau2;
- 	arma::mat mu;
- 	arma::mat prob;
- 	arma::mat log_1_prob;
- 	arma::cube betacoef_list;
- 	arma::mat tau2_list;
- 	betacoef.zeros(X.n_cols,num_class-1);
- 	mu.zeros(X.n_rows,num_class-1);
- 	prob.zeros(X.n_rows,num_class-1);
- 	tau2.zeros(num_class-1);
- 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
- 	tau2_list.zeros(mcmc_sample,num_class-1);
- 	log_1_prob.zeros(X.n_rows,num_class-1);
-
 
- 	for(int k=num_class-1;k>=1;k--){
- 		arma::uvec idx1 = arma::find(y==k);
- 		arma::uvec idx0 = arma::find(y<k);
- 		arma::vec y01;
- 		int n01 = idx0.n_elem+idx1.n_elem;
- 		y01.zeros(n01);
- 		y01.rows(idx0.n_elem,n01-1) += 1.0;
- 		arma::mat X01;
- 		X01.zeros(n01,X.n_cols);
- 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
- 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
- 		Rcpp::List fit01 = fast_normal_logit_single_gibbs(y01,X01,mcmc_sample,burnin,thinning,A_tau,verbose);
- 		Rcpp::List post_mean01 = fit01["post_mean"];
- 		Rcpp::List mcmc01 = fit01["mcmc"];
- 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
- 		betacoef_list.slice(k-1) = temp_betacoef_list;
- 		arma::vec temp_tau2_list = mcmc01["tau2"];
- 		tau2_list.col(k-1) = temp_tau2_list;
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
 
- 		arma::vec temp_beta = post_mean01["betacoef"];
- 		betacoef.col(k-1) = temp_beta;
- 		mu.col(k-1) = X*temp_beta;
+ 	double A2_tau = A_tau*A_tau;
+ 	double b_tau = A2_tau;
+ 	double inv_tau2 = 1.0/b_tau;
 
+ 	arma::vec y_s = y - 0.5;
+ 	arma::sp_mat X2 = X%X;
 
- 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
- 		arma::vec log_prob = mu.col(k-1);
- 		log_1_prob.col(k-1) = -log1pexp(log_prob);
- 		log_prob += log_1_prob.col(k-1);
- 		prob.col(k-1) = log_prob;
- 		if(k<num_class-1){
- 			for(int j=k; j<num_class-1;j++){
- 				prob.col(k-1) += log_1_prob.col(j);
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
+ 	Rcpp::Function pgdraw = pkg["pgdraw"];
+ 	Rcpp::NumericVector zeros(n,0.0);
+ 	arma::vec betacoef;
+ 	betacoef.zeros(p);
+ 	arma::vec mu;
+ 	mu.zeros(n);
+ 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
+
+ 	arma::mat betacoef_list;
+ 	arma::vec tau2_list;
+ 	arma::vec mean_omega;
+ 	double mean_tau2;
+ 	mean_omega.zeros(n);
+
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	arma::vec betacoef_rb = arma::zeros<arma::vec>(p);
+ 	int num_rb = 0;
+ 	tau2_list.zeros(mcmc_sample);
+
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter > burnin && (iter-burnin)%thinning==0;
+ 		if(rb_iter)
+ 			num_rb++;
+ 		for(int k=0;k<p;k++){
+ 			//compute posterior variance
+ 			double beta_var = arma::accu(omega%X2.col(k));
+ 			beta_var += inv_tau2;
+ 			beta_var = 1.0/beta_var;
+ 			mu -= X.col(k)*betacoef(k);
+ 			vec mu_minus_k = mu;
+ 			//vec mu_minus_k = mu - X.col(k)*betacoef(k);
+ 			//mu = mu_minus_k;
+ 			mu_minus_k %= -omega;
+ 			mu_minus_k += y_s;
+ 			//compute posterior mean
+ 			double beta_mean = arma::accu(mu_minus_k%X.col(k));
+ 			beta_mean *= beta_var;
+ 			if(rb_iter)
+ 				betacoef_rb(k) += beta_mean;
+ 			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
+ 			//update mu
+ 			mu += X.col(k)*betacoef(k);
+ 		}
+
+ 		//update omega
+ 		omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+
+ 		//update tau2
+ 		double sum_beta2 = arma::accu(betacoef%betacoef);
+ 		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
+ 		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+
+ 		//update b
+
+ 		if(iter > burnin){
+ 			if((iter-burnin)%thinning==0){
+ 				int mcmc_iter = (iter-burnin)/thinning;
+ 				betacoef_list.col(mcmc_iter) = betacoef;
+ 				tau2_list(mcmc_iter) = 1.0/inv_tau2;
  			}
  		}
- 		double temp_tau2 = post_mean01["tau2"];
- 		tau2(k-1) = temp_tau2;
+
+ 		if(verbose>0){
+ 			if((iter+1)%verbose==0){
+ 				vec prob = 1/(1+exp(-mu));
+ 				uvec yfit = (prob>0.5);
+ 				double err = arma::mean(abs(y-yfit));
+ 				std::cout << iter+1 << " err = " << err <<
+ 					std::endl;
+ 			}
+ 		}
+
  	}
 
- 	prob = exp(prob);
- 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
- 	prob = arma::join_rows(prob0,prob);
 
+ 	betacoef = betacoef_rb/std::max(num_rb,1);
+ 	mean_tau2 = arma::mean(tau2_list);
+ 	mean_omega /= mcmc_sample;
+ 	mu =  X*betacoef;
+
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
-                                            Named("tau2") = tau2,
-                                            Named("mu") = mu,
-                                            Named("prob") = prob);
+                                            Named("tau2") = mean_tau2,
+                                            Named("omega") = mean_omega,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
                                        Named("tau2") = tau2_list);
 
@@ -2308,454 +3328,1058 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
+// Implicit design operators: columns are formed on the fly from a base
+// design, so the sampler only stores X (and Phi). Each operator provides
+// n_rows(), n_cols(), col(m, x) and times(beta) = design*beta
 
-//'@title Memory efficient Bayesian multinomial logistic regression with normal priors using single gibbs samplers
-//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
-//'@param X n x p matrix of candidate predictors
-//'@param num_class an integer indicating the number of classes
+// column kernels dot, wdot, axpy and waxpy of the count-data samplers for
+// designs that form their columns on the fly; the last column formed is
+// cached, since a single-site update reads the same column three times
+template<typename Design>
+class cached_column_kernels{
+public:
+	cached_column_kernels() : cache_valid(false){
+	}
+	double dot(arma::uword m, const arma::vec& r) const{
+		return arma::dot(cached_col(m), r);
+	}
+	double wdot(arma::uword m, const arma::vec& w, const arma::vec& r, double& s) const{
+		const arma::vec& x = cached_col(m);
+		s = arma::dot(x, r);
+		return arma::accu(w%x%x);
+	}
+	void axpy(arma::uword m, double a, arma::vec& v) const{
+		v += a*cached_col(m);
+	}
+	void waxpy(arma::uword m, double a, const arma::vec& w, arma::vec& v) const{
+		v += a*(w%cached_col(m));
+	}
+private:
+	const arma::vec& cached_col(arma::uword m) const{
+		if(!cache_valid || cache_m!=m){
+			static_cast<const Design*>(this)->col(m, cache_x);
+			cache_m = m;
+			cache_valid = true;
+		}
+		return cache_x;
+	}
+	mutable arma::vec cache_x;
+	mutable arma::uword cache_m;
+	mutable bool cache_valid;
+};
+
+// pairwise interaction design [X, X_j*X_k for j < k]
+class interaction_design : public cached_column_kernels<interaction_design>{
+public:
+	interaction_design(const arma::mat& in_X) : X(in_X){
+		arma::uword p = X.n_cols;
+		arma::uword num_pairs = p>1 ? p*(p-1)/2 : 0;
+		pair_j.set_size(num_pairs);
+		pair_k.set_size(num_pairs);
+		arma::uword m = 0;
+		for(arma::uword j=0;j<p;j++){
+			for(arma::uword k=j+1;k<p;k++){
+				pair_j(m) = j;
+				pair_k(m) = k;
+				m++;
+			}
+		}
+	}
+	arma::uword n_rows() const{
+		return X.n_rows;
+	}
+	arma::uword n_cols() const{
+		return X.n_cols + pair_j.n_elem;
+	}
+	void col(arma::uword m, arma::vec& x) const{
+		if(m < X.n_cols){
+			x = X.col(m);
+		} else{
+			m -= X.n_cols;
+			x = X.col(pair_j(m))%X.col(pair_k(m));
+		}
+	}
+	// the interactions of column j are contiguous, so X*beta needs one
+	// GEMV per column of X instead of forming the products
+	arma::vec times(const arma::vec& beta) const{
+		arma::uword p = X.n_cols;
+		arma::vec mu = X*beta.head(p);
+		arma::uword m = p;
+		for(arma::uword j=0;j+1<p;j++){
+			arma::uword num_k = p-j-1;
+			mu += X.col(j)%(X.cols(j+1,p-1)*beta.subvec(m,m+num_k-1));
+			m += num_k;
+		}
+		return mu;
+	}
+	arma::umat pairs() const{
+		return arma::join_rows(pair_j,pair_k).t() + 1;
+	}
+private:
+	const arma::mat& X;
+	arma::uvec pair_j;
+	arma::uvec pair_k;
+};
+
+// basis projected design Z = X*Phi with a sparse or compactly supported Phi
+class basis_design : public cached_column_kernels<basis_design>{
+public:
+	basis_design(const arma::mat& in_X, const arma::sp_mat& in_Phi) : X(in_X), Phi(in_Phi){
+	}
+	arma::uword n_rows() const{
+		return X.n_rows;
+	}
+	arma::uword n_cols() const{
+		return Phi.n_cols;
+	}
+	void col(arma::uword m, arma::vec& x) const{
+		x.zeros(X.n_rows);
+		for(arma::sp_mat::const_col_iterator it=Phi.begin_col(m);it!=Phi.end_col(m);++it){
+			x += X.col(it.row())*(*it);
+		}
+	}
+	arma::vec times(const arma::vec& theta) const{
+		arma::vec beta = Phi*theta;
+		return X*beta;
+	}
+private:
+	const arma::mat& X;
+	const arma::sp_mat& Phi;
+};
+
+template<typename Design>
+Rcpp::List implicit_count_single_gibbs(arma::vec& kappa, arma::vec& b, const Design& Z,
+                                       bool horseshoe,
+                                       int mcmc_sample, int burnin, int thinning,
+                                       double A_tau, double A_lambda, bool mcmc_output,
+                                       int verbose = 0);
+
+// single variable update Gibbs sampler for the logistic regression with
+// normal priors on an implicit design: the count-data sampler with b_i = 1
+template<typename Design>
+Rcpp::List implicit_normal_logit_single_gibbs(arma::vec& y, const Design& Z,
+                                              int mcmc_sample, int burnin, int thinning,
+                                              double A_tau, int verbose, bool mcmc_output){
+ 	arma::vec kappa = y - 0.5;
+ 	arma::vec b = arma::ones<arma::vec>(y.n_elem);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, false,
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, 1.0, mcmc_output, verbose);
+ 	Rcpp::List res_mean = res["post_mean"];
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = res_mean["betacoef"],
+                                            Named("tau2") = res_mean["tau2"],
+                                            Named("mu") = res_mean["mu"],
+                                            Named("prob") = res_mean["prob"]);
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = res["mcmc"]);
+}
+
+//'@title Bayesian logistic regression with pairwise interactions and normal
+//'priors by single variable update Gibbs sampler without forming the interactions
+//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@param X n x p matrix of base predictors; the design consists of the p
+//'main effects followed by the p(p-1)/2 pairwise products X_j*X_k for j < k,
+//'which are computed on the fly
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
-//'@return a list object consisting of three components
+//'@param verbose print the training error every verbose iterations; 0 means no printing
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is false
+//'@return a list object consisting of four components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
 //'\describe{
-//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{betacoef}{a vector of posterior mean of p + p(p-1)/2 regression coeficients}
 //'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
 //'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
 //'\item{prob}{a vector of posterior predictive probability of the n training sample}
 //'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\item{mcmc}{a list object of two components for MCMC samples}
 //'\describe{
-//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{betacoef}{a matrix of MCMC samples for regression coeficients if mcmc_output is true. Each column is one MCMC sample}
 //'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
 //'}
+//'\item{pairs}{a 2 x p(p-1)/2 matrix of the column indices of X of each interaction}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
-//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
-//'Bayes_res <- with(dat,scalable_normal_multiclass_single_gibbs(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
-//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
-//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
-//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
+//'dat <- sim_logit_reg(n=2000,p=30,X_cor=0.5,X_var=1,q=10,beta_size=1)
+//'res <- with(dat,interaction_normal_logit_single_gibbs(y,X))
+//'print(mean((res$post_mean$prob>0.5)==dat$y))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class,
-                                                    int mcmc_sample = 500,
-                                                    int burnin = 500, int thinning = 1,
-                                                    double A_tau = 1,
-                                                    int verbose = 0){
-
+ Rcpp::List interaction_normal_logit_single_gibbs(arma::vec& y, arma::mat& X,
+                                                  int mcmc_sample = 500,
+                                                  int burnin = 500, int thinning = 1,
+                                                  double A_tau = 1,
+                                                  int verbose = 0,
+                                                  bool mcmc_output = false){
  	arma::wall_clock timer;
  	timer.tic();
-
- 	arma::mat betacoef;
- 	arma::vec tau2;
- 	arma::mat mu;
- 	arma::mat prob;
- 	arma::mat log_1_prob;
- 	arma::cube betacoef_list;
- 	arma::mat tau2_list;
- 	betacoef.zeros(X.n_cols,num_class-1);
- 	mu.zeros(X.n_rows,num_class-1);
- 	prob.zeros(X.n_rows,num_class-1);
- 	tau2.zeros(num_class-1);
- 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
- 	tau2_list.zeros(mcmc_sample,num_class-1);
- 	log_1_prob.zeros(X.n_rows,num_class-1);
-
-
- 	for(int k=num_class-1;k>=1;k--){
- 		arma::uvec idx1 = arma::find(y==k);
- 		arma::uvec idx0 = arma::find(y<k);
- 		arma::vec y01;
- 		int n01 = idx0.n_elem+idx1.n_elem;
- 		y01.zeros(n01);
- 		y01.rows(idx0.n_elem,n01-1) += 1.0;
- 		arma::mat X01;
- 		X01.zeros(n01,X.n_cols);
- 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
- 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
- 		Rcpp::List fit01 = fast_normal_logit_single_gibbs(y01,X01,mcmc_sample,burnin,thinning,A_tau,verbose);
- 		Rcpp::List post_mean01 = fit01["post_mean"];
- 		Rcpp::List mcmc01 = fit01["mcmc"];
- 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
- 		betacoef_list.slice(k-1) = temp_betacoef_list;
- 		arma::vec temp_tau2_list = mcmc01["tau2"];
- 		tau2_list.col(k-1) = temp_tau2_list;
-
- 		arma::vec temp_beta = post_mean01["betacoef"];
- 		betacoef.col(k-1) = temp_beta;
- 		mu.col(k-1) = X*temp_beta;
-
-
- 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
- 		arma::vec log_prob = mu.col(k-1);
- 		log_1_prob.col(k-1) = -log1pexp(log_prob);
- 		log_prob += log_1_prob.col(k-1);
- 		prob.col(k-1) = log_prob;
- 		if(k<num_class-1){
- 			for(int j=k; j<num_class-1;j++){
- 				prob.col(k-1) += log_1_prob.col(j);
- 			}
- 		}
- 		double temp_tau2 = post_mean01["tau2"];
- 		tau2(k-1) = temp_tau2;
- 	}
-
- 	prob = exp(prob);
- 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
- 	prob = arma::join_rows(prob0,prob);
-
- 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
-                                            Named("tau2") = tau2,
-                                            Named("mu") = mu,
-                                            Named("prob") = prob);
- 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                       Named("tau2") = tau2_list);
-
+ 	interaction_design Z(X);
+ 	Rcpp::List res = implicit_normal_logit_single_gibbs(y, Z, mcmc_sample, burnin, thinning,
+                                                     A_tau, verbose, mcmc_output);
  	double elapsed = timer.toc();
- 	return Rcpp::List::create(Named("post_mean") = post_mean,
-                            Named("mcmc") = mcmc,
+ 	return Rcpp::List::create(Named("post_mean") = res["post_mean"],
+                            Named("mcmc") = res["mcmc"],
+                            Named("pairs") = Z.pairs(),
                             Named("elapsed") = elapsed);
  }
 
-//'@title Fast mean field variational Bayesian logistic regression with normal priors
-//'@param y vector of n binrary outcome variables taking values 0 or 1
-//'@param X n x p matrix of candidate predictors
-//'@param max_iter maximum number of iterations
-//'@param tol the tolerance for the parameter changes
-//'@param A scale parameter in the half Cauchy prior for regression coefficients
-//'@param in_E_inv_tau_sq numeric scalar for the initial value for inverse of tau squared
-//'@param in_E_omega numeric vector of length n for the initial values for all omega's
-//'@param in_E_beta  numeric vector of length p for the initial values for all beta's
+//'@title Bayesian logistic regression on basis projected predictors with normal
+//'priors by single variable update Gibbs sampler without forming the projection
+//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors, e.g. vectorized images
+//'@param Phi p x L sparse matrix of basis functions; the design Z = X*Phi is
+//'computed column by column on the fly
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param verbose print the training error every verbose iterations; 0 means no printing
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
 //'@return a list object consisting of three components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
 //'\describe{
-//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{inv_tau_sq}{posterior mean of inverse tau square}
-//'\item{omega}{a vector of posterior mean of omega}
+//'\item{betacoef}{a vector of posterior mean of L basis coeficients}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
 //'}
-//'\item{trace}{a list object of two components for the trace of parameter updates}
+//'\item{mcmc}{a list object of two components for MCMC samples}
 //'\describe{
-//'\item{inv_tau_sq}{a vector of trace for inverse of tau_sq}
-//'\item{sum_beta_sq}{a vector of trace for inverse of summation of beta_sq}
+//'\item{betacoef}{a matrix of MCMC samples for basis coeficients if mcmc_output is true. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
 //'}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_logit_reg(n=2000,p=20,X_cor=0.5,X_var=1,q=10,beta_size=5)
-//'split <- train_test_splits(nrow(dat1$X))
-//'dat1$train_idx <- split$train_idx
-//'dat1$test_idx <- split$test_idx
-//'res1 <- with(dat1,fast_mfvb_normal_logit(y[train_idx],X[train_idx,]))
-//'res1_mcmc <- with(dat1,fast_normal_logit(y[train_idx],X[train_idx,]))
-//'res1_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
-//'dat2 <- sim_logit_reg(n=200,p=400,X_cor=0.5,X_var=2,q=10,beta_size=1)
-//'split <- train_test_splits(nrow(dat2$X))
-//'dat2$train_idx <- split$train_idx
-//'dat2$test_idx <- split$test_idx
-//'res2 <- with(dat2,fast_mfvb_normal_logit(y[train_idx],X[train_idx,]))
-//'res2_mcmc <- with(dat2,fast_normal_logit(y[train_idx],X[train_idx,]))
-//'res2_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
-//'tab1 <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_mcmc$post_mean$betacoef)),
-//'time=c(res1$elapsed,res1_glmnet$elapsed,
-//'res1_mcmc$elapsed))
-//'tab2 <- data.frame(rbind(comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2_mcmc$post_mean$betacoef)),
-//'time=c(res2$elapsed,res2_glmnet$elapsed,
-//'res2_mcmc$elapsed))
-//'rownames(tab1)<-c("n = 2000, p = 20 MFVB","n = 2000, p = 20 glmnet",
-//'"n = 2000, p = 20 MCMC")
-//'rownames(tab2)<-c("n = 200, p = 400 MFVB","n = 200, p = 400 glmnet",
-//'"n = 200, p = 400 MCMC")
-//'mfvb_logit_tab <- rbind(tab1,tab2)
-//'print(mfvb_logit_tab)
+//'dat <- sim_logit_reg(n=500,p=1000,X_cor=0.5,X_var=1,q=10,beta_size=1)
+//'Phi <- Matrix::sparseMatrix(i=1:1000,j=rep(1:100,each=10),x=1)
+//'res <- with(dat,basis_normal_logit_single_gibbs(y,X,Phi))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X,
-                                   int max_iter = 5000,
-                                   double tol = 1e-05,
-                                   double A = 10,
-                                   double in_E_inv_tau_sq = 1,
-                                   Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue,
-                                   Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue){
-
+ Rcpp::List basis_normal_logit_single_gibbs(arma::vec& y, arma::mat& X,
+                                            arma::sp_mat& Phi,
+                                            int mcmc_sample = 500,
+                                            int burnin = 500, int thinning = 1,
+                                            double A_tau = 1,
+                                            int verbose = 0,
+                                            bool mcmc_output = true){
  	arma::wall_clock timer;
  	timer.tic();
+ 	if(Phi.n_rows != X.n_cols)
+ 		Rcpp::stop("Phi must have as many rows as X has columns");
+ 	basis_design Z(X, Phi);
+ 	Rcpp::List res = implicit_normal_logit_single_gibbs(y, Z, mcmc_sample, burnin, thinning,
+                                                     A_tau, verbose, mcmc_output);
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = res["post_mean"],
+                            Named("mcmc") = res["mcmc"],
+                            Named("elapsed") = elapsed);
+ }
 
+// explicit designs with the same interface as the implicit operators above,
+// so the count-data samplers share one kernel across dense, big.matrix and
+// sparse predictors. The column kernels dot, wdot, axpy and waxpy let the
+// single-site updates work on one column without copying it
+class dense_design{
+public:
+	dense_design(const arma::mat& in_X) : X(in_X){
+	}
+	arma::uword n_rows() const{
+		return X.n_rows;
+	}
+	arma::uword n_cols() const{
+		return X.n_cols;
+	}
+	void col(arma::uword m, arma::vec& x) const{
+		x = X.col(m);
+	}
+	arma::vec times(const arma::vec& beta) const{
+		return X*beta;
+	}
+	// x'r for column x = X.col(m)
+	double dot(arma::uword m, const arma::vec& r) const{
+		const double* x = X.colptr(m);
+		double s = 0.0;
+		for(arma::uword i=0;i<X.n_rows;i++)
+			s += x[i]*r(i);
+		return s;
+	}
+	// x'diag(w)x, with s = x'r from the same pass
+	double wdot(arma::uword m, const arma::vec& w, const arma::vec& r, double& s) const{
+		const double* x = X.colptr(m);
+		double q = 0.0;
+		s = 0.0;
+		for(arma::uword i=0;i<X.n_rows;i++){
+			q += w(i)*x[i]*x[i];
+			s += x[i]*r(i);
+		}
+		return q;
+	}
+	// v += a*x
+	void axpy(arma::uword m, double a, arma::vec& v) const{
+		const double* x = X.colptr(m);
+		for(arma::uword i=0;i<X.n_rows;i++)
+			v(i) += a*x[i];
+	}
+	// v += a*w%x
+	void waxpy(arma::uword m, double a, const arma::vec& w, arma::vec& v) const{
+		const double* x = X.colptr(m);
+		for(arma::uword i=0;i<X.n_rows;i++)
+			v(i) += a*w(i)*x[i];
+	}
+private:
+	const arma::mat& X;
+};
 
- 	int p = X.n_cols;
- 	int n = X.n_rows;
+class sparse_design{
+public:
+	sparse_design(const arma::sp_mat& in_X) : X(in_X){
+	}
+	arma::uword n_rows() const{
+		return X.n_rows;
+	}
+	arma::uword n_cols() const{
+		return X.n_cols;
+	}
+	void col(arma::uword m, arma::vec& x) const{
+		x.zeros(X.n_rows);
+		for(arma::sp_mat::const_col_iterator it=X.begin_col(m);it!=X.end_col(m);++it){
+			x(it.row()) = *it;
+		}
+	}
+	arma::vec times(const arma::vec& beta) const{
+		return X*beta;
+	}
+	// the column kernels below touch only the nonzeros of X.col(m)
+	double dot(arma::uword m, const arma::vec& r) const{
+		double s = 0.0;
+		for(arma::sp_mat::const_col_iterator it=X.begin_col(m);it!=X.end_col(m);++it)
+			s += (*it)*r(it.row());
+		return s;
+	}
+	double wdot(arma::uword m, const arma::vec& w, const arma::vec& r, double& s) const{
+		double q = 0.0;
+		s = 0.0;
+		for(arma::sp_mat::const_col_iterator it=X.begin_col(m);it!=X.end_col(m);++it){
+			q += w(it.row())*(*it)*(*it);
+			s += (*it)*r(it.row());
+		}
+		return q;
+	}
+	void axpy(arma::uword m, double a, arma::vec& v) const{
+		for(arma::sp_mat::const_col_iterator it=X.begin_col(m);it!=X.end_col(m);++it)
+			v(it.row()) += a*(*it);
+	}
+	void waxpy(arma::uword m, double a, const arma::vec& w, arma::vec& v) const{
+		for(arma::sp_mat::const_col_iterator it=X.begin_col(m);it!=X.end_col(m);++it)
+			v(it.row()) += a*w(it.row())*(*it);
+	}
+private:
+	const arma::sp_mat& X;
+};
 
- 	vec E_omega;
- 	vec E_beta, E_beta_0;
- 	if(in_E_omega.isNull()){
- 		E_omega.ones(n);
- 	} else{
- 		E_omega = Rcpp::as<arma::vec>(in_E_omega);
- 	}
+// Polya-Gamma single variable update Gibbs sampler for count data with
+// omega_i ~ PG(b_i, mu_i) and kappa_i = y_i - b_i/2:
+// binomial b_i = trials_i; negative binomial b_i = y_i + r and kappa_i = (y_i - r)/2.
+// The prior is beta_k ~ N(0, tau2*lambda_k^2) with lambda_k = 1 for the
+// normal prior and half Cauchy lambda_k for the horseshoe prior. The
+// implicit designs get their column kernels from cached_column_kernels
+template<typename Design>
+Rcpp::List implicit_count_single_gibbs(arma::vec& kappa, arma::vec& b, const Design& Z,
+                                       bool horseshoe,
+                                       int mcmc_sample, int burnin, int thinning,
+                                       double A_tau, double A_lambda, bool mcmc_output,
+                                       int verbose){
+ 	int p = Z.n_cols();
+ 	int n = Z.n_rows();
 
- 	if(in_E_beta.isNull()){
- 		E_beta.zeros(p);
- 	} else{
- 		E_beta = Rcpp::as<arma::vec>(in_E_beta);
- 	}
+ 	double A2_tau = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double b_tau = A2_tau;
+ 	double inv_tau2 = 1.0/b_tau;
 
- 	double A_sq = A*A;
- 	double E_inv_tau_sq = in_E_inv_tau_sq;
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
+ 	Rcpp::Function pgdraw = pkg["pgdraw"];
+ 	Rcpp::NumericVector b_r(b.begin(),b.end());
+ 	Rcpp::NumericVector zeros(n,0.0);
+ 	arma::vec betacoef;
+ 	betacoef.zeros(p);
+ 	arma::vec inv_lambda2;
+ 	inv_lambda2.ones(p);
+ 	arma::vec b_lambda;
+ 	b_lambda.ones(p);
+ 	arma::vec mu;
+ 	mu.zeros(n);
+ 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(b_r,zeros));
+ 	//working residual kappa - omega*mu, kept current with mu
+ 	arma::vec res = kappa - omega%mu;
 
+ 	arma::mat betacoef_list;
+ 	arma::vec betacoef_mean;
+ 	arma::vec lambda_mean;
+ 	arma::vec tau2_list;
+ 	betacoef_mean.zeros(p);
+ 	lambda_mean.zeros(p);
+ 	if(mcmc_output)
+ 		betacoef_list.zeros(p,mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
 
- 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
- 	arma::mat I_p = eye(p,p);
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter>=burnin && (iter-burnin+1)%thinning==0;
+ 		for(int k=0;k<p;k++){
+ 			double beta_mean = 0.0;
+ 			double beta_var = Z.wdot(k, omega, res, beta_mean);
+ 			double beta_old = betacoef(k);
+ 			beta_mean += beta_var*beta_old;
+ 			beta_var += inv_tau2*inv_lambda2(k);
+ 			beta_var = 1.0/beta_var;
+ 			beta_mean *= beta_var;
+ 			if(rb_iter)
+ 				betacoef_mean(k) += beta_mean;
+ 			betacoef(k) = beta_mean + sqrt(beta_var)*arma::randn<double>();
+ 			double beta_diff = betacoef(k) - beta_old;
+ 			Z.axpy(k, beta_diff, mu);
+ 			Z.waxpy(k, -beta_diff, omega, res);
+ 		}
 
- 	vec list_E_inv_tau_sq, list_E_sum_beta_sq;
- 	list_E_inv_tau_sq.zeros(max_iter);
- 	list_E_sum_beta_sq.zeros(max_iter);
- 	vec E_Zbeta_sq, Var_Zbeta;
- 	mat Cov_beta;
- 	mat S;
+ 		//update omega
+ 		omega = Rcpp::as<arma::vec>(pgdraw(b_r,NumericVector(mu.begin(),mu.end())));
+ 		res = kappa - omega%mu;
+
+ 		//update lambda
+ 		arma::vec betacoef2 = betacoef%betacoef;
+ 		if(horseshoe){
+ 			inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 			inv_lambda2 /= b_lambda + 0.5*betacoef2*inv_tau2;
+ 			b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 			b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 		}
 
- 	double convergence = 1;
- 	int iter = 0;
- 	for(iter=0; iter<max_iter; iter++){
- 		//Update E_beta
- 		//std::cout << "beta" << std::endl;
- 		mat OmegaX = X;
- 		OmegaX.each_col() %= E_omega;
- 		S = X.t()*OmegaX;
- 		S.diag() += E_inv_tau_sq;
- 		mat R = chol(S);
- 		mat B = solve(trimatl(R.t()),X.t(),solve_opts::fast);
- 		vec b = B*y_s;
- 		E_beta_0 = E_beta;
- 		E_beta = solve(trimatu(R),b,solve_opts::fast);
- 		//E_beta = solve(S,X.t()*y_s,solve_opts::fast);
- 		//std::cout << E_beta.rows(0,19) << std::endl;
- 		if(accu(abs(E_beta-E_beta_0))<tol){
- 			convergence = 0;
- 			break;
+ 		//update tau2
+ 		double sum_beta2 = arma::accu(betacoef2%inv_lambda2);
+ 		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
+ 		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			lambda_mean += sqrt(1.0/inv_lambda2);
+ 			if(mcmc_output)
+ 				betacoef_list.col(mcmc_iter) = betacoef;
+ 			tau2_list(mcmc_iter) = 1.0/inv_tau2;
  		}
- 		//Update tr_Cov_beta
- 		//std::cout << "tr_Cov_beta" << std::endl;
- 		mat D = solve(trimatl(R.t()),I_p,solve_opts::fast);
- 		D = D%D;
- 		double tr_Cov_beta = accu(D);
- 		//Update E_sum_beta_sq
- 		//std::cout << "E_sum_beta_sq" << std::endl;
- 		double E_sum_beta_sq = accu(E_beta%E_beta) + tr_Cov_beta;
- 		//Update E_omega
- 		//std::cout << "E_omega" << std::endl;
- 		//vec E_Zbeta = B.t()*b;
- 		vec E_Zbeta = X*E_beta;
- 		B = B%B;
- 		Var_Zbeta = sum(B.t(),1);
- 		//mat inv_S_Xt = solve(S,X.t());
- 		//mat temp = X*inv_S_Xt;
- 		//Var_Zbeta = temp.diag();
- 		E_Zbeta_sq = E_Zbeta%E_Zbeta + Var_Zbeta;
- 		//vec E_Zbeta_sq = E_Zbeta%E_Zbeta;
- 		vec sqrt_E_Zbeta_sq = sqrt(E_Zbeta_sq);
- 		E_omega = tanh(sqrt_E_Zbeta_sq*0.5)/(2*sqrt_E_Zbeta_sq);
- 		//Update E_inv_tau_sq
- 		//std::cout << "E_inv_tau_sq" << std::endl;
- 		double C = E_sum_beta_sq/A_sq;
- 		double bs = C + 1.0 - p;
- 		if(E_sum_beta_sq != 0){
- 			E_inv_tau_sq = (-bs + sqrt(bs*bs+4*(1.0+p)*C))/(2*E_sum_beta_sq);
+
+ 		if(verbose>0){
+ 			if((iter+1)%verbose==0){
+ 				//mean absolute error of the fitted success probabilities
+ 				//against the observed proportions y/b = kappa/b + 1/2
+ 				arma::vec prob;
+ 				link_apply<sigmoid_kernel>(mu, prob);
+ 				arma::uvec obs = arma::find(b>0);
+ 				arma::vec y_prop = kappa.elem(obs)/b.elem(obs) + 0.5;
+ 				double err = arma::mean(arma::abs(y_prop - prob.elem(obs)));
+ 				Rcpp::Rcout << iter+1 << " err = " << err << std::endl;
+ 			}
  		}
- 		list_E_inv_tau_sq(iter) = E_inv_tau_sq;
- 		list_E_sum_beta_sq(iter) = E_sum_beta_sq;
  	}
- 	//Cov_beta = inv_sympd(S);
 
- 	double elapsed = timer.toc();
- 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = E_beta,
-                                            Named("inv_tau_sq") = E_inv_tau_sq,
-                                            Named("omega") = E_omega);
- 	Rcpp::List trace = Rcpp::List::create(Named("inv_tau_sq") = list_E_inv_tau_sq,
-                                        Named("sum_beta_sq") = list_E_sum_beta_sq);
- 	Rcpp::List output = Rcpp::List::create(Named("post_mean") = post_mean,
-                                         Named("trace") = trace,
-                                         Named("iter") = iter,
-                                         Named("convergence") = convergence,
-                                         Named("elapsed") = elapsed);
- 	return output;
- }
+ 	betacoef = betacoef_mean/mcmc_sample;
+ 	mu = Z.times(betacoef);
 
-//'@title Fast single variable update mean field variational Bayesian
-//'logistic regression with normal priors
-//'@param y vector of n binrary outcome variables taking values 0 or 1
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = arma::mean(tau2_list),
+                                            Named("lambda") = lambda_mean/mcmc_sample,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list);
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc);
+}
+
+bool count_prior_horseshoe(std::string prior){
+	if(prior=="horseshoe")
+		return true;
+	if(prior!="normal")
+		Rcpp::stop("prior must be \"normal\" or \"horseshoe\"");
+	return false;
+}
+
+// b = trials and kappa = y - trials/2 of the binomial model
+void binomial_pg_param(arma::vec& kappa, arma::vec& b, arma::vec& y, arma::vec& trials){
+	if(trials.n_elem==1)
+		b = arma::ones<arma::vec>(y.n_elem)*trials(0);
+	else if(trials.n_elem==y.n_elem)
+		b = trials;
+	else
+		Rcpp::stop("trials must have length one or n");
+	if(arma::any(y<0) || arma::any(y>b))
+		Rcpp::stop("y must be between 0 and trials");
+	kappa = y - 0.5*b;
+}
+
+// b = y + r and kappa = (y - r)/2 of the negative binomial model
+void negbin_pg_param(arma::vec& kappa, arma::vec& b, arma::vec& y, double r){
+	if(r<=0)
+		Rcpp::stop("r must be positive");
+	if(arma::any(y<0))
+		Rcpp::stop("y must be nonnegative counts");
+	b = y + r;
+	kappa = 0.5*(y - r);
+}
+
+Rcpp::List count_single_gibbs_output(Rcpp::List& res, double elapsed){
+	return Rcpp::List::create(Named("post_mean") = res["post_mean"],
+                           Named("mcmc") = res["mcmc"],
+                           Named("elapsed") = elapsed);
+}
+
+//'@title Fast Bayesian binomial logistic regression by single variable update Gibbs sampler
+//'@param y vector of n success counts
+//'@param trials vector of n numbers of trials, or a single number shared by all observations
 //'@param X n x p matrix of candidate predictors
-//'@param max_iter maximum number of iterations
-//'@param tol the tolerance for the parameter changes
-//'@param A scale parameter in the half Cauchy prior for regression coefficients
-//'@param in_E_inv_tau_sq numeric scalar for the initial value for inverse of tau squared
-//'@param in_E_omega numeric vector of length n for the initial values for all omega's
-//'@param in_E_beta  numeric vector of length p for the initial values for all beta's
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
 //'@return a list object consisting of three components
 //'\describe{
-//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
 //'\describe{
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{inv_tau_sq}{posterior mean of inverse tau square}
-//'\item{omega}{a vector of posterior mean of omega}
+//'\item{tau2}{posterior mean of the global shrinkage parameter}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters (all one for the normal prior)}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive success probability of the n training sample}
 //'}
-//'\item{trace}{a list object of two components for the trace of parameter updates}
+//'\item{mcmc}{a list object of two components for MCMC samples}
 //'\describe{
-//'\item{inv_tau_sq}{a vector of trace for inverse of tau_sq}
-//'\item{sum_beta_sq}{a vector of trace for inverse of summation of beta_sq}
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients if mcmc_output is true. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
 //'}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_logit_reg(n=2000,p=20,X_cor=0.5,X_var=1,q=10,beta_size=5)
-//'split <- train_test_splits(dat1$n)
-//'dat1$train_idx <- split$train_idx
-//'dat1$test_idx <- split$test_idx
-//'res1 <- with(dat1,fast_mfvb_normal_logit_single(y[train_idx],X[train_idx,]))
-//'res1_mcmc <- with(dat1,fast_normal_logit(y[train_idx],X[train_idx,]))
-//'res1_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
-//'
-//'
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_mcmc$post_mean$betacoef)),
-//'time=c(res1$elapsed,res1_glmnet$elapsed,
-//'res1_mcmc$elapsed))
-//'
-//'rownames(tab)<-c("n = 2000, p = 20 MFVB","n = 2000, p = 20 glmnet",
-//'"n = 2000, p = 20 MCMC")
-//'normal_logit_tab <- tab
-//'print(normal_logit_tab)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=1)
+//'trials <- rpois(2000,5)+1
+//'y <- rbinom(2000,trials,dat$prob)
+//'res <- fast_binomial_single_gibbs(y,trials,dat$X,prior="horseshoe")
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X,
-                                          int max_iter = 5000,
-                                          double tol = 1e-05,
-                                          double A = 10,
-                                          double in_E_inv_tau_sq = 1,
-                                          Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue,
-                                          Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue){
+ Rcpp::List fast_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::mat& X,
+                                       std::string prior = "normal",
+                                       int mcmc_sample = 500,
+                                       int burnin = 500, int thinning = 1,
+                                       double A_tau = 1, double A_lambda = 1,
+                                       bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	binomial_pg_param(kappa, b, y, trials);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
+//'@title Bayesian binomial logistic regression with sparse predictors by single variable update Gibbs sampler
+//'@param y vector of n success counts
+//'@param trials vector of n numbers of trials, or a single number shared by all observations
+//'@param X n x p sparse matrix of candidate predictors
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=1,density=0.1)
+//'y <- rbinom(2000,5,dat$prob)
+//'res <- sparse_binomial_single_gibbs(y,5,dat$X)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List sparse_binomial_single_gibbs(arma::vec& y, arma::vec& trials, arma::sp_mat& X,
+                                         std::string prior = "normal",
+                                         int mcmc_sample = 500,
+                                         int burnin = 500, int thinning = 1,
+                                         double A_tau = 1, double A_lambda = 1,
+                                         bool mcmc_output = true){
  	arma::wall_clock timer;
  	timer.tic();
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	binomial_pg_param(kappa, b, y, trials);
+ 	sparse_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
+//'@title Bayesian binomial logistic regression with big.matrix predictors by single variable update Gibbs sampler
+//'@param y vector of n success counts
+//'@param trials vector of n numbers of trials, or a single number shared by all observations
+//'@param bigX address of an n x p big.matrix of type double of candidate predictors
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=1)
+//'y <- rbinom(2000,5,dat$prob)
+//'X <- as.big.matrix(dat$X)
+//'res <- big_binomial_single_gibbs(y,5,X@address)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List big_binomial_single_gibbs(arma::vec& y, arma::vec& trials, SEXP bigX,
+                                      std::string prior = "normal",
+                                      int mcmc_sample = 500,
+                                      int burnin = 500, int thinning = 1,
+                                      double A_tau = 1, double A_lambda = 1,
+                                      bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	binomial_pg_param(kappa, b, y, trials);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 	int p = X.n_cols;
- 	int n = X.n_rows;
-
- 	mat X2 = X%X;
- 	vec E_omega;
- 	vec E_beta, E_beta_0;
- 	if(in_E_omega.isNull()){
- 		E_omega.ones(n);
- 	} else{
- 		E_omega = Rcpp::as<arma::vec>(in_E_omega);
- 	}
+//'@title Fast Bayesian negative binomial regression by single variable update Gibbs sampler
+//'@param y vector of n nonnegative counts
+//'@param X n x p matrix of candidate predictors
+//'@param r dispersion (number of failures) parameter of the negative binomial
+//'distribution; the mean of y is r*exp(mu)
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs};
+//'prob is the success probability 1/(1+exp(-mu)) of the negative binomial distribution
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=0.5)
+//'mu <- dat$X%*%dat$betacoef
+//'y <- rnbinom(2000,size=2,mu=2*exp(mu))
+//'res <- fast_negbin_single_gibbs(y,dat$X,r=2,prior="horseshoe")
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_negbin_single_gibbs(arma::vec& y, arma::mat& X, double r = 1,
+                                     std::string prior = "normal",
+                                     int mcmc_sample = 500,
+                                     int burnin = 500, int thinning = 1,
+                                     double A_tau = 1, double A_lambda = 1,
+                                     bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	negbin_pg_param(kappa, b, y, r);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 	if(in_E_beta.isNull()){
- 		E_beta.zeros(p);
- 	} else{
- 		E_beta = Rcpp::as<arma::vec>(in_E_beta);
- 	}
+//'@title Bayesian negative binomial regression with sparse predictors by single variable update Gibbs sampler
+//'@param y vector of n nonnegative counts
+//'@param X n x p sparse matrix of candidate predictors
+//'@param r dispersion (number of failures) parameter of the negative binomial
+//'distribution; the mean of y is r*exp(mu)
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=0.5,density=0.1)
+//'y <- rnbinom(2000,size=2,mu=2*exp(as.vector(dat$X%*%dat$betacoef)))
+//'res <- sparse_negbin_single_gibbs(y,dat$X,r=2)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List sparse_negbin_single_gibbs(arma::vec& y, arma::sp_mat& X, double r = 1,
+                                       std::string prior = "normal",
+                                       int mcmc_sample = 500,
+                                       int burnin = 500, int thinning = 1,
+                                       double A_tau = 1, double A_lambda = 1,
+                                       bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	negbin_pg_param(kappa, b, y, r);
+ 	sparse_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 	double A_sq = A*A;
- 	double E_inv_tau_sq = in_E_inv_tau_sq;
- 	vec Var_beta;
- 	Var_beta.ones(p);
- 	vec E_mu;
- 	E_mu.zeros(n);
+//'@title Bayesian negative binomial regression with big.matrix predictors by single variable update Gibbs sampler
+//'@param y vector of n nonnegative counts
+//'@param bigX address of an n x p big.matrix of type double of candidate predictors
+//'@param r dispersion (number of failures) parameter of the negative binomial
+//'distribution; the mean of y is r*exp(mu)
+//'@param prior "normal" or "horseshoe" prior of the regression coefficients
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=0.5)
+//'y <- rnbinom(2000,size=2,mu=2*exp(as.vector(dat$X%*%dat$betacoef)))
+//'X <- as.big.matrix(dat$X)
+//'res <- big_negbin_single_gibbs(y,X@address,r=2)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List big_negbin_single_gibbs(arma::vec& y, SEXP bigX, double r = 1,
+                                    std::string prior = "normal",
+                                    int mcmc_sample = 500,
+                                    int burnin = 500, int thinning = 1,
+                                    double A_tau = 1, double A_lambda = 1,
+                                    bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	negbin_pg_param(kappa, b, y, r);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, count_prior_horseshoe(prior),
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
+// single variable update Gibbs sampler for the linear regression with
+// horseshoe priors beta_k ~ N(0, sigma2_eps*tau2*lambda_k^2); only the
+// residual y - X*beta is stored, so the design is read one column at a time
+template<typename Design>
+Rcpp::List implicit_horseshoe_lm_single_gibbs(arma::vec& y, const Design& Z,
+                                              int mcmc_sample, int burnin, int thinning,
+                                              double a_sigma, double b_sigma,
+                                              double A_tau, double A_lambda, bool mcmc_output){
+ 	int p = Z.n_cols();
+ 	int n = Z.n_rows();
 
- 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
- 	arma::mat I_p = eye(p,p);
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
+ 	}
+ 	double b_tau = 1;
+ 	double tau2 = 1.0/p;
 
- 	vec list_E_inv_tau_sq, list_E_sum_beta_sq;
- 	list_E_inv_tau_sq.zeros(max_iter);
- 	list_E_sum_beta_sq.zeros(max_iter);
- 	vec E_Zbeta_sq, Var_Zbeta;
- 	mat Cov_beta;
- 	mat S;
+ 	arma::vec betacoef;
+ 	betacoef.zeros(p);
+ 	arma::vec inv_lambda2;
+ 	inv_lambda2.ones(p);
+ 	arma::vec b_lambda;
+ 	b_lambda.ones(p);
+ 	arma::vec eps = y;
+ 	arma::vec xx(p);
+ 	arma::vec w = arma::ones<arma::vec>(n);
+ 	for(int k=0;k<p;k++){
+ 		double s_k;
+ 		xx(k) = Z.wdot(k, w, eps, s_k);
+ 	}
 
- 	double convergence = 1;
- 	int iter = 0;
- 	for(iter=0; iter<max_iter; iter++){
- 		//Update E_beta
- 		//std::cout << "beta" << std::endl;
- 		for(int k=0;k<p;k++){
- 			Var_beta(k) = accu(E_omega%X2.col(k));
- 		}
- 		Var_beta += E_inv_tau_sq;
- 		Var_beta = 1.0/Var_beta;
+ 	arma::mat betacoef_list;
+ 	arma::vec betacoef_mean;
+ 	arma::vec lambda_mean;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
+ 	betacoef_mean.zeros(p);
+ 	lambda_mean.zeros(p);
+ 	if(mcmc_output)
+ 		betacoef_list.zeros(p,mcmc_sample);
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
 
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update beta; on saved iterations the conditional means are
+ 		//accumulated for the Rao-Blackwellized posterior mean
+ 		bool rb_iter = iter>=burnin && (iter-burnin+1)%thinning==0;
+ 		double inv_tau2 = 1.0/tau2;
  		for(int k=0;k<p;k++){
- 			vec E_mu_k = E_mu - E_beta(k)*X.col(k);
- 			E_mu = E_mu_k;
- 			E_mu_k %= -E_omega;
- 			E_mu_k += y_s;
- 			E_beta(k) = arma::accu(E_mu_k%X.col(k));
- 			E_beta(k) *= Var_beta(k);
- 			E_mu += E_beta(k)*X.col(k);
+ 			double beta_old = betacoef(k);
+ 			double beta_prec = xx(k) + inv_tau2*inv_lambda2(k);
+ 			double beta_mean = (Z.dot(k, eps) + xx(k)*beta_old)/beta_prec;
+ 			if(rb_iter)
+ 				betacoef_mean(k) += beta_mean;
+ 			betacoef(k) = beta_mean + sqrt(sigma2_eps/beta_prec)*arma::randn<double>();
+ 			Z.axpy(k, beta_old - betacoef(k), eps);
  		}
 
-
- 		if(accu(abs(E_beta-E_beta_0))<tol){
- 			convergence = 0;
- 			break;
+ 		//update lambda
+ 		arma::vec betacoef2 = betacoef%betacoef;
+ 		inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 		inv_lambda2 /= b_lambda + 0.5*betacoef2*inv_tau2/sigma2_eps;
+ 		b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 		b_lambda /= 1.0/A2_lambda+inv_lambda2;
+
+ 		//update tau2, sigma2_eps and b_tau
+ 		double sum_eps2 = arma::accu(eps%eps);
+ 		double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 		inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
+ 		b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+ 		tau2 = 1.0/inv_tau2;
+ 		double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2.0, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 		sigma2_eps = 1.0/inv_sigma2_eps;
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			lambda_mean += sqrt(1.0/inv_lambda2);
+ 			if(mcmc_output)
+ 				betacoef_list.col(mcmc_iter) = betacoef;
+ 			sigma2_eps_list(mcmc_iter) = sigma2_eps;
+ 			tau2_list(mcmc_iter) = tau2;
  		}
+ 	}
 
- 		//update sum_E_beta_sq
- 		double E_sum_beta_sq = accu(E_beta%E_beta) + accu(Var_beta);
+ 	betacoef = betacoef_mean/mcmc_sample;
 
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = Z.times(betacoef),
+                                            Named("betacoef") = betacoef,
+                                            Named("lambda") = lambda_mean/mcmc_sample,
+                                            Named("sigma2_eps") = arma::mean(sigma2_eps_list),
+                                            Named("tau2") = arma::mean(tau2_list));
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc);
+}
 
+//'@title Bayesian linear regression with horseshoe priors and sparse predictors by single variable update Gibbs sampler
+//'@param y vector of n outcome variables
+//'@param X n x p sparse matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{tau2}{posterior mean of the global parameter}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients if mcmc_output is true}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=2000,p=500,X_cor=0.5,q=6)
+//'X <- Matrix::Matrix(dat$X*(abs(dat$X)>1),sparse=TRUE)
+//'y <- as.vector(X%*%dat$betacoef) + rnorm(2000)
+//'res <- sparse_horseshoe_lm_single_gibbs(y,X)
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List sparse_horseshoe_lm_single_gibbs(arma::vec& y, arma::sp_mat& X,
+                                             int mcmc_sample = 500,
+                                             int burnin = 500, int thinning = 1,
+                                             double a_sigma = 0.0, double b_sigma = 0.0,
+                                             double A_tau = 1, double A_lambda = 1,
+                                             bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	sparse_design Z(X);
+ 	Rcpp::List res = implicit_horseshoe_lm_single_gibbs(y, Z, mcmc_sample, burnin, thinning,
+                                                     a_sigma, b_sigma, A_tau, A_lambda,
+                                                     mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 		//Update E_omega
- 		//std::cout << "E_omega" << std::endl;
- 		vec E_Zbeta = X*E_beta;
- 		Var_Zbeta = X2*Var_beta;
+//'@title Bayesian linear regression with horseshoe priors and big.matrix predictors by single variable update Gibbs sampler
+//'@param y vector of n outcome variables
+//'@param bigX address of an n x p big.matrix of type double of candidate predictors;
+//'the columns are streamed one at a time, so a filebacked.big.matrix need not fit in memory
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{sparse_horseshoe_lm_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'X <- filebacked.big.matrix(1000,5000,type="double",backingfile="X_hs.bin",
+//'descriptorfile="X_hs.desc",backingpath=tempdir())
+//'dat <- sim_linear_reg_big(X@address,q=6,X_cor=0.5)
+//'res <- big_horseshoe_lm_single_gibbs(dat$y,X@address)
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List big_horseshoe_lm_single_gibbs(arma::vec& y, SEXP bigX,
+                                          int mcmc_sample = 500,
+                                          int burnin = 500, int thinning = 1,
+                                          double a_sigma = 0.0, double b_sigma = 0.0,
+                                          double A_tau = 1, double A_lambda = 1,
+                                          bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_horseshoe_lm_single_gibbs(y, Z, mcmc_sample, burnin, thinning,
+                                                     a_sigma, b_sigma, A_tau, A_lambda,
+                                                     mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 		E_Zbeta_sq = E_Zbeta%E_Zbeta + Var_Zbeta;
- 		vec sqrt_E_Zbeta_sq = sqrt(E_Zbeta_sq);
- 		E_omega = tanh(sqrt_E_Zbeta_sq*0.5)/(2*sqrt_E_Zbeta_sq);
- 		//Update E_inv_tau_sq
- 		//std::cout << "E_inv_tau_sq" << std::endl;
- 		double C = E_sum_beta_sq/A_sq;
- 		double bs = C + 1.0 - p;
- 		if(E_sum_beta_sq != 0){
- 			E_inv_tau_sq = (-bs + sqrt(bs*bs+4*(1.0+p)*C))/(2*E_sum_beta_sq);
- 		}
- 		list_E_inv_tau_sq(iter) = E_inv_tau_sq;
- 		list_E_sum_beta_sq(iter) = E_sum_beta_sq;
- 	}
+//'@title Bayesian logistic regression with horseshoe priors and sparse predictors by single variable update Gibbs sampler
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p sparse matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.5,X_var=1,q=10,beta_size=1,density=0.1)
+//'res <- sparse_horseshoe_logit_single_gibbs(dat$y,dat$X)
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List sparse_horseshoe_logit_single_gibbs(arma::vec& y, arma::sp_mat& X,
+                                                int mcmc_sample = 500,
+                                                int burnin = 500, int thinning = 1,
+                                                double A_tau = 1, double A_lambda = 1,
+                                                bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	arma::vec trials = arma::ones<arma::vec>(1);
+ 	binomial_pg_param(kappa, b, y, trials);
+ 	sparse_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, true,
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
+ }
 
- 	double elapsed = timer.toc();
- 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = E_beta,
-                                            Named("inv_tau_sq") = E_inv_tau_sq,
-                                            Named("omega") = E_omega);
- 	Rcpp::List trace = Rcpp::List::create(Named("inv_tau_sq") = list_E_inv_tau_sq,
-                                        Named("sum_beta_sq") = list_E_sum_beta_sq);
- 	Rcpp::List output = Rcpp::List::create(Named("post_mean") = post_mean,
-                                         Named("trace") = trace,
-                                         Named("iter") = iter,
-                                         Named("convergence") = convergence,
-                                         Named("elapsed") = elapsed);
- 	return output;
+//'@title Bayesian logistic regression with horseshoe priors and big.matrix predictors by single variable update Gibbs sampler
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param bigX address of an n x p big.matrix of type double of candidate predictors;
+//'the columns are streamed one at a time, so a filebacked.big.matrix need not fit in memory
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value indicating whether to return the MCMC samples of the coefficients; Default value is true
+//'@return a list object with the same components as \link{fast_binomial_single_gibbs}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'X <- filebacked.big.matrix(1000,2000,type="double",backingfile="X_hs_logit.bin",
+//'descriptorfile="X_hs_logit.desc",backingpath=tempdir())
+//'dat <- sim_logit_reg_big(X@address,q=10,X_var=1)
+//'res <- big_horseshoe_logit_single_gibbs(dat$y,X@address)
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List big_horseshoe_logit_single_gibbs(arma::vec& y, SEXP bigX,
+                                             int mcmc_sample = 500,
+                                             int burnin = 500, int thinning = 1,
+                                             double A_tau = 1, double A_lambda = 1,
+                                             bool mcmc_output = true){
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	Rcpp::XPtr<BigMatrix> xpMat(bigX);
+ 	check_big_double(xpMat);
+ 	arma::mat X((double*)xpMat->matrix(),xpMat->nrow(),xpMat->ncol(),false,true);
+ 	arma::vec kappa;
+ 	arma::vec b;
+ 	arma::vec trials = arma::ones<arma::vec>(1);
+ 	binomial_pg_param(kappa, b, y, trials);
+ 	dense_design Z(X);
+ 	Rcpp::List res = implicit_count_single_gibbs(kappa, b, Z, true,
+                                              mcmc_sample, burnin, thinning,
+                                              A_tau, A_lambda, mcmc_output);
+ 	return count_single_gibbs_output(res, timer.toc());
  }
 
-//'@title Fast mean field varational Bayesian multinomial logistic regression with normal priors
+//'@title Fast Bayesian multinomial logistic regression with normal priors
 //'@param y vector of n multiclass outcome variables taking values 0,...,M-1
 //'@param X n x p matrix of candidate predictors
 //'@param num_class an integer indicating the number of classes
@@ -2784,16 +4408,16 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'set.seed(2022)
 //'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
 //'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
-//'Bayes_res <- with(dat,fast_mfvb_multiclass(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
+//'Bayes_res <- with(dat,fast_normal_multiclass(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
 //'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
 //'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
 //'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class,
-                                 int mcmc_sample = 500,
-                                 int burnin = 500, int thinning = 1,
-                                 double A_tau = 1){
+ Rcpp::List fast_normal_multiclass(arma::vec& y, arma::mat& X, int num_class,
+                                   int mcmc_sample = 500,
+                                   int burnin = 500, int thinning = 1,
+                                   double A_tau = 1){
 
  	arma::wall_clock timer;
  	timer.tic();
@@ -2839,9 +4463,10 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 
 
  		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
- 		arma::vec log_prob = mu.col(k-1);
- 		log_1_prob.col(k-1) = -log1pexp(log_prob);
- 		log_prob += log_1_prob.col(k-1);
+ 		arma::vec log_prob;
+ 		arma::vec log_1_prob_k;
+ 		log_sigmoid_both(mu.col(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.col(k-1) = log_1_prob_k;
  		prob.col(k-1) = log_prob;
  		if(k<num_class-1){
  			for(int j=k; j<num_class-1;j++){
@@ -2869,129 +4494,138 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
- void one_step_logit_horseshoe_big_n(arma::vec& betacoef, double& tau2, double& b_tau,
-                                     arma::vec& omega, arma::vec& lambda, arma::vec& b_lambda,
-                                     arma::vec& mu, arma::vec& y_s, arma::vec& Xty_s, arma::mat& X,
-                                     double& A2_tau, double& A2_lambda,
-                                     int& p, int& n, Rcpp::Function& pgdraw){
-
- 	//update beta
- 	double inv_tau2 = 1.0/tau2;
- 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
- 	arma::mat OmegaX = X;
- 	for(int j=0;j<p;j++){
- 		OmegaX.col(j) %= omega;
- 	}
- 	arma::mat XtX = X.t()*OmegaX;
- 	XtX.diag() += inv_tau2*inv_lambda2;
- 	arma::mat R = arma::chol(XtX);
- 	arma::vec b = arma::solve(R.t(),Xty_s,solve_opts::fast);
- 	arma::vec alpha;
- 	alpha.randn(p);
- 	betacoef = arma::solve(R,alpha+b,solve_opts::fast);
-
- 	//update omega
- 	mu = X*betacoef;
- 	omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
-
- 	//update tau2
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
- 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
- 	tau2 = 1.0/inv_tau2;
-
- 	//update lambda
- 	inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	lambda = sqrt(1.0/inv_lambda2);
-
- }
-
- void one_step_logit_horseshoe_big_p(arma::vec& betacoef, double& tau2, double& b_tau,
-                                     arma::vec& omega,arma::vec& lambda, arma::vec& b_lambda,
-                                     arma::vec& mu, arma::vec& y_s, arma::mat& X,
-                                     double& A2_tau, double& A2_lambda,
-                                     int& p, int& n,
-                                     Rcpp::Function& pgdraw){
-
- 	//update beta
- 	arma::vec inv_omega = 1.0/omega;
- 	arma::vec alpha1;
- 	alpha1.randn(p);
- 	alpha1 *= sqrt(tau2);
- 	alpha1 %= lambda;
- 	arma::vec alpha2;
- 	alpha2.randn(n);
- 	alpha2 %= sqrt(inv_omega);
- 	arma::mat XLambda = X;
- 	for(int i=0;i<n;i++){
- 		XLambda.row(i) %= lambda.t();
- 	}
- 	arma::mat Omega0 = XLambda*XLambda.t();
-
- 	Omega0.diag() += inv_omega/tau2;
 
+//'@title Fast Bayesian multinomial logistic regression with normal priors using single gibbs samplers
+//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
+//'@param X n x p matrix of candidate predictors
+//'@param num_class an integer indicating the number of classes
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
+//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
+//'Bayes_res <- with(dat,fast_normal_multiclass_single_gibbs(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
+//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
+//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
+//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class,
+                                                int mcmc_sample = 500,
+                                                int burnin = 500, int thinning = 1,
+                                                double A_tau = 1,
+                                                int verbose = 0){
 
- 	arma::vec beta_s = arma::solve(Omega0, y_s%inv_omega - X*alpha1 - alpha2);
- 	betacoef = alpha1 + lambda%(XLambda.t()*beta_s);
+ 	arma::wall_clock timer;
+ 	timer.tic();
 
- 	//update omega
- 	mu = X*betacoef;
- 	omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+ 	arma::mat betacoef;
+ 	arma::vec tau2;
+ 	arma::mat mu;
+ 	arma::mat prob;
+ 	arma::mat log_1_prob;
+ 	arma::cube betacoef_list;
+ 	arma::mat tau2_list;
+ 	betacoef.zeros(X.n_cols,num_class-1);
+ 	mu.zeros(X.n_rows,num_class-1);
+ 	prob.zeros(X.n_rows,num_class-1);
+ 	tau2.zeros(num_class-1);
+ 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
+ 	tau2_list.zeros(mcmc_sample,num_class-1);
+ 	log_1_prob.zeros(X.n_rows,num_class-1);
 
- 	//update lambda
- 	//arma::vec betacoef2 = betacoef%betacoef;
 
- 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
- 	// arma::vec B = 0.5*betacoef2/tau2;
- 	// b_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
- 	// arma::vec upsilon = arma::randu<arma::vec>(p);
- 	// arma::vec C = 1.0/b_lambda - 1.0/A2_lambda;
- 	// inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
+ 	for(int k=num_class-1;k>=1;k--){
+ 		arma::uvec idx1 = arma::find(y==k);
+ 		arma::uvec idx0 = arma::find(y<k);
+ 		arma::vec y01;
+ 		int n01 = idx0.n_elem+idx1.n_elem;
+ 		y01.zeros(n01);
+ 		y01.rows(idx0.n_elem,n01-1) += 1.0;
+ 		arma::mat X01;
+ 		X01.zeros(n01,X.n_cols);
+ 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
+ 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
+ 		Rcpp::List fit01 = fast_normal_logit_single_gibbs(y01,X01,mcmc_sample,burnin,thinning,A_tau,verbose);
+ 		Rcpp::List post_mean01 = fit01["post_mean"];
+ 		Rcpp::List mcmc01 = fit01["mcmc"];
+ 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
+ 		betacoef_list.slice(k-1) = temp_betacoef_list;
+ 		arma::vec temp_tau2_list = mcmc01["tau2"];
+ 		tau2_list.col(k-1) = temp_tau2_list;
 
- 	// arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	// inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
- 	// b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	// b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 		arma::vec temp_beta = post_mean01["betacoef"];
+ 		betacoef.col(k-1) = temp_beta;
+ 		mu.col(k-1) = X*temp_beta;
 
- 	//lambda = sqrt(1.0/inv_lambda2);
 
+ 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
+ 		arma::vec log_prob;
+ 		arma::vec log_1_prob_k;
+ 		log_sigmoid_both(mu.col(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.col(k-1) = log_1_prob_k;
+ 		prob.col(k-1) = log_prob;
+ 		if(k<num_class-1){
+ 			for(int j=k; j<num_class-1;j++){
+ 				prob.col(k-1) += log_1_prob.col(j);
+ 			}
+ 		}
+ 		double temp_tau2 = post_mean01["tau2"];
+ 		tau2(k-1) = temp_tau2;
+ 	}
 
- 	//update tau2
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
- 	double inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
- 	tau2 = 1.0/inv_tau2;
+ 	prob = exp(prob);
+ 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
+ 	prob = arma::join_rows(prob0,prob);
 
- 	//update lambda
- 	inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	lambda = sqrt(1.0/inv_lambda2);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2,
+                                            Named("mu") = mu,
+                                            Named("prob") = prob);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list);
 
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
  }
 
 
-
-//'@title Fast Bayesian logistic regression with horseshoe priors
-//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@title Memory efficient Bayesian multinomial logistic regression with normal priors using single gibbs samplers
+//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
 //'@param X n x p matrix of candidate predictors
+//'@param num_class an integer indicating the number of classes
 //'@param mcmc_sample number of MCMC iterations saved
 //'@param burnin number of iterations before start to save
 //'@param thinning number of iterations to skip between two saved iterations
 //'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
 //'@return a list object consisting of three components
 //'\describe{
-//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
 //'\describe{
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
 //'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
-//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
 //'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
 //'\item{prob}{a vector of posterior predictive probability of the n training sample}
 //'}
@@ -2999,127 +4633,94 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
 //'\describe{
 //'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
 //'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
-//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters. Each column is one MCMC sample}
 //'}
 //'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res1 <- with(dat1,fast_horseshoe_logit(y,X,A_tau=0.001,A_lambda=0.001))
-//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
-//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
-//'res2 <- with(dat2,fast_horseshoe_logit(y,X,burnin=5000,mcmc_sample=500,A_tau=0.001,A_lambda=0.001))
-//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
-//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
-//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
-//'normal_logit_tab <- tab
-//'print(normal_logit_tab)
+//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
+//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
+//'Bayes_res <- with(dat,scalable_normal_multiclass_single_gibbs(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
+//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
+//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
+//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X,
-                                 int mcmc_sample = 500,
-                                 int burnin = 500, int thinning = 1,
-                                 double A_tau = 1, double A_lambda = 1){
+ Rcpp::List scalable_normal_multiclass_single_gibbs(arma::vec& y, arma::mat& X, int num_class,
+                                                    int mcmc_sample = 500,
+                                                    int burnin = 500, int thinning = 1,
+                                                    double A_tau = 1,
+                                                    int verbose = 0){
 
  	arma::wall_clock timer;
  	timer.tic();
 
-
- 	int p = X.n_cols;
- 	int n = X.n_rows;
-
- 	double A2_tau = A_tau*A_tau;
- 	double b_tau = A2_tau;
- 	double tau2 = b_tau;
- 	double A2_lambda = A_lambda*A_lambda;
-
- 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
+ 	arma::mat betacoef;
+ 	arma::vec tau2;
+ 	arma::mat mu;
+ 	arma::mat prob;
+ 	arma::mat log_1_prob;
+ 	arma::cube betacoef_list;
+ 	arma::mat tau2_list;
+ 	betacoef.zeros(X.n_cols,num_class-1);
+ 	mu.zeros(X.n_rows,num_class-1);
+ 	prob.zeros(X.n_rows,num_class-1);
+ 	tau2.zeros(num_class-1);
+ 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
+ 	tau2_list.zeros(mcmc_sample,num_class-1);
+ 	log_1_prob.zeros(X.n_rows,num_class-1);
 
 
- 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
- 	Rcpp::Function pgdraw = pkg["pgdraw"];
- 	Rcpp::NumericVector zeros(n,0.0);
- 	arma::vec betacoef;
- 	arma::vec lambda;
- 	arma::vec b_lambda;
- 	arma::vec mu;
-
- 	lambda.ones(p);
- 	b_lambda.ones(p);
- 	betacoef.zeros(p);
- 	mu.zeros(n);
- 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
-
- 	arma::mat betacoef_list;
- 	arma::mat lambda_list;
- 	arma::vec tau2_list;
+ 	for(int k=num_class-1;k>=1;k--){
+ 		arma::uvec idx1 = arma::find(y==k);
+ 		arma::uvec idx0 = arma::find(y<k);
+ 		arma::vec y01;
+ 		int n01 = idx0.n_elem+idx1.n_elem;
+ 		y01.zeros(n01);
+ 		y01.rows(idx0.n_elem,n01-1) += 1.0;
+ 		arma::mat X01;
+ 		X01.zeros(n01,X.n_cols);
+ 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
+ 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
+ 		Rcpp::List fit01 = fast_normal_logit_single_gibbs(y01,X01,mcmc_sample,burnin,thinning,A_tau,verbose);
+ 		Rcpp::List post_mean01 = fit01["post_mean"];
+ 		Rcpp::List mcmc01 = fit01["mcmc"];
+ 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
+ 		betacoef_list.slice(k-1) = temp_betacoef_list;
+ 		arma::vec temp_tau2_list = mcmc01["tau2"];
+ 		tau2_list.col(k-1) = temp_tau2_list;
 
- 	betacoef_list.zeros(p,mcmc_sample);
- 	lambda_list.zeros(p,mcmc_sample);
- 	tau2_list.zeros(mcmc_sample);
+ 		arma::vec temp_beta = post_mean01["betacoef"];
+ 		betacoef.col(k-1) = temp_beta;
+ 		mu.col(k-1) = X*temp_beta;
 
 
- 	if(p<n){
- 		arma::vec Xty_s = X.t()*y_s;
- 		for(int iter=0;iter<burnin;iter++){
- 			one_step_logit_horseshoe_big_n(betacoef, tau2, b_tau,
-                                   omega, lambda, b_lambda,mu,
-                                   y_s, Xty_s,  X,
-                                   A2_tau, A2_lambda, p, n, pgdraw);
- 		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				one_step_logit_horseshoe_big_n(betacoef, tau2, b_tau,
-                                    omega, lambda, b_lambda,mu,
-                                    y_s, Xty_s,  X,
-                                    A2_tau, A2_lambda, p, n, pgdraw);
- 			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			tau2_list(iter) = tau2;
- 		}
- 	} else{
- 		//arma::mat XXt = X*X.t();
- 		tau2 = 1.0/p;
- 		for(int iter=0;iter<burnin;iter++){
- 			one_step_logit_horseshoe_big_p(betacoef, tau2, b_tau,
-                                   omega, lambda, b_lambda, mu,
-                                   y_s,  X,
-                                   A2_tau, A2_lambda, p, n, pgdraw);
- 		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				one_step_logit_horseshoe_big_p(betacoef, tau2, b_tau,
-                                    omega,lambda, b_lambda, mu,
-                                    y_s,  X,
-                                    A2_tau, A2_lambda, p, n, pgdraw);
+ 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
+ 		arma::vec log_prob;
+ 		arma::vec log_1_prob_k;
+ 		log_sigmoid_both(mu.col(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.col(k-1) = log_1_prob_k;
+ 		prob.col(k-1) = log_prob;
+ 		if(k<num_class-1){
+ 			for(int j=k; j<num_class-1;j++){
+ 				prob.col(k-1) += log_1_prob.col(j);
  			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			tau2_list(iter) = tau2;
  		}
-
+ 		double temp_tau2 = post_mean01["tau2"];
+ 		tau2(k-1) = temp_tau2;
  	}
 
- 	betacoef = arma::mean(betacoef_list,1);
- 	tau2 = arma::mean(tau2_list);
- 	mu =  X*betacoef;
+ 	prob = exp(prob);
+ 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
+ 	prob = arma::join_rows(prob0,prob);
 
  	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
                                             Named("tau2") = tau2,
-                                            Named("lambda") = lambda,
                                             Named("mu") = mu,
-                                            Named("prob") = 1.0/(1.0+exp(-mu)));
+                                            Named("prob") = prob);
  	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                       Named("tau2") = tau2_list,
-                                       Named("lambda") = lambda_list);
+                                       Named("tau2") = tau2_list);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
@@ -3127,1719 +4728,4922 @@ Rcpp::List fast_normal_multi_lm(arma::mat& y, arma::mat& X,
                             Named("elapsed") = elapsed);
  }
 
-
-//'@title Simulate left standard truncated normal distribution
-//'@param n sample size
-//'@param lower the lower bound
-//'@return a vector of random numbers from a left standard truncated
-//'normal distribution
+//'@title Fast mean field variational Bayesian logistic regression with normal priors
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param max_iter maximum number of iterations
+//'@param tol the tolerance for the parameter changes
+//'@param A scale parameter in the half Cauchy prior for regression coefficients
+//'@param in_E_inv_tau_sq numeric scalar for the initial value for inverse of tau squared
+//'@param in_E_omega numeric vector of length n for the initial values for all omega's
+//'@param in_E_beta  numeric vector of length p for the initial values for all beta's
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{inv_tau_sq}{posterior mean of inverse tau square}
+//'\item{omega}{a vector of posterior mean of omega}
+//'}
+//'\item{trace}{a list object of two components for the trace of parameter updates}
+//'\describe{
+//'\item{inv_tau_sq}{a vector of trace for inverse of tau_sq}
+//'\item{sum_beta_sq}{a vector of trace for inverse of summation of beta_sq}
+//'}
+//'\item{elapsed}{running time}
+//'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'r0 <- rand_left_trucnorm0(1000, lower=2)
-//'hist(r0)
+//'set.seed(2022)
+//'dat1 <- sim_logit_reg(n=2000,p=20,X_cor=0.5,X_var=1,q=10,beta_size=5)
+//'split <- train_test_splits(nrow(dat1$X))
+//'dat1$train_idx <- split$train_idx
+//'dat1$test_idx <- split$test_idx
+//'res1 <- with(dat1,fast_mfvb_normal_logit(y[train_idx],X[train_idx,]))
+//'res1_mcmc <- with(dat1,fast_normal_logit(y[train_idx],X[train_idx,]))
+//'res1_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
+//'dat2 <- sim_logit_reg(n=200,p=400,X_cor=0.5,X_var=2,q=10,beta_size=1)
+//'split <- train_test_splits(nrow(dat2$X))
+//'dat2$train_idx <- split$train_idx
+//'dat2$test_idx <- split$test_idx
+//'res2 <- with(dat2,fast_mfvb_normal_logit(y[train_idx],X[train_idx,]))
+//'res2_mcmc <- with(dat2,fast_normal_logit(y[train_idx],X[train_idx,]))
+//'res2_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
+//'tab1 <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_mcmc$post_mean$betacoef)),
+//'time=c(res1$elapsed,res1_glmnet$elapsed,
+//'res1_mcmc$elapsed))
+//'tab2 <- data.frame(rbind(comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2_mcmc$post_mean$betacoef)),
+//'time=c(res2$elapsed,res2_glmnet$elapsed,
+//'res2_mcmc$elapsed))
+//'rownames(tab1)<-c("n = 2000, p = 20 MFVB","n = 2000, p = 20 glmnet",
+//'"n = 2000, p = 20 MCMC")
+//'rownames(tab2)<-c("n = 200, p = 400 MFVB","n = 200, p = 400 glmnet",
+//'"n = 200, p = 400 MCMC")
+//'mfvb_logit_tab <- rbind(tab1,tab2)
+//'print(mfvb_logit_tab)
 //'@export
 //[[Rcpp::export]]
- arma::vec rand_left_trucnorm0(int n, double lower, double ratio=1.0){
- 	arma::vec y = arma::zeros<arma::vec>(n);
- 	int m = 0;
- 	if(lower<=0){
- 		arma::vec z = arma::randn<arma::vec>(ceil(ratio*(n - m)));
- 		arma::uvec idx = arma::find(z>lower);
- 		m += idx.n_elem;
- 		if(idx.n_elem>0){
- 			if(m<=n)
- 				y.subvec(0,m-1) = z.elem(idx);
- 			else
- 				y = z.elem(idx.subvec(0,n-1));
- 		}
- 		while(m < n){
- 			z = arma::randn<arma::vec>(ceil(ratio*(n - m)));
- 			idx = arma::find(z>lower);
- 			if(idx.n_elem>0){
- 				if(m + idx.n_elem <= n)
- 					y.subvec(m, m + idx.n_elem - 1) = z.elem(idx);
- 				else
- 					y.subvec(m,n-1) = z.elem(idx.subvec(0,n-m-1));
- 				m += idx.n_elem;
- 			}
- 		}
+ Rcpp::List fast_mfvb_normal_logit(arma::vec& y, arma::mat& X,
+                                   int max_iter = 5000,
+                                   double tol = 1e-05,
+                                   double A = 10,
+                                   double in_E_inv_tau_sq = 1,
+                                   Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue,
+                                   Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+
+ 	vec E_omega;
+ 	vec E_beta, E_beta_0;
+ 	if(in_E_omega.isNull()){
+ 		E_omega.ones(n);
  	} else{
- 		double alpha_star = 0.5*(lower+sqrt(lower*lower+4.0));
- 		arma::vec z = lower - log(arma::randu<arma::vec>(ceil(ratio*n)))/alpha_star;
- 		arma::vec log_rho_z = (z - alpha_star);
- 		log_rho_z %= -0.5*log_rho_z;
- 		arma::vec u = arma::randu<arma::vec>(ceil(ratio*n));
- 		arma::uvec idx = arma::find(log(u) < log_rho_z);
- 		m += idx.n_elem;
- 		if(idx.n_elem>0){
- 			if(m<=n)
- 				y.subvec(0,m-1) = z.elem(idx);
- 			else
- 				y = z.elem(idx.subvec(0,n-1));
- 		}
- 		while(m < n){
- 			z = lower - log(arma::randu<arma::vec>(ceil(ratio*(n - m))))/alpha_star;
- 			log_rho_z = (z - alpha_star);
- 			log_rho_z %= -0.5*log_rho_z;
- 			u = arma::randu<arma::vec>(ceil(ratio*(n - m)));
- 			idx = arma::find(log(u) < log_rho_z);
- 			if(idx.n_elem>0){
- 				if(m + idx.n_elem <= n)
- 					y.subvec(m, m + idx.n_elem - 1) = z.elem(idx);
- 				else
- 					y.subvec(m,n-1) = z.elem(idx.subvec(0,n-m-1));
- 				m += idx.n_elem;
- 			}
- 		}
+ 		E_omega = Rcpp::as<arma::vec>(in_E_omega);
  	}
- 	return y;
- }
 
+ 	if(in_E_beta.isNull()){
+ 		E_beta.zeros(p);
+ 	} else{
+ 		E_beta = Rcpp::as<arma::vec>(in_E_beta);
+ 	}
 
-//'@title Simulate left truncated normal distribution
-//'@param n sample size
-//'@param mu the location parameter
-//'@param sigma the scale parameter
-//'@param lower the lower bound
-//'@return a vector of random numbers from a left truncated
-//'normal distribution
-//'@author Jian Kang <jiankang@umich.edu>
-//'@examples
-//'r <- rand_left_trucnorm(1000, mu=100, sigma=0.1, lower=200)
-//'hist(r)
-//'@export
-//[[Rcpp::export]]
- arma::vec rand_left_trucnorm(int n, double mu, double sigma,
-                              double lower, double ratio=1.0){
- 	double lower0 = (lower - mu)/sigma;
- 	arma::vec y = rand_left_trucnorm0(n,lower0,ratio);
- 	y *= sigma;
- 	y += mu;
- 	return y;
- }
+ 	double A_sq = A*A;
+ 	double E_inv_tau_sq = in_E_inv_tau_sq;
 
-//'@title Simulate right truncated normal distribution
-//'@param n sample size
-//'@param mu the location parameter
-//'@param sigma the scale parameter
-//'@param upper the upper bound
-//'@return a vector of random numbers from a right truncated
-//'normal distribution
-//'@author Jian Kang <jiankang@umich.edu>
-//'@examples
-//'r <- rand_right_trucnorm(1000, mu=100, sigma=0.1, upper=90)
-//'hist(r)
-//'@export
-//[[Rcpp::export]]
- arma::vec rand_right_trucnorm(int n, double mu, double sigma,
-                               double upper, double ratio=1.0){
- 	arma::vec y = rand_left_trucnorm(n,-mu,sigma,-upper,ratio);
- 	return -y;
- }
 
+ 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
+ 	arma::mat I_p = eye(p,p);
 
- void hs_one_step_update_big_p(arma::vec& betacoef, arma::vec& lambda,
-                               double& sigma2_eps, double& tau2,
-                               double& b_tau, arma::vec& b_lambda, arma::vec& mu, arma::vec& ys,  arma::mat& V, arma::vec& d,arma::vec& d2,
-                               arma::vec& y, arma::mat& X, arma::mat& VD,
-                               double& A2_tau, double& A2_lambda,
-                               double a_sigma, double b_sigma,
-                               int p, int n){
+ 	vec list_E_inv_tau_sq, list_E_sum_beta_sq;
+ 	list_E_inv_tau_sq.zeros(max_iter);
+ 	list_E_sum_beta_sq.zeros(max_iter);
+ 	vec E_Zbeta_sq, Var_Zbeta;
+ 	mat Cov_beta;
+ 	mat S;
 
- 	arma::vec lambda2 = lambda%lambda;
- 	double sigma_eps = sqrt(sigma2_eps);
- 	double tau = sqrt(tau2);
- 	double inv_tau2 = 1.0/tau2;
- 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
- 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
- 	arma::mat LambdaVD = VD;
- 	for(int i=0;i<n;i++){
- 		LambdaVD.col(i) %= lambda;
+ 	double convergence = 1;
+ 	int iter = 0;
+ 	for(iter=0; iter<max_iter; iter++){
+ 		//Update E_beta
+ 		//std::cout << "beta" << std::endl;
+ 		mat OmegaX = X;
+ 		OmegaX.each_col() %= E_omega;
+ 		S = X.t()*OmegaX;
+ 		S.diag() += E_inv_tau_sq;
+ 		mat R = chol(S);
+ 		mat B = solve(trimatl(R.t()),X.t(),solve_opts::fast);
+ 		vec b = B*y_s;
+ 		E_beta_0 = E_beta;
+ 		E_beta = solve(trimatu(R),b,solve_opts::fast);
+ 		//E_beta = solve(S,X.t()*y_s,solve_opts::fast);
+ 		//std::cout << E_beta.rows(0,19) << std::endl;
+ 		if(accu(abs(E_beta-E_beta_0))<tol){
+ 			convergence = 0;
+ 			break;
+ 		}
+ 		//Update tr_Cov_beta
+ 		//std::cout << "tr_Cov_beta" << std::endl;
+ 		mat D = solve(trimatl(R.t()),I_p,solve_opts::fast);
+ 		D = D%D;
+ 		double tr_Cov_beta = accu(D);
+ 		//Update E_sum_beta_sq
+ 		//std::cout << "E_sum_beta_sq" << std::endl;
+ 		double E_sum_beta_sq = accu(E_beta%E_beta) + tr_Cov_beta;
+ 		//Update E_omega
+ 		//std::cout << "E_omega" << std::endl;
+ 		//vec E_Zbeta = B.t()*b;
+ 		vec E_Zbeta = X*E_beta;
+ 		B = B%B;
+ 		Var_Zbeta = sum(B.t(),1);
+ 		//mat inv_S_Xt = solve(S,X.t());
+ 		//mat temp = X*inv_S_Xt;
+ 		//Var_Zbeta = temp.diag();
+ 		E_Zbeta_sq = E_Zbeta%E_Zbeta + Var_Zbeta;
+ 		//vec E_Zbeta_sq = E_Zbeta%E_Zbeta;
+ 		vec sqrt_E_Zbeta_sq = sqrt(E_Zbeta_sq);
+ 		E_omega = tanh(sqrt_E_Zbeta_sq*0.5)/(2*sqrt_E_Zbeta_sq);
+ 		//Update E_inv_tau_sq
+ 		//std::cout << "E_inv_tau_sq" << std::endl;
+ 		double C = E_sum_beta_sq/A_sq;
+ 		double bs = C + 1.0 - p;
+ 		if(E_sum_beta_sq != 0){
+ 			E_inv_tau_sq = (-bs + sqrt(bs*bs+4*(1.0+p)*C))/(2*E_sum_beta_sq);
+ 		}
+ 		list_E_inv_tau_sq(iter) = E_inv_tau_sq;
+ 		list_E_sum_beta_sq(iter) = E_sum_beta_sq;
  	}
- 	arma::mat Z = LambdaVD.t()*LambdaVD;
- 	Z.diag() += inv_tau2;
- 	arma::vec beta_s = arma::solve(Z,ys - VD.t()*alpha_1 - alpha_2);
- 	//std::cout << beta_s.subvec(0,1) << std::endl;
- 	betacoef = alpha_1 + lambda2%(VD*beta_s);
-
- 	//update lambda
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	lambda = sqrt(1.0/inv_lambda2);
-
- 	//update lambda
- 	// arma::vec betacoef2 = betacoef%betacoef;
- 	// arma::vec B = 0.5*betacoef2/tau2/sigma2_eps;
- 	// arma::vec inv_lambda2 = 1.0/(lambda%lambda);
- 	// b_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
- 	// arma::vec upsilon = arma::randu<arma::vec>(p);
- 	// arma::vec C = 1.0/b_lambda - 1.0/A2_lambda;
- 	// inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
- 	// lambda = sqrt(1.0/inv_lambda2);
-
-
- 	//update tau2, sigma2_eps, b_tau and b_lambda
-
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
-
- 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
- 	//inv_tau2 = 1e16;
- 	/*double B_tau = 0.5*sum_beta2_inv_lambda2/sigma2_eps;
- 	 double u_tau = arma::randu()*(A2_tau/(1.0+A2_tau*inv_tau2));
- 	 double C_tau = 1.0/u_tau - 1.0/A2_tau;
- 	 double v_tau = arma::randu()*exp(-B_tau*inv_tau2);
- 	 double D_tau = -log(v_tau)/B_tau;
- 	 if(D_tau > C_tau)
- 	 D_tau = C_tau;
- 	 double s_tau = arma::randu();
- 	 inv_tau2 = D_tau*pow(s_tau,2.0/(p+1.0));*/
- 	tau2 = 1.0/inv_tau2;
-
- 	mu = X*betacoef;
- 	arma::vec eps = y - mu;
- 	double sum_eps2 = arma::accu(eps%eps);
- 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
- 	sigma2_eps = 1.0/inv_sigma2_eps;
- }
-
-//hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-//b_tau, mu, dys,  V,  d, d2, y, X,
-//A2, A2_lambda, a_sigma,  b_sigma, p,  n);
-
- void hs_one_step_update_big_n(arma::vec& betacoef,
-                               arma::vec& lambda,
-                               double& sigma2_eps, double& tau2, arma::vec& b_lambda,
-                               double& b_tau, arma::vec& mu, arma::vec& dys,
-                               arma::mat& V, arma::vec& d2,
-                               arma::vec& y, arma::mat& X,
-                               double A2, double A2_lambda,
-                               double a_sigma, double b_sigma,
-                               int p, int n){
-
- 	double inv_tau2 = 1.0/tau2;
- 	//double tau = sqrt(tau2);
- 	double sigma_eps = sqrt(sigma2_eps);
- 	arma::vec lambda_tau = lambda*sqrt(tau2);
- 	arma::mat V_d_lambda = V;
- 	V_d_lambda.each_col() /= lambda_tau;
-
- 	arma::mat VtV = V_d_lambda.t()*V_d_lambda;
- 	VtV.diag() += d2;
- 	//VtV /= sigma2_eps;
-
- 	arma::mat R = arma::chol(VtV);
- 	arma::vec b = arma::solve(R.t(),dys/sigma_eps,solve_opts::fast);
- 	arma::vec alpha;
- 	alpha.randn(p);
- 	betacoef = sigma_eps*V*arma::solve(R,alpha+b,solve_opts::fast);
-
-
-
- 	/*arma::vec taulambda= tau*lambda;
- 	 arma::vec tau2lambda2 = taulambda%taulambda;
- 	 arma::vec alpha_1 = arma::randn<arma::vec>(p)/d*sigma_eps;
- 	 arma::vec alpha_2 = arma::randn<arma::vec>(p)%taulambda*sigma_eps;
- 	 arma::vec ts = tau2lambda2%Xty;
- 	 arma::vec Valpha_1 = V*alpha_1;
- 	 arma::mat Z = XtX_inv;
- 	 Z.diag() += tau2lambda2;
- 	 arma::vec alpha = arma::solve(Z,ts - Valpha_1 - alpha_2)/sigma2_eps;
- 	 betacoef = Valpha_1 + sigma2_eps*XtX_inv*alpha;
- 	 */
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
- 	lambda = sqrt(1.0/inv_lambda2);
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	mu = X*betacoef;
- 	arma::vec eps = y - mu;
- 	double sum_eps2 = arma::accu(eps%eps);
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef%betacoef%inv_lambda2);
- 	//double sum_inv_lambda2 = arma::accu(inv_lambda2);
- 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
- 	tau2 = 1.0/inv_tau2;
- 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
- 	sigma2_eps = 1.0/inv_sigma2_eps;
+ 	//Cov_beta = inv_sympd(S);
 
- 	//std::cout << tau2 << std::endl;
- 	//std::cout << arma::accu(lambda) << std::endl;
+ 	double elapsed = timer.toc();
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = E_beta,
+                                            Named("inv_tau_sq") = E_inv_tau_sq,
+                                            Named("omega") = E_omega);
+ 	Rcpp::List trace = Rcpp::List::create(Named("inv_tau_sq") = list_E_inv_tau_sq,
+                                        Named("sum_beta_sq") = list_E_sum_beta_sq);
+ 	Rcpp::List output = Rcpp::List::create(Named("post_mean") = post_mean,
+                                         Named("trace") = trace,
+                                         Named("iter") = iter,
+                                         Named("convergence") = convergence,
+                                         Named("elapsed") = elapsed);
+ 	return output;
  }
 
-//'@title Fast Bayesian linear regression with horseshoe priors
-//'@param y vector of n outcome variables
+//'@title Fast single variable update mean field variational Bayesian
+//'logistic regression with normal priors
+//'@param y vector of n binrary outcome variables taking values 0 or 1
 //'@param X n x p matrix of candidate predictors
-//'@param mcmc_sample number of MCMC iterations saved
-//'@param burnin number of iterations before start to save
-//'@param thinning number of iterations to skip between two saved iterations
-//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
-//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
-//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
-//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
-//'@return a list object consisting of two components
+//'@param max_iter maximum number of iterations
+//'@param tol the tolerance for the parameter changes
+//'@param A scale parameter in the half Cauchy prior for regression coefficients
+//'@param in_E_inv_tau_sq numeric scalar for the initial value for inverse of tau squared
+//'@param in_E_omega numeric vector of length n for the initial values for all omega's
+//'@param in_E_beta  numeric vector of length p for the initial values for all beta's
+//'@return a list object consisting of three components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
 //'\describe{
-//'\item{mu}{a vector of posterior predictive mean of the n training sample}
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
-//'\item{sigma2_eps}{posterior mean of the noise variance}
-//'\item{b_lambda}{posterior mean of the rate parameter in the prior for local shrinkage parameters}
-//'\item{tau2}{posterior mean of the global parameter}
+//'\item{inv_tau_sq}{posterior mean of inverse tau square}
+//'\item{omega}{a vector of posterior mean of omega}
 //'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\item{trace}{a list object of two components for the trace of parameter updates}
 //'\describe{
-//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
-//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
-//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
-//'\item{b_lambda}{a vector of MCMC samples of the rate parameter in the prior for local shrinkage parameters}
-//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'\item{inv_tau_sq}{a vector of trace for inverse of tau_sq}
+//'\item{sum_beta_sq}{a vector of trace for inverse of summation of beta_sq}
 //'}
+//'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'res1 <- with(dat1,fast_horseshoe_lm(y,X))
-//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
-//'res2 <- with(dat2,fast_horseshoe_lm(y,X))
+//'dat1 <- sim_logit_reg(n=2000,p=20,X_cor=0.5,X_var=1,q=10,beta_size=5)
+//'split <- train_test_splits(dat1$n)
+//'dat1$train_idx <- split$train_idx
+//'dat1$test_idx <- split$test_idx
+//'res1 <- with(dat1,fast_mfvb_normal_logit_single(y[train_idx],X[train_idx,]))
+//'res1_mcmc <- with(dat1,fast_normal_logit(y[train_idx],X[train_idx,]))
+//'res1_glmnet <- with(dat1,wrap_glmnet(y[train_idx],X[train_idx,],alpha=0.5,family=binomial()))
+//'
+//'
 //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
-//'time=c(res1$elapsed,res2$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
-//'fast_horseshoe_tab <- tab
-//'print(fast_horseshoe_tab)
+//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_mcmc$post_mean$betacoef)),
+//'time=c(res1$elapsed,res1_glmnet$elapsed,
+//'res1_mcmc$elapsed))
+//'
+//'rownames(tab)<-c("n = 2000, p = 20 MFVB","n = 2000, p = 20 glmnet",
+//'"n = 2000, p = 20 MCMC")
+//'normal_logit_tab <- tab
+//'print(normal_logit_tab)
 //'@export
- 	//[[Rcpp::export]]
- 	 Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X,
-                                int mcmc_sample = 500,
-                                int burnin = 500, int thinning = 1,
-                                double a_sigma = 0.0, double b_sigma = 0.0,
-                                double A_tau = 1, double A_lambda = 1){
-
- 	 	arma::wall_clock timer;
- 	 	timer.tic();
- 	 	arma::vec d;
- 	 	arma::mat U;
- 	 	arma::mat V;
- 	 	arma::svd_econ(U,d,V,X);
+//[[Rcpp::export]]
+ Rcpp::List fast_mfvb_normal_logit_single(arma::vec& y, arma::mat& X,
+                                          int max_iter = 5000,
+                                          double tol = 1e-05,
+                                          double A = 10,
+                                          double in_E_inv_tau_sq = 1,
+                                          Rcpp::Nullable<Rcpp::NumericVector> in_E_omega = R_NilValue,
+                                          Rcpp::Nullable<Rcpp::NumericVector> in_E_beta = R_NilValue){
 
- 	 	int p = X.n_cols;
- 	 	int n = X.n_rows;
- 	 	double sigma2_eps = 1;
- 	 	if(a_sigma!=0.0){
- 	 		sigma2_eps = b_sigma/a_sigma;
- 	 	}
- 	 	double A2 = A_tau*A_tau;
- 	 	double A2_lambda = A_lambda*A_lambda;
- 	 	double b_tau = 1;
+ 	arma::wall_clock timer;
+ 	timer.tic();
 
- 	 	double tau2 = 1.0/p;
- 	 	arma::vec d2 = d%d;
- 	 	arma::vec ys = U.t()*y;
- 	 	arma::vec dys = d%ys;
 
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
 
+ 	mat X2 = X%X;
+ 	vec E_omega;
+ 	vec E_beta, E_beta_0;
+ 	if(in_E_omega.isNull()){
+ 		E_omega.ones(n);
+ 	} else{
+ 		E_omega = Rcpp::as<arma::vec>(in_E_omega);
+ 	}
 
- 	 	arma::vec betacoef;
- 	 	arma::vec lambda;
- 	 	arma::vec b_lambda;
- 	 	lambda.ones(p);
- 	 	b_lambda.ones(p);
- 	 	arma::vec mu;
+ 	if(in_E_beta.isNull()){
+ 		E_beta.zeros(p);
+ 	} else{
+ 		E_beta = Rcpp::as<arma::vec>(in_E_beta);
+ 	}
 
- 	 	arma::mat betacoef_list;
- 	 	arma::mat lambda_list;
- 	 	arma::vec sigma2_eps_list;
- 	 	arma::vec tau2_list;
+ 	double A_sq = A*A;
+ 	double E_inv_tau_sq = in_E_inv_tau_sq;
+ 	vec Var_beta;
+ 	Var_beta.ones(p);
+ 	vec E_mu;
+ 	E_mu.zeros(n);
 
- 	 	betacoef_list.zeros(p,mcmc_sample);
- 	 	lambda_list.zeros(p,mcmc_sample);
- 	 	sigma2_eps_list.zeros(mcmc_sample);
- 	 	tau2_list.zeros(mcmc_sample);
 
+ 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
+ 	arma::mat I_p = eye(p,p);
 
- 	 	if(p<n){
+ 	vec list_E_inv_tau_sq, list_E_sum_beta_sq;
+ 	list_E_inv_tau_sq.zeros(max_iter);
+ 	list_E_sum_beta_sq.zeros(max_iter);
+ 	vec E_Zbeta_sq, Var_Zbeta;
+ 	mat Cov_beta;
+ 	mat S;
 
+ 	double convergence = 1;
+ 	int iter = 0;
+ 	for(iter=0; iter<max_iter; iter++){
+ 		//Update E_beta
+ 		//std::cout << "beta" << std::endl;
+ 		for(int k=0;k<p;k++){
+ 			Var_beta(k) = accu(E_omega%X2.col(k));
+ 		}
+ 		Var_beta += E_inv_tau_sq;
+ 		Var_beta = 1.0/Var_beta;
 
- 	 		for(int iter=0;iter<burnin;iter++){
- 	 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                               b_tau, mu, dys,  V,   d2, y, X,
-                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 	 		}
- 	 		for(int iter=0;iter<mcmc_sample;iter++){
- 	 			for(int j=0;j<thinning;j++){
- 	 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                                b_tau, mu, dys,  V,  d2, y, X, A2,
-                                A2_lambda, a_sigma,  b_sigma, p,  n);
- 	 			}
- 	 			betacoef_list.col(iter) = betacoef;
- 	 			lambda_list.col(iter) = lambda;
- 	 			sigma2_eps_list(iter) = sigma2_eps;
- 	 			tau2_list(iter) = tau2;
- 	 		}
- 	 	} else{
- 	 		arma::mat VD = V;
- 	 		for(int j=0;j<p;j++){
- 	 			VD.row(j) %= d.t();
- 	 		}
- 	 		for(int iter=0;iter<burnin;iter++){
- 	 			hs_one_step_update_big_p(betacoef, lambda, sigma2_eps, tau2,
-                               b_tau, b_lambda, mu, ys,  V,  d, d2, y,  X, VD,
-                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 	 		}
- 	 		for(int iter=0;iter<mcmc_sample;iter++){
- 	 			for(int j=0;j<thinning;j++){
- 	 				hs_one_step_update_big_p(betacoef, lambda, sigma2_eps, tau2,
-                                b_tau,b_lambda, mu, ys,  V,  d, d2, y,  X, VD,
-                                A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 	 			}
- 	 			betacoef_list.col(iter) = betacoef;
- 	 			lambda_list.col(iter) = lambda;
- 	 			sigma2_eps_list(iter) = sigma2_eps;
- 	 			tau2_list(iter) = tau2;
- 	 		}
+ 		for(int k=0;k<p;k++){
+ 			vec E_mu_k = E_mu - E_beta(k)*X.col(k);
+ 			E_mu = E_mu_k;
+ 			E_mu_k %= -E_omega;
+ 			E_mu_k += y_s;
+ 			E_beta(k) = arma::accu(E_mu_k%X.col(k));
+ 			E_beta(k) *= Var_beta(k);
+ 			E_mu += E_beta(k)*X.col(k);
+ 		}
 
- 	 	}
 
- 	 	betacoef = arma::mean(betacoef_list,1);
- 	 	lambda = arma::mean(lambda_list,1);
- 	 	sigma2_eps = arma::mean(sigma2_eps_list);
- 	 	tau2 = arma::mean(tau2_list);
+ 		if(accu(abs(E_beta-E_beta_0))<tol){
+ 			convergence = 0;
+ 			break;
+ 		}
 
- 	 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
-                                              Named("betacoef") = betacoef,
-                                              Named("lambda") = lambda,
-                                              Named("sigma2_eps") = sigma2_eps,
-                                              Named("tau2") = tau2);
- 	 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                         Named("lambda") = lambda_list,
-                                         Named("sigma2_eps") = sigma2_eps_list,
-                                         Named("tau2") = tau2_list);
+ 		//update sum_E_beta_sq
+ 		double E_sum_beta_sq = accu(E_beta%E_beta) + accu(Var_beta);
 
- 	 	double elapsed = timer.toc();
- 	 	return Rcpp::List::create(Named("post_mean") = post_mean,
-                              Named("mcmc") = mcmc,
-                              Named("elapsed") = elapsed);
- 	 }
 
 
- void hs_one_step_update(arma::vec& betacoef, arma::vec& lambda,
-                         double& sigma2_eps, double& tau2,
-                         double& b_tau, arma::vec& b_lambda, arma::vec& mu,
-                         arma::vec& y, arma::mat& X,
-                         double& A2, double& A2_lambda,
-                         double a_sigma, double b_sigma,
-                         int p, int n){
+ 		//Update E_omega
+ 		//std::cout << "E_omega" << std::endl;
+ 		vec E_Zbeta = X*E_beta;
+ 		Var_Zbeta = X2*Var_beta;
 
- 	double sigma_eps = sqrt(sigma2_eps);
- 	double tau = sqrt(tau2);
- 	double inv_tau2 = 1.0/tau2;
- 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
- 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
- 	arma::mat XLambda = X;
- 	for(int i=0;i<n;i++){
- 		XLambda.row(i) %= lambda.t();
+ 		E_Zbeta_sq = E_Zbeta%E_Zbeta + Var_Zbeta;
+ 		vec sqrt_E_Zbeta_sq = sqrt(E_Zbeta_sq);
+ 		E_omega = tanh(sqrt_E_Zbeta_sq*0.5)/(2*sqrt_E_Zbeta_sq);
+ 		//Update E_inv_tau_sq
+ 		//std::cout << "E_inv_tau_sq" << std::endl;
+ 		double C = E_sum_beta_sq/A_sq;
+ 		double bs = C + 1.0 - p;
+ 		if(E_sum_beta_sq != 0){
+ 			E_inv_tau_sq = (-bs + sqrt(bs*bs+4*(1.0+p)*C))/(2*E_sum_beta_sq);
+ 		}
+ 		list_E_inv_tau_sq(iter) = E_inv_tau_sq;
+ 		list_E_sum_beta_sq(iter) = E_sum_beta_sq;
  	}
- 	arma::mat Z = XLambda*XLambda.t();
- 	Z.diag() += inv_tau2;
- 	arma::vec beta_s = arma::solve(Z,y - X*alpha_1 - alpha_2,arma::solve_opts::fast);
- 	//std::cout << beta_s.subvec(0,1) << std::endl;
- 	betacoef = alpha_1 + lambda%(XLambda.t()*beta_s);
- 	//update lambda
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	lambda = sqrt(1.0/inv_lambda2);
- 	//update tau2, sigma2_eps, b_tau and b_lambda
- 	mu = X*betacoef;
- 	arma::vec eps = y - mu;
- 	double sum_eps2 = arma::accu(eps%eps);
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
- 	//double sum_inv_lambda2 = arma::accu(inv_lambda2);
- 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
- 	sigma2_eps = 1.0/inv_sigma2_eps;
- 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2*inv_sigma2_eps)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
- 	tau2 = 1.0/inv_tau2;
 
+ 	double elapsed = timer.toc();
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = E_beta,
+                                            Named("inv_tau_sq") = E_inv_tau_sq,
+                                            Named("omega") = E_omega);
+ 	Rcpp::List trace = Rcpp::List::create(Named("inv_tau_sq") = list_E_inv_tau_sq,
+                                        Named("sum_beta_sq") = list_E_sum_beta_sq);
+ 	Rcpp::List output = Rcpp::List::create(Named("post_mean") = post_mean,
+                                         Named("trace") = trace,
+                                         Named("iter") = iter,
+                                         Named("convergence") = convergence,
+                                         Named("elapsed") = elapsed);
+ 	return output;
  }
 
- void hs_one_step_update_slice_sampler(arma::vec& betacoef, arma::vec& lambda,
-                                       double& sigma2_eps, double& tau2,
-                                       double& u_tau, arma::vec& u_lambda, arma::vec& mu,
+//'@title Fast mean field varational Bayesian multinomial logistic regression with normal priors
+//'@param y vector of n multiclass outcome variables taking values 0,...,M-1
+//'@param X n x p matrix of candidate predictors
+//'@param num_class an integer indicating the number of classes
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,beta_size=1,intercept0=c(5,-5,-10,-10))
+//'glmnet_res <- with(dat,wrap_glmnet(y,cbind(1,X),family="multinomial"))
+//'Bayes_res <- with(dat,fast_mfvb_multiclass(y,cbind(1,X),num_class=length(unique(y)),burnin=5000))
+//'glmnet_pred <- as.numeric(predict(glmnet_res$glmnet_fit,newx = cbind(1,dat$X),type = "class"))
+//'Bayes_pred <- apply(Bayes_res$post_mean$prob,1,which.max)-1
+//'print(c(glmnet_acc = mean(glmnet_pred==dat$y),Bayes_acc = mean(Bayes_pred==dat$y)))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_mfvb_multiclass(arma::vec& y, arma::mat& X, int num_class,
+                                 int mcmc_sample = 500,
+                                 int burnin = 500, int thinning = 1,
+                                 double A_tau = 1){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	arma::mat betacoef;
+ 	arma::vec tau2;
+ 	arma::mat mu;
+ 	arma::mat prob;
+ 	arma::mat log_1_prob;
+ 	arma::cube betacoef_list;
+ 	arma::mat tau2_list;
+ 	betacoef.zeros(X.n_cols,num_class-1);
+ 	mu.zeros(X.n_rows,num_class-1);
+ 	prob.zeros(X.n_rows,num_class-1);
+ 	tau2.zeros(num_class-1);
+ 	betacoef_list.zeros(X.n_cols,mcmc_sample,num_class-1);
+ 	tau2_list.zeros(mcmc_sample,num_class-1);
+ 	log_1_prob.zeros(X.n_rows,num_class-1);
+
+
+ 	for(int k=num_class-1;k>=1;k--){
+ 		arma::uvec idx1 = arma::find(y==k);
+ 		arma::uvec idx0 = arma::find(y<k);
+ 		arma::vec y01;
+ 		int n01 = idx0.n_elem+idx1.n_elem;
+ 		y01.zeros(n01);
+ 		y01.rows(idx0.n_elem,n01-1) += 1.0;
+ 		arma::mat X01;
+ 		X01.zeros(n01,X.n_cols);
+ 		X01.rows(0,idx0.n_elem-1) = X.rows(idx0);
+ 		X01.rows(idx0.n_elem,n01-1) = X.rows(idx1);
+ 		Rcpp::List fit01 = fast_normal_logit(y01,X01,mcmc_sample,burnin,thinning,A_tau);
+ 		Rcpp::List post_mean01 = fit01["post_mean"];
+ 		Rcpp::List mcmc01 = fit01["mcmc"];
+ 		arma::mat temp_betacoef_list = mcmc01["betacoef"];
+ 		betacoef_list.slice(k-1) = temp_betacoef_list;
+ 		arma::vec temp_tau2_list = mcmc01["tau2"];
+ 		tau2_list.col(k-1) = temp_tau2_list;
+
+ 		arma::vec temp_beta = post_mean01["betacoef"];
+ 		betacoef.col(k-1) = temp_beta;
+ 		mu.col(k-1) = X*temp_beta;
+
+
+ 		//arma::vec temp_prob = 1.0/(1.0 + exp(-mu.col(k-1)));
+ 		arma::vec log_prob;
+ 		arma::vec log_1_prob_k;
+ 		log_sigmoid_both(mu.col(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.col(k-1) = log_1_prob_k;
+ 		prob.col(k-1) = log_prob;
+ 		if(k<num_class-1){
+ 			for(int j=k; j<num_class-1;j++){
+ 				prob.col(k-1) += log_1_prob.col(j);
+ 			}
+ 		}
+ 		double temp_tau2 = post_mean01["tau2"];
+ 		tau2(k-1) = temp_tau2;
+ 	}
+
+ 	prob = exp(prob);
+ 	arma::vec prob0 = 1.0 - arma::sum(prob,1);
+ 	prob = arma::join_rows(prob0,prob);
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2,
+                                            Named("mu") = mu,
+                                            Named("prob") = prob);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+ void one_step_logit_horseshoe_big_n(arma::vec& betacoef, double& tau2, double& b_tau,
+                                     arma::vec& omega, arma::vec& lambda, arma::vec& b_lambda,
+                                     arma::vec& mu, arma::vec& y_s, arma::vec& Xty_s, arma::mat& X,
+                                     double& A2_tau, double& A2_lambda,
+                                     int& p, int& n, Rcpp::Function& pgdraw){
+
+ 	//update beta
+ 	double inv_tau2 = 1.0/tau2;
+ 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
+ 	arma::mat OmegaX = X;
+ 	for(int j=0;j<p;j++){
+ 		OmegaX.col(j) %= omega;
+ 	}
+ 	arma::mat XtX = X.t()*OmegaX;
+ 	XtX.diag() += inv_tau2*inv_lambda2;
+ 	arma::mat R = arma::chol(XtX);
+ 	arma::vec b = arma::solve(R.t(),Xty_s,solve_opts::fast);
+ 	arma::vec alpha;
+ 	alpha.randn(p);
+ 	betacoef = arma::solve(R,alpha+b,solve_opts::fast);
+
+ 	//update omega
+ 	mu = X*betacoef;
+ 	omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+
+ 	//update tau2
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+
+ 	//update lambda
+ 	inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
+
+ }
+
+ void one_step_logit_horseshoe_big_p(arma::vec& betacoef, double& tau2, double& b_tau,
+                                     arma::vec& omega,arma::vec& lambda, arma::vec& b_lambda,
+                                     arma::vec& mu, arma::vec& y_s, arma::mat& X,
+                                     double& A2_tau, double& A2_lambda,
+                                     int& p, int& n,
+                                     Rcpp::Function& pgdraw){
+
+ 	//update beta
+ 	arma::vec inv_omega = 1.0/omega;
+ 	arma::vec alpha1;
+ 	alpha1.randn(p);
+ 	alpha1 *= sqrt(tau2);
+ 	alpha1 %= lambda;
+ 	arma::vec alpha2;
+ 	alpha2.randn(n);
+ 	alpha2 %= sqrt(inv_omega);
+ 	arma::mat XLambda = X;
+ 	for(int i=0;i<n;i++){
+ 		XLambda.row(i) %= lambda.t();
+ 	}
+ 	arma::mat Omega0 = XLambda*XLambda.t();
+
+ 	Omega0.diag() += inv_omega/tau2;
+
+
+ 	arma::vec beta_s = arma::solve(Omega0, y_s%inv_omega - X*alpha1 - alpha2);
+ 	betacoef = alpha1 + lambda%(XLambda.t()*beta_s);
+
+ 	//update omega
+ 	mu = X*betacoef;
+ 	omega = Rcpp::as<arma::vec>(pgdraw(1.0,NumericVector(mu.begin(),mu.end())));
+
+ 	//update lambda
+ 	//arma::vec betacoef2 = betacoef%betacoef;
+
+ 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
+ 	// arma::vec B = 0.5*betacoef2/tau2;
+ 	// b_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
+ 	// arma::vec upsilon = arma::randu<arma::vec>(p);
+ 	// arma::vec C = 1.0/b_lambda - 1.0/A2_lambda;
+ 	// inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
+
+ 	// arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	// inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
+ 	// b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	// b_lambda /= 1.0/A2_lambda+inv_lambda2;
+
+ 	//lambda = sqrt(1.0/inv_lambda2);
+
+
+ 	//update tau2
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 	double inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+
+ 	//update lambda
+ 	inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
+
+ }
+
+
+
+//'@title Fast Bayesian logistic regression with horseshoe priors
+//'@param y vector of n binary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param asis logical value; if true, each iteration is followed by an ancillarity-sufficiency
+//'interweaving step that redraws the global scale given the non-centred coefficients betacoef/sqrt(tau2).
+//'It costs O(n+p) per iteration and much improves the mixing of tau2 when the signal is weak. Default value is false
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of global shrinkage parameters}
+//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters. Each column is one MCMC sample}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res1 <- with(dat1,fast_horseshoe_logit(y,X,A_tau=0.001,A_lambda=0.001))
+//'res1_glmnet <- with(dat1,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res2 <- with(dat2,fast_horseshoe_logit(y,X,burnin=5000,mcmc_sample=500,A_tau=0.001,A_lambda=0.001))
+//'res2_glmnet <- with(dat2,wrap_glmnet(y,X,alpha=0.5,family=binomial()))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat1$betacoef,res1_glmnet$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2_glmnet$betacoef)),
+//'time=c(res1$elapsed,res1_glmnet$elapsed,res2$elapsed,res2_glmnet$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200 Bayes","n = 2000, p = 200 glmnet",
+//'"n = 200, p = 2000 Bayes","n = 200, p = 2000 glmnet")
+//'normal_logit_tab <- tab
+//'print(normal_logit_tab)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_horseshoe_logit(arma::vec& y, arma::mat& X,
+                                 int mcmc_sample = 500,
+                                 int burnin = 500, int thinning = 1,
+                                 double A_tau = 1, double A_lambda = 1,
+                                 bool asis = false){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+
+ 	double A2_tau = A_tau*A_tau;
+ 	double b_tau = A2_tau;
+ 	double tau2 = b_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+
+ 	arma::vec y_s = y - arma::ones<arma::vec>(n)*0.5;
+
+
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("pgdraw");
+ 	Rcpp::Function pgdraw = pkg["pgdraw"];
+ 	Rcpp::NumericVector zeros(n,0.0);
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	arma::vec mu;
+
+ 	lambda.ones(p);
+ 	b_lambda.ones(p);
+ 	betacoef.zeros(p);
+ 	mu.zeros(n);
+ 	arma::vec omega = Rcpp::as<arma::vec>(pgdraw(1.0,zeros));
+
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec tau2_list;
+
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	lambda_list.zeros(p,mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+
+ 	if(p<n){
+ 		arma::vec Xty_s = X.t()*y_s;
+ 		for(int iter=0;iter<burnin;iter++){
+ 			one_step_logit_horseshoe_big_n(betacoef, tau2, b_tau,
+                                   omega, lambda, b_lambda,mu,
+                                   y_s, Xty_s,  X,
+                                   A2_tau, A2_lambda, p, n, pgdraw);
+ 			if(asis)
+ 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				one_step_logit_horseshoe_big_n(betacoef, tau2, b_tau,
+                                    omega, lambda, b_lambda,mu,
+                                    y_s, Xty_s,  X,
+                                    A2_tau, A2_lambda, p, n, pgdraw);
+ 				if(asis)
+ 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			tau2_list(iter) = tau2;
+ 		}
+ 	} else{
+ 		//arma::mat XXt = X*X.t();
+ 		tau2 = 1.0/p;
+ 		for(int iter=0;iter<burnin;iter++){
+ 			one_step_logit_horseshoe_big_p(betacoef, tau2, b_tau,
+                                   omega, lambda, b_lambda, mu,
+                                   y_s,  X,
+                                   A2_tau, A2_lambda, p, n, pgdraw);
+ 			if(asis)
+ 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				one_step_logit_horseshoe_big_p(betacoef, tau2, b_tau,
+                                    omega,lambda, b_lambda, mu,
+                                    y_s,  X,
+                                    A2_tau, A2_lambda, p, n, pgdraw);
+ 				if(asis)
+ 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(omega%mu%mu), arma::dot(mu,y_s), 1.0, A2_tau);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			tau2_list(iter) = tau2;
+ 		}
+
+ 	}
+
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	tau2 = arma::mean(tau2_list);
+ 	mu =  X*betacoef;
+
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2,
+                                            Named("lambda") = lambda,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_LOGIT));
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list,
+                                       Named("lambda") = lambda_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+
+//'@title Simulate left standard truncated normal distribution
+//'@param n sample size
+//'@param lower the lower bound
+//'@return a vector of random numbers from a left standard truncated
+//'normal distribution
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'r0 <- rand_left_trucnorm0(1000, lower=2)
+//'hist(r0)
+//'@export
+//[[Rcpp::export]]
+ arma::vec rand_left_trucnorm0(int n, double lower, double ratio=1.0){
+ 	arma::vec y = arma::zeros<arma::vec>(n);
+ 	int m = 0;
+ 	if(lower<=0){
+ 		arma::vec z = arma::randn<arma::vec>(ceil(ratio*(n - m)));
+ 		arma::uvec idx = arma::find(z>lower);
+ 		m += idx.n_elem;
+ 		if(idx.n_elem>0){
+ 			if(m<=n)
+ 				y.subvec(0,m-1) = z.elem(idx);
+ 			else
+ 				y = z.elem(idx.subvec(0,n-1));
+ 		}
+ 		while(m < n){
+ 			z = arma::randn<arma::vec>(ceil(ratio*(n - m)));
+ 			idx = arma::find(z>lower);
+ 			if(idx.n_elem>0){
+ 				if(m + idx.n_elem <= n)
+ 					y.subvec(m, m + idx.n_elem - 1) = z.elem(idx);
+ 				else
+ 					y.subvec(m,n-1) = z.elem(idx.subvec(0,n-m-1));
+ 				m += idx.n_elem;
+ 			}
+ 		}
+ 	} else{
+ 		double alpha_star = 0.5*(lower+sqrt(lower*lower+4.0));
+ 		arma::vec z = lower - log(arma::randu<arma::vec>(ceil(ratio*n)))/alpha_star;
+ 		arma::vec log_rho_z = (z - alpha_star);
+ 		log_rho_z %= -0.5*log_rho_z;
+ 		arma::vec u = arma::randu<arma::vec>(ceil(ratio*n));
+ 		arma::uvec idx = arma::find(log(u) < log_rho_z);
+ 		m += idx.n_elem;
+ 		if(idx.n_elem>0){
+ 			if(m<=n)
+ 				y.subvec(0,m-1) = z.elem(idx);
+ 			else
+ 				y = z.elem(idx.subvec(0,n-1));
+ 		}
+ 		while(m < n){
+ 			z = lower - log(arma::randu<arma::vec>(ceil(ratio*(n - m))))/alpha_star;
+ 			log_rho_z = (z - alpha_star);
+ 			log_rho_z %= -0.5*log_rho_z;
+ 			u = arma::randu<arma::vec>(ceil(ratio*(n - m)));
+ 			idx = arma::find(log(u) < log_rho_z);
+ 			if(idx.n_elem>0){
+ 				if(m + idx.n_elem <= n)
+ 					y.subvec(m, m + idx.n_elem - 1) = z.elem(idx);
+ 				else
+ 					y.subvec(m,n-1) = z.elem(idx.subvec(0,n-m-1));
+ 				m += idx.n_elem;
+ 			}
+ 		}
+ 	}
+ 	return y;
+ }
+
+
+//'@title Simulate left truncated normal distribution
+//'@param n sample size
+//'@param mu the location parameter
+//'@param sigma the scale parameter
+//'@param lower the lower bound
+//'@return a vector of random numbers from a left truncated
+//'normal distribution
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'r <- rand_left_trucnorm(1000, mu=100, sigma=0.1, lower=200)
+//'hist(r)
+//'@export
+//[[Rcpp::export]]
+ arma::vec rand_left_trucnorm(int n, double mu, double sigma,
+                              double lower, double ratio=1.0){
+ 	double lower0 = (lower - mu)/sigma;
+ 	arma::vec y = rand_left_trucnorm0(n,lower0,ratio);
+ 	y *= sigma;
+ 	y += mu;
+ 	return y;
+ }
+
+//'@title Simulate right truncated normal distribution
+//'@param n sample size
+//'@param mu the location parameter
+//'@param sigma the scale parameter
+//'@param upper the upper bound
+//'@return a vector of random numbers from a right truncated
+//'normal distribution
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'r <- rand_right_trucnorm(1000, mu=100, sigma=0.1, upper=90)
+//'hist(r)
+//'@export
+//[[Rcpp::export]]
+ arma::vec rand_right_trucnorm(int n, double mu, double sigma,
+                               double upper, double ratio=1.0){
+ 	arma::vec y = rand_left_trucnorm(n,-mu,sigma,-upper,ratio);
+ 	return -y;
+ }
+
+// one draw from N(0,1) truncated to (a, b) with a < b by the exact
+// accept-reject schemes of Robert (1995): normal proposals when the interval
+// holds enough mass, uniform proposals on short intervals and translated
+// exponential proposals with the optimal rate in the tails. NaN bounds and
+// empty intervals, including two infinite bounds on the same side, give NaN
+// instead of an endless loop, since the callers run inside parallel regions
+ double rand_trucnorm0_one(double a, double b, std::mt19937_64& rng){
+ 	std::normal_distribution<double> rnorm(0.0, 1.0);
+ 	std::uniform_real_distribution<double> runif(0.0, 1.0);
+ 	if(std::isnan(a) || std::isnan(b) || !(a<b))
+ 		return arma::datum::nan;
+ 	if(b<0)
+ 		return -rand_trucnorm0_one(-b, -a, rng);
+ 	if(a<=0){
+ 		if(b - a < 2.506628274631){
+ 			while(true){
+ 				double z = a + (b - a)*runif(rng);
+ 				if(runif(rng) < exp(-0.5*z*z))
+ 					return z;
+ 			}
+ 		}
+ 		while(true){
+ 			double z = rnorm(rng);
+ 			if(z>a && z<b)
+ 				return z;
+ 		}
+ 	}
+ 	double alpha_star = 0.5*(a+sqrt(a*a+4.0));
+ 	double b_uniform = a + 2.0/(a+sqrt(a*a+4.0))*exp(0.25*(a*a-a*sqrt(a*a+4.0))+0.5);
+ 	if(b < b_uniform){
+ 		while(true){
+ 			double z = a + (b - a)*runif(rng);
+ 			if(runif(rng) < exp(0.5*(a*a - z*z)))
+ 				return z;
+ 		}
+ 	}
+ 	while(true){
+ 		double z = a - log(1.0 - runif(rng))/alpha_star;
+ 		if(z<b && log(1.0 - runif(rng)) < -0.5*(z - alpha_star)*(z - alpha_star))
+ 			return z;
+ 	}
+ }
+
+// fill y[0..n-1] with N(mu_i, sigma_i^2) draws truncated to (lower_i, upper_i);
+// inputs of length one are recycled. Block b of block_size elements uses
+// stream (seed, b), so the output does not depend on the number of threads
+ void rand_trucnorm_fill(double* y, const arma::vec& mu, const arma::vec& sigma,
+                         const arma::vec& lower, const arma::vec& upper,
+                         int n, int seed, int n_threads, int block_size = 4096){
+ 	int num_blocks = (n + block_size - 1)/block_size;
+ 	bool mu_1 = mu.n_elem==1;
+ 	bool sigma_1 = sigma.n_elem==1;
+ 	bool lower_1 = lower.n_elem==1;
+ 	bool upper_1 = upper.n_elem==1;
+ 	#pragma omp parallel for schedule(static) num_threads(get_num_threads(n_threads))
+ 	for(int b=0;b<num_blocks;b++){
+ 		std::seed_seq seq{seed, b};
+ 		std::mt19937_64 rng(seq);
+ 		int i_end = std::min(n, (b+1)*block_size);
+ 		for(int i=b*block_size;i<i_end;i++){
+ 			double mu_i = mu_1 ? mu(0) : mu(i);
+ 			double sigma_i = sigma_1 ? sigma(0) : sigma(i);
+ 			double a = ((lower_1 ? lower(0) : lower(i)) - mu_i)/sigma_i;
+ 			double c = ((upper_1 ? upper(0) : upper(i)) - mu_i)/sigma_i;
+ 			y[i] = mu_i + sigma_i*rand_trucnorm0_one(a, c, rng);
+ 		}
+ 	}
+ }
+
+//'@title Simulate truncated normal distributions with element-wise parameters
+//'@param mu vector of finite location parameters
+//'@param sigma vector of positive finite scale parameters
+//'@param lower vector of lower bounds; use -Inf for right truncation only
+//'@param upper vector of upper bounds; use Inf for left truncation only
+//'@param seed seed of the random number streams; the output does not depend on n_threads
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@return a vector of random numbers, one for each element of the longest
+//'argument; arguments of length one are recycled
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'r <- rand_trucnorm(mu=rnorm(10000), sigma=1, lower=c(rep(0,5000),rep(-Inf,5000)),
+//'upper=c(rep(Inf,5000),rep(0,5000)))
+//'hist(r)
+//'@export
+//[[Rcpp::export]]
+ arma::vec rand_trucnorm(arma::vec& mu, arma::vec& sigma,
+                         arma::vec& lower, arma::vec& upper,
+                         int seed = 2022, int n_threads = 0){
+ 	arma::uword n = std::max(std::max(mu.n_elem,sigma.n_elem),std::max(lower.n_elem,upper.n_elem));
+ 	if((mu.n_elem!=1 && mu.n_elem!=n) || (sigma.n_elem!=1 && sigma.n_elem!=n) ||
+     (lower.n_elem!=1 && lower.n_elem!=n) || (upper.n_elem!=1 && upper.n_elem!=n))
+ 		Rcpp::stop("mu, sigma, lower and upper must have length one or a common length");
+ 	if(!mu.is_finite())
+ 		Rcpp::stop("mu must be finite");
+ 	if(!sigma.is_finite() || arma::any(sigma<=0))
+ 		Rcpp::stop("sigma must be positive and finite");
+ 	for(arma::uword i=0;i<n;i++){
+ 		if(!((lower.n_elem==1 ? lower(0) : lower(i)) < (upper.n_elem==1 ? upper(0) : upper(i))))
+ 			Rcpp::stop("lower must be smaller than upper");
+ 	}
+ 	arma::vec y(n);
+ 	rand_trucnorm_fill(y.memptr(), mu, sigma, lower, upper, n, seed, n_threads);
+ 	return y;
+ }
+
+// Albert-Chib data augmentation: z_i ~ N(mu_i, 1) truncated to z_i > 0
+// when y_i = 1 and to z_i <= 0 when y_i = 0. The seed of the streams is drawn
+// from the R generator, so set.seed keeps the samplers reproducible
+ void probit_update_z(arma::vec& z, arma::vec& y, arma::vec& mu){
+ 	int n = y.n_elem;
+ 	arma::vec sigma = arma::ones<arma::vec>(1);
+ 	arma::vec lower(n);
+ 	arma::vec upper(n);
+ 	for(int i=0;i<n;i++){
+ 		lower(i) = y(i)>0.5 ? 0.0 : -arma::datum::inf;
+ 		upper(i) = y(i)>0.5 ? arma::datum::inf : 0.0;
+ 	}
+ 	int seed = (int)(arma::randu<double>()*2147483647.0);
+ 	rand_trucnorm_fill(z.memptr(), mu, sigma, lower, upper, n, seed, 1);
+ 	if(!z.is_finite())
+ 		Rcpp::stop("the latent variables are not finite; the sampler has diverged");
+ }
+
+// the latent variables have unit variance, so the SVD X = U D V' diagonalizes
+// the posterior of beta for every value of tau2 and is computed only once
+ void one_step_probit_normal(arma::vec& betacoef, double& tau2, double& b_tau,
+                             arma::vec& z, arma::vec& mu, arma::vec& y,
+                             arma::mat& U, arma::vec& d, arma::vec& d2, arma::mat& V,
+                             arma::mat& X, double A2_tau, int p, int n){
+ 	//update z
+ 	probit_update_z(z, y, mu);
+ 	arma::vec zs = U.t()*z;
+
+ 	//update beta
+ 	if(p<n){
+ 		arma::vec beta_prec = d2 + 1.0/tau2;
+ 		arma::vec gamma = d%zs/beta_prec + arma::randn<arma::vec>(p)/sqrt(beta_prec);
+ 		betacoef = V*gamma;
+ 	} else{
+ 		arma::vec alpha_1 = arma::randn<arma::vec>(p)*sqrt(tau2);
+ 		arma::vec alpha_2 = arma::randn<arma::vec>(d.n_elem);
+ 		arma::vec beta_s = zs - d%(V.t()*alpha_1) - alpha_2;
+ 		beta_s %= tau2*d/(1.0 + tau2*d2);
+ 		betacoef = alpha_1 + V*beta_s;
+ 	}
+ 	mu = X*betacoef;
+
+ 	//update tau2
+ 	double sum_beta2 = arma::accu(betacoef%betacoef);
+ 	double inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+ }
+
+// XtX = X'X is fixed, so only the diagonal changes with the local scales;
+// for p >= n the n x n system of the fast sampler for Gaussian scale mixtures is used
+ void one_step_probit_horseshoe(arma::vec& betacoef, double& tau2, double& b_tau,
+                                arma::vec& lambda, arma::vec& b_lambda,
+                                arma::vec& z, arma::vec& mu, arma::vec& y,
+                                arma::mat& XtX, arma::mat& X,
+                                double A2_tau, double A2_lambda, int p, int n){
+ 	//update z
+ 	probit_update_z(z, y, mu);
+
+ 	//update beta
+ 	arma::vec lambda2 = lambda%lambda;
+ 	if(p<n){
+ 		arma::mat Q = XtX;
+ 		Q.diag() += 1.0/(tau2*lambda2);
+ 		arma::mat R = arma::chol(Q);
+ 		arma::vec b = arma::solve(arma::trimatl(R.t()),X.t()*z);
+ 		b += arma::randn<arma::vec>(p);
+ 		betacoef = arma::solve(arma::trimatu(R),b);
+ 	} else{
+ 		arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sqrt(tau2);
+ 		arma::vec alpha_2 = arma::randn<arma::vec>(n);
+ 		arma::mat XLambda = X;
+ 		XLambda.each_row() %= lambda.t();
+ 		arma::mat Z = XLambda*XLambda.t();
+ 		Z.diag() += 1.0/tau2;
+ 		arma::vec beta_s = arma::solve(Z,z - X*alpha_1 - alpha_2,arma::solve_opts::fast);
+ 		betacoef = alpha_1 + lambda%(XLambda.t()*beta_s);
+ 	}
+ 	mu = X*betacoef;
+
+ 	//update lambda
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2;
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
+
+ 	//update tau2
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 	double inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+ }
+
+ arma::vec probit_prob(arma::vec& mu){
+ 	arma::vec prob(mu.n_elem);
+ 	for(arma::uword i=0;i<mu.n_elem;i++)
+ 		prob(i) = R::pnorm(mu(i),0.0,1.0,1,0);
+ 	return prob;
+ }
+
+//'@title Fast Bayesian probit regression with normal priors
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the coefficient variance
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{tau2}{posterior mean of the coefficient variance}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of two components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of the coefficient variance}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res1 <- with(dat1,fast_normal_probit(y,X))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res2 <- with(dat2,fast_normal_probit(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,1.6*res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,1.6*res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'print(tab)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_normal_probit(arma::vec& y, arma::mat& X,
+                               int mcmc_sample = 500,
+                               int burnin = 500, int thinning = 1,
+                               double A_tau = 1){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+
+ 	double A2_tau = A_tau*A_tau;
+ 	double b_tau = A2_tau;
+ 	double tau2 = b_tau;
+
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+ 	arma::vec d2 = d%d;
+
+ 	arma::vec betacoef;
+ 	betacoef.zeros(p);
+ 	arma::vec mu;
+ 	mu.zeros(n);
+ 	arma::vec z;
+ 	z.zeros(n);
+
+ 	arma::mat betacoef_list;
+ 	arma::vec tau2_list;
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+ 	for(int iter=0;iter<burnin;iter++){
+ 		one_step_probit_normal(betacoef, tau2, b_tau, z, mu, y,
+                          U, d, d2, V, X, A2_tau, p, n);
+ 	}
+ 	for(int iter=0;iter<mcmc_sample;iter++){
+ 		for(int j=0;j<thinning;j++){
+ 			one_step_probit_normal(betacoef, tau2, b_tau, z, mu, y,
+                           U, d, d2, V, X, A2_tau, p, n);
+ 		}
+ 		betacoef_list.col(iter) = betacoef;
+ 		tau2_list(iter) = tau2;
+ 	}
+
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	tau2 = arma::mean(tau2_list);
+ 	mu = X*betacoef;
+
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_PROBIT));
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+//'@title Fast Bayesian probit regression with horseshoe priors
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{tau2}{posterior mean of the global shrinkage parameter}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{mu}{a vector of posterior predictive mean for linear predictor of the n training sample}
+//'\item{prob}{a vector of posterior predictive probability of the n training sample}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples for p regression coeficients. Each column is one MCMC sample}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_logit_reg(n=2000,p=200,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res1 <- with(dat1,fast_horseshoe_probit(y,X))
+//'dat2 <- sim_logit_reg(n=200,p=2000,X_cor=0.9,X_var=10,q=10,beta_size=5)
+//'res2 <- with(dat2,fast_horseshoe_probit(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,1.6*res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,1.6*res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'print(tab)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_horseshoe_probit(arma::vec& y, arma::mat& X,
+                                  int mcmc_sample = 500,
+                                  int burnin = 500, int thinning = 1,
+                                  double A_tau = 1, double A_lambda = 1){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+
+ 	double A2_tau = A_tau*A_tau;
+ 	double b_tau = A2_tau;
+ 	double tau2 = b_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+
+ 	arma::mat XtX;
+ 	if(p<n)
+ 		XtX = X.t()*X;
+
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	arma::vec mu;
+ 	arma::vec z;
+ 	lambda.ones(p);
+ 	b_lambda.ones(p);
+ 	betacoef.zeros(p);
+ 	mu.zeros(n);
+ 	z.zeros(n);
+
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec tau2_list;
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	lambda_list.zeros(p,mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+ 	for(int iter=0;iter<burnin;iter++){
+ 		one_step_probit_horseshoe(betacoef, tau2, b_tau, lambda, b_lambda,
+                             z, mu, y, XtX, X, A2_tau, A2_lambda, p, n);
+ 	}
+ 	for(int iter=0;iter<mcmc_sample;iter++){
+ 		for(int j=0;j<thinning;j++){
+ 			one_step_probit_horseshoe(betacoef, tau2, b_tau, lambda, b_lambda,
+                              z, mu, y, XtX, X, A2_tau, A2_lambda, p, n);
+ 		}
+ 		betacoef_list.col(iter) = betacoef;
+ 		lambda_list.col(iter) = lambda;
+ 		tau2_list(iter) = tau2;
+ 	}
+
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	lambda = arma::mean(lambda_list,1);
+ 	tau2 = arma::mean(tau2_list);
+ 	mu = X*betacoef;
+
+ 	Rcpp::RObject mu_r = Rcpp::wrap(mu);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef,
+                                            Named("tau2") = tau2,
+                                            Named("lambda") = lambda,
+                                            Named("mu") = mu_r,
+                                            Named("prob") = lazy_prob(mu_r, LAZY_LINK_PROBIT));
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("tau2") = tau2_list,
+                                       Named("lambda") = lambda_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+
+
+// impute the censored responses from N(mu_i, sigma2_eps) truncated to
+// (lower_i, upper_i) and refresh ys = U'y and sum(y^2) through the
+// censored rows only; Uc_t = t(U[cidx,])
+ void tobit_update_y(arma::vec& y_star, arma::vec& ys, double& sum_y2,
+                     arma::uvec& cidx, arma::vec& lower_c, arma::vec& upper_c,
+                     arma::vec& mu, double sigma2_eps, arma::mat& Uc_t){
+ 	int n_c = cidx.n_elem;
+ 	if(n_c==0)
+ 		return;
+ 	arma::vec mu_c = mu.elem(cidx);
+ 	arma::vec sigma = arma::ones<arma::vec>(1)*sqrt(sigma2_eps);
+ 	arma::vec y_c_old = y_star.elem(cidx);
+ 	arma::vec y_c(n_c);
+ 	int seed = (int)(arma::randu<double>()*2147483647.0);
+ 	rand_trucnorm_fill(y_c.memptr(), mu_c, sigma, lower_c, upper_c, n_c, seed, 1);
+ 	if(!y_c.is_finite())
+ 		Rcpp::stop("the imputed responses are not finite; the sampler has diverged");
+ 	y_star.elem(cidx) = y_c;
+ 	sum_y2 += arma::accu(y_c%y_c) - arma::accu(y_c_old%y_c_old);
+ 	ys += Uc_t*(y_c - y_c_old);
+ }
+
+// p < n update in the rotated coordinates; unlike one_step_update_big_n the
+// residual sum of squares outside the column space of X is kept, since the
+// noise variance drives the imputation of the censored responses
+ void one_step_update_tobit_big_n(arma::vec& betacoef, double& sigma2_eps, double& tau2,
+                                  double& b_tau, arma::vec& mu, arma::vec& ys,
+                                  arma::mat& V, arma::vec& d, arma::vec& d2,
+                                  arma::mat& X, double sum_y2,
+                                  double A2, double a_sigma, double b_sigma,
+                                  int p, int n){
+ 	double inv_tau2 = 1.0/tau2;
+ 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%sqrt(sigma2_eps/(d2 + inv_tau2));
+ 	arma::vec beta_s = d%ys/(d2 + inv_tau2) + alpha_1;
+ 	betacoef = V*beta_s;
+ 	mu = X*betacoef;
+ 	arma::vec eps = ys - d%beta_s;
+ 	double rss0 = sum_y2 - arma::accu(ys%ys);
+ 	if(rss0<0)
+ 		rss0 = 0.0;
+ 	double sum_eps2 = arma::accu(eps%eps) + rss0;
+ 	double sum_beta2 = arma::accu(beta_s%beta_s);
+ 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2/sigma2_eps)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+ 	double inv_sigma2_eps = randg<double>(distr_param(a_sigma+(n+p)/2.0, 1.0/(b_sigma+0.5*sum_beta2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+ }
+
+//'@title Fast Bayesian censored (Tobit) linear regression with normal priors
+//'@param y vector of n outcome variables; a censored observation is recorded at its censoring point
+//'@param X n x p matrix of candidate predictors
+//'@param lower vector of left censoring points (length one or n); y <= lower is
+//'treated as left censored. Use -Inf for no left censoring
+//'@param upper vector of right censoring points (length one or n); y >= upper is
+//'treated as right censored. Use Inf for no right censoring
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{y}{a vector of posterior mean of the latent uncensored outcomes}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{tau2}{a vector of MCMC samples of the ratio between prior regression coefficient variances and the noise variance}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'y_c <- pmax(dat$y,0)
+//'res <- fast_normal_tobit(y_c,dat$X,lower=0,upper=Inf)
+//'res0 <- fast_normal_lm(y_c,dat$X)
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef),
+//'comp_sparse_SSE(dat$betacoef,res0$post_mean$betacoef)),
+//'time=c(res$elapsed,res0$elapsed))
+//'rownames(tab)<-c("Tobit","ignoring censoring")
+//'print(tab)
+//'@export
+//[[Rcpp::export]]
+Rcpp::List fast_normal_tobit(arma::vec& y, arma::mat& X,
+                             arma::vec& lower, arma::vec& upper,
+                             int mcmc_sample = 500,
+                             int burnin = 500, int thinning = 1,
+                             double a_sigma = 0.01, double b_sigma = 0.01,
+                             double A_tau = 10){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	if((lower.n_elem!=1 && (int)lower.n_elem!=n) || (upper.n_elem!=1 && (int)upper.n_elem!=n))
+ 		Rcpp::stop("lower and upper must have length one or n");
+
+ 	//censored observations and their truncation intervals
+ 	std::vector<arma::uword> cidx_vec;
+ 	std::vector<double> lower_vec;
+ 	std::vector<double> upper_vec;
+ 	for(int i=0;i<n;i++){
+ 		double l_i = lower.n_elem==1 ? lower(0) : lower(i);
+ 		double u_i = upper.n_elem==1 ? upper(0) : upper(i);
+ 		if(y(i)<=l_i){
+ 			cidx_vec.push_back(i);
+ 			lower_vec.push_back(-arma::datum::inf);
+ 			upper_vec.push_back(l_i);
+ 		} else if(y(i)>=u_i){
+ 			cidx_vec.push_back(i);
+ 			lower_vec.push_back(u_i);
+ 			upper_vec.push_back(arma::datum::inf);
+ 		}
+ 	}
+ 	arma::uvec cidx(cidx_vec);
+ 	arma::vec lower_c(lower_vec);
+ 	arma::vec upper_c(upper_vec);
+
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+ 	arma::vec d2 = d%d;
+ 	arma::mat Uc_t = U.rows(cidx).t();
+
+ 	arma::vec y_star = y;
+ 	arma::vec ys = U.t()*y_star;
+ 	double sum_y2 = arma::accu(y_star%y_star);
+
+ 	arma::mat betacoef_list;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
+ 	arma::vec y_star_mean;
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+ 	y_star_mean.zeros(n);
+
+ 	arma::vec betacoef;
+ 	arma::vec mu;
+ 	arma::vec beta_s_mean;
+ 	arma::vec beta_s_sum = arma::zeros<arma::vec>(d.n_elem);
+ 	double sigma2_eps = b_sigma/a_sigma;
+ 	double A2 = A_tau*A_tau;
+ 	double b_tau = A2;
+ 	double tau2 = b_tau;
+
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		//update beta, tau2 and sigma2_eps given the imputed outcomes
+ 		if(p<n){
+ 			one_step_update_tobit_big_n(betacoef, sigma2_eps, tau2,
+                                b_tau, mu, ys, V, d, d2, X, sum_y2,
+                                A2, a_sigma, b_sigma, p, n);
+ 		} else{
+ 			one_step_update_big_p(betacoef, beta_s_mean, sigma2_eps, tau2,
+                          b_tau, mu, ys,  V,  d, d2, y_star,  X,
+                          A2,  a_sigma,  b_sigma, p,  n);
+ 		}
+ 		//update the censored outcomes
+ 		tobit_update_y(y_star, ys, sum_y2, cidx, lower_c, upper_c,
+                  mu, sigma2_eps, Uc_t);
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			betacoef_list.col(mcmc_iter) = betacoef;
+ 			if(p>=n)
+ 				beta_s_sum += beta_s_mean;
+ 			sigma2_eps_list(mcmc_iter) = sigma2_eps;
+ 			tau2_list(mcmc_iter) = tau2;
+ 			y_star_mean += y_star;
+ 		}
+ 	}
+
+ 	//Rao-Blackwellized posterior mean when p >= n; the p < n kernel draws
+ 	//in the rotated coordinates of the imputed outcomes and keeps the draws
+ 	if(p>=n)
+ 		betacoef = V*(beta_s_sum/mcmc_sample);
+ 	else
+ 		betacoef = arma::mean(betacoef_list,1);
+ 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	tau2 = arma::mean(tau2_list);
+ 	y_star_mean /= mcmc_sample;
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                            Named("betacoef") = betacoef,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("tau2") = tau2,
+                                            Named("y") = y_star_mean);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+
+ void hs_one_step_update_big_p(arma::vec& betacoef, arma::vec& lambda,
+                               double& sigma2_eps, double& tau2,
+                               double& b_tau, arma::vec& b_lambda, arma::vec& mu, arma::vec& ys,  arma::mat& V, arma::vec& d,arma::vec& d2,
+                               arma::vec& y, arma::mat& X, arma::mat& VD,
+                               double& A2_tau, double& A2_lambda,
+                               double a_sigma, double b_sigma,
+                               int p, int n){
+
+ 	arma::vec lambda2 = lambda%lambda;
+ 	double sigma_eps = sqrt(sigma2_eps);
+ 	double tau = sqrt(tau2);
+ 	double inv_tau2 = 1.0/tau2;
+ 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
+ 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
+ 	arma::mat LambdaVD = VD;
+ 	for(int i=0;i<n;i++){
+ 		LambdaVD.col(i) %= lambda;
+ 	}
+ 	arma::mat Z = LambdaVD.t()*LambdaVD;
+ 	Z.diag() += inv_tau2;
+ 	arma::vec beta_s = arma::solve(Z,ys - VD.t()*alpha_1 - alpha_2);
+ 	//std::cout << beta_s.subvec(0,1) << std::endl;
+ 	betacoef = alpha_1 + lambda2%(VD*beta_s);
+
+ 	//update lambda
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
+
+ 	//update lambda
+ 	// arma::vec betacoef2 = betacoef%betacoef;
+ 	// arma::vec B = 0.5*betacoef2/tau2/sigma2_eps;
+ 	// arma::vec inv_lambda2 = 1.0/(lambda%lambda);
+ 	// b_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
+ 	// arma::vec upsilon = arma::randu<arma::vec>(p);
+ 	// arma::vec C = 1.0/b_lambda - 1.0/A2_lambda;
+ 	// inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
+ 	// lambda = sqrt(1.0/inv_lambda2);
+
+
+ 	//update tau2, sigma2_eps, b_tau and b_lambda
+
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+
+ 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+ 	//inv_tau2 = 1e16;
+ 	/*double B_tau = 0.5*sum_beta2_inv_lambda2/sigma2_eps;
+ 	 double u_tau = arma::randu()*(A2_tau/(1.0+A2_tau*inv_tau2));
+ 	 double C_tau = 1.0/u_tau - 1.0/A2_tau;
+ 	 double v_tau = arma::randu()*exp(-B_tau*inv_tau2);
+ 	 double D_tau = -log(v_tau)/B_tau;
+ 	 if(D_tau > C_tau)
+ 	 D_tau = C_tau;
+ 	 double s_tau = arma::randu();
+ 	 inv_tau2 = D_tau*pow(s_tau,2.0/(p+1.0));*/
+ 	tau2 = 1.0/inv_tau2;
+
+ 	mu = X*betacoef;
+ 	arma::vec eps = y - mu;
+ 	double sum_eps2 = arma::accu(eps%eps);
+ 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+ }
+
+//hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+//b_tau, mu, dys,  V,  d, d2, y, X,
+//A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+
+ void hs_one_step_update_big_n(arma::vec& betacoef,
+                               arma::vec& lambda,
+                               double& sigma2_eps, double& tau2, arma::vec& b_lambda,
+                               double& b_tau, arma::vec& mu, arma::vec& dys,
+                               arma::mat& V, arma::vec& d2,
+                               arma::vec& y, arma::mat& X,
+                               double A2, double A2_lambda,
+                               double a_sigma, double b_sigma,
+                               int p, int n){
+
+ 	double inv_tau2 = 1.0/tau2;
+ 	//double tau = sqrt(tau2);
+ 	double sigma_eps = sqrt(sigma2_eps);
+ 	arma::vec lambda_tau = lambda*sqrt(tau2);
+ 	arma::mat V_d_lambda = V;
+ 	V_d_lambda.each_col() /= lambda_tau;
+
+ 	arma::mat VtV = V_d_lambda.t()*V_d_lambda;
+ 	VtV.diag() += d2;
+ 	//VtV /= sigma2_eps;
+
+ 	arma::mat R = arma::chol(VtV);
+ 	arma::vec b = arma::solve(R.t(),dys/sigma_eps,solve_opts::fast);
+ 	arma::vec alpha;
+ 	alpha.randn(p);
+ 	betacoef = sigma_eps*V*arma::solve(R,alpha+b,solve_opts::fast);
+
+
+
+ 	/*arma::vec taulambda= tau*lambda;
+ 	 arma::vec tau2lambda2 = taulambda%taulambda;
+ 	 arma::vec alpha_1 = arma::randn<arma::vec>(p)/d*sigma_eps;
+ 	 arma::vec alpha_2 = arma::randn<arma::vec>(p)%taulambda*sigma_eps;
+ 	 arma::vec ts = tau2lambda2%Xty;
+ 	 arma::vec Valpha_1 = V*alpha_1;
+ 	 arma::mat Z = XtX_inv;
+ 	 Z.diag() += tau2lambda2;
+ 	 arma::vec alpha = arma::solve(Z,ts - Valpha_1 - alpha_2)/sigma2_eps;
+ 	 betacoef = Valpha_1 + sigma2_eps*XtX_inv*alpha;
+ 	 */
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
+ 	lambda = sqrt(1.0/inv_lambda2);
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	mu = X*betacoef;
+ 	arma::vec eps = y - mu;
+ 	double sum_eps2 = arma::accu(eps%eps);
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef%betacoef%inv_lambda2);
+ 	//double sum_inv_lambda2 = arma::accu(inv_lambda2);
+ 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+ 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+
+ 	//std::cout << tau2 << std::endl;
+ 	//std::cout << arma::accu(lambda) << std::endl;
+ }
+
+//'@title Fast Bayesian linear regression with horseshoe priors
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param asis logical value; if true, each iteration is followed by an ancillarity-sufficiency
+//'interweaving step that redraws the global scale given the non-centred coefficients betacoef/sqrt(tau2).
+//'It costs O(n+p) per iteration and much improves the mixing of tau2 when the signal is weak. Default value is false
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{b_lambda}{posterior mean of the rate parameter in the prior for local shrinkage parameters}
+//'\item{tau2}{posterior mean of the global parameter}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{b_lambda}{a vector of MCMC samples of the rate parameter in the prior for local shrinkage parameters}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res1 <- with(dat1,fast_horseshoe_lm(y,X))
+//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
+//'res2 <- with(dat2,fast_horseshoe_lm(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'fast_horseshoe_tab <- tab
+//'print(fast_horseshoe_tab)
+//'@export
+ 	//[[Rcpp::export]]
+ 	 Rcpp::List fast_horseshoe_lm(arma::vec& y, arma::mat& X,
+                                int mcmc_sample = 500,
+                                int burnin = 500, int thinning = 1,
+                                double a_sigma = 0.0, double b_sigma = 0.0,
+                                double A_tau = 1, double A_lambda = 1,
+                                bool asis = false){
+
+ 	 	arma::wall_clock timer;
+ 	 	timer.tic();
+ 	 	arma::vec d;
+ 	 	arma::mat U;
+ 	 	arma::mat V;
+ 	 	arma::svd_econ(U,d,V,X);
+
+ 	 	int p = X.n_cols;
+ 	 	int n = X.n_rows;
+ 	 	double sigma2_eps = 1;
+ 	 	if(a_sigma!=0.0){
+ 	 		sigma2_eps = b_sigma/a_sigma;
+ 	 	}
+ 	 	double A2 = A_tau*A_tau;
+ 	 	double A2_lambda = A_lambda*A_lambda;
+ 	 	double b_tau = 1;
+
+ 	 	double tau2 = 1.0/p;
+ 	 	arma::vec d2 = d%d;
+ 	 	arma::vec ys = U.t()*y;
+ 	 	arma::vec dys = d%ys;
+
+
+
+ 	 	arma::vec betacoef;
+ 	 	arma::vec lambda;
+ 	 	arma::vec b_lambda;
+ 	 	lambda.ones(p);
+ 	 	b_lambda.ones(p);
+ 	 	arma::vec mu;
+
+ 	 	arma::mat betacoef_list;
+ 	 	arma::mat lambda_list;
+ 	 	arma::vec sigma2_eps_list;
+ 	 	arma::vec tau2_list;
+
+ 	 	betacoef_list.zeros(p,mcmc_sample);
+ 	 	lambda_list.zeros(p,mcmc_sample);
+ 	 	sigma2_eps_list.zeros(mcmc_sample);
+ 	 	tau2_list.zeros(mcmc_sample);
+
+
+ 	 	if(p<n){
+
+
+ 	 		for(int iter=0;iter<burnin;iter++){
+ 	 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                               b_tau, mu, dys,  V,   d2, y, X,
+                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 	 			if(asis)
+ 	 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(mu%mu), arma::dot(mu,y), sigma2_eps, A2);
+ 	 		}
+ 	 		for(int iter=0;iter<mcmc_sample;iter++){
+ 	 			for(int j=0;j<thinning;j++){
+ 	 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                                b_tau, mu, dys,  V,  d2, y, X, A2,
+                                A2_lambda, a_sigma,  b_sigma, p,  n);
+ 	 				if(asis)
+ 	 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(mu%mu), arma::dot(mu,y), sigma2_eps, A2);
+ 	 			}
+ 	 			betacoef_list.col(iter) = betacoef;
+ 	 			lambda_list.col(iter) = lambda;
+ 	 			sigma2_eps_list(iter) = sigma2_eps;
+ 	 			tau2_list(iter) = tau2;
+ 	 		}
+ 	 	} else{
+ 	 		arma::mat VD = V;
+ 	 		for(int j=0;j<p;j++){
+ 	 			VD.row(j) %= d.t();
+ 	 		}
+ 	 		for(int iter=0;iter<burnin;iter++){
+ 	 			hs_one_step_update_big_p(betacoef, lambda, sigma2_eps, tau2,
+                               b_tau, b_lambda, mu, ys,  V,  d, d2, y,  X, VD,
+                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 	 			if(asis)
+ 	 				asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(mu%mu), arma::dot(mu,y), sigma2_eps, A2);
+ 	 		}
+ 	 		for(int iter=0;iter<mcmc_sample;iter++){
+ 	 			for(int j=0;j<thinning;j++){
+ 	 				hs_one_step_update_big_p(betacoef, lambda, sigma2_eps, tau2,
+                                b_tau,b_lambda, mu, ys,  V,  d, d2, y,  X, VD,
+                                A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 	 				if(asis)
+ 	 					asis_update_tau2(betacoef, mu, tau2, b_tau, arma::accu(mu%mu), arma::dot(mu,y), sigma2_eps, A2);
+ 	 			}
+ 	 			betacoef_list.col(iter) = betacoef;
+ 	 			lambda_list.col(iter) = lambda;
+ 	 			sigma2_eps_list(iter) = sigma2_eps;
+ 	 			tau2_list(iter) = tau2;
+ 	 		}
+
+ 	 	}
+
+ 	 	betacoef = arma::mean(betacoef_list,1);
+ 	 	lambda = arma::mean(lambda_list,1);
+ 	 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	 	tau2 = arma::mean(tau2_list);
+
+ 	 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                              Named("betacoef") = betacoef,
+                                              Named("lambda") = lambda,
+                                              Named("sigma2_eps") = sigma2_eps,
+                                              Named("tau2") = tau2);
+ 	 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                         Named("lambda") = lambda_list,
+                                         Named("sigma2_eps") = sigma2_eps_list,
+                                         Named("tau2") = tau2_list);
+
+ 	 	double elapsed = timer.toc();
+ 	 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("mcmc") = mcmc,
+                              Named("elapsed") = elapsed);
+ 	 }
+
+
+ void hs_one_step_update(arma::vec& betacoef, arma::vec& lambda,
+                         double& sigma2_eps, double& tau2,
+                         double& b_tau, arma::vec& b_lambda, arma::vec& mu,
+                         arma::vec& y, arma::mat& X,
+                         double& A2, double& A2_lambda,
+                         double a_sigma, double b_sigma,
+                         int p, int n){
+
+ 	double sigma_eps = sqrt(sigma2_eps);
+ 	double tau = sqrt(tau2);
+ 	double inv_tau2 = 1.0/tau2;
+ 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
+ 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
+ 	arma::mat XLambda = X;
+ 	for(int i=0;i<n;i++){
+ 		XLambda.row(i) %= lambda.t();
+ 	}
+ 	arma::mat Z = XLambda*XLambda.t();
+ 	Z.diag() += inv_tau2;
+ 	arma::vec beta_s = arma::solve(Z,y - X*alpha_1 - alpha_2,arma::solve_opts::fast);
+ 	//std::cout << beta_s.subvec(0,1) << std::endl;
+ 	betacoef = alpha_1 + lambda%(XLambda.t()*beta_s);
+ 	//update lambda
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*betacoef2/tau2/sigma2_eps;
+ 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
+ 	//update tau2, sigma2_eps, b_tau and b_lambda
+ 	mu = X*betacoef;
+ 	arma::vec eps = y - mu;
+ 	double sum_eps2 = arma::accu(eps%eps);
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 	//double sum_inv_lambda2 = arma::accu(inv_lambda2);
+ 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+ 	inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(b_tau+0.5*sum_beta2_inv_lambda2*inv_sigma2_eps)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+
+ }
+
+ void hs_one_step_update_slice_sampler(arma::vec& betacoef, arma::vec& lambda,
+                                       double& sigma2_eps, double& tau2,
+                                       double& u_tau, arma::vec& u_lambda, arma::vec& mu,
                                        arma::vec& y, arma::mat& X,
                                        double& A2_tau, double& A2_lambda,
                                        double a_sigma, double b_sigma,
                                        int p, int n){
 
- 	double sigma_eps = sqrt(sigma2_eps);
- 	double tau = sqrt(tau2);
- 	double inv_tau2 = 1.0/tau2;
- 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
- 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
- 	arma::mat XLambda = X;
- 	for(int i=0;i<n;i++){
- 		XLambda.row(i) %= lambda.t();
- 	}
- 	arma::mat Z = XLambda*XLambda.t();
- 	Z.diag() += inv_tau2;
- 	arma::vec beta_s = arma::solve(Z,y - X*alpha_1 - alpha_2,arma::solve_opts::fast);
- 	//std::cout << beta_s.subvec(0,1) << std::endl;
- 	betacoef = alpha_1 + lambda%(XLambda.t()*beta_s);
+ 	double sigma_eps = sqrt(sigma2_eps);
+ 	double tau = sqrt(tau2);
+ 	double inv_tau2 = 1.0/tau2;
+ 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda*sigma_eps*tau;
+ 	arma::vec alpha_2 = arma::randn<arma::vec>(n)*sigma_eps;
+ 	arma::mat XLambda = X;
+ 	for(int i=0;i<n;i++){
+ 		XLambda.row(i) %= lambda.t();
+ 	}
+ 	arma::mat Z = XLambda*XLambda.t();
+ 	Z.diag() += inv_tau2;
+ 	arma::vec beta_s = arma::solve(Z,y - X*alpha_1 - alpha_2,arma::solve_opts::fast);
+ 	//std::cout << beta_s.subvec(0,1) << std::endl;
+ 	betacoef = alpha_1 + lambda%(XLambda.t()*beta_s);
+
+ 	//update lambda
+ 	arma::vec betacoef2 = betacoef%betacoef;
+ 	arma::vec B = 0.5*betacoef2/tau2/sigma2_eps;
+ 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
+ 	u_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
+ 	arma::vec upsilon = arma::randu<arma::vec>(p);
+ 	arma::vec C = 1.0/u_lambda - 1.0/A2_lambda;
+ 	inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
+ 	//std::cout << inv_lambda2 << std::endl;
+ 	lambda = sqrt(1.0/inv_lambda2);
+
+ 	//update tau2,  b_tau
+
+ 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
+ 	double B_tau = 0.5*sum_beta2_inv_lambda2/sigma2_eps;
+ 	u_tau = arma::randu()*(A2_tau/(1.0+A2_tau*inv_tau2));
+ 	double C_tau = 1.0/u_tau - 1.0/A2_tau;
+
+ 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("stats");
+ 	Rcpp::Function pgamma = pkg["pgamma"];
+ 	Rcpp::Function qgamma = pkg["qgamma"];
+ 	Rcpp::NumericVector F_C_tau = pgamma(C_tau,(p+1.0)/2.0,B_tau);
+ 	Rcpp::NumericVector inv_F_tau = qgamma(arma::randu()*F_C_tau,(p+1.0)/2.0,B_tau);
+ 	inv_tau2 = inv_F_tau(0);
+ 	//double m_log_v_tau_B_tau = -log(arma::randu())/B_tau + inv_tau2;
+ 	//double D_tau = m_log_v_tau_B_tau;
+ 	//if(D_tau > C_tau)
+ 	//	D_tau = C_tau;
+ 	//double s_tau = arma::randu();
+ 	//inv_tau2 = D_tau*pow(s_tau,2.0/(p+1.0));
+
+
+ 	//std::cout << inv_tau2 << std::endl;
+
+ 	//inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(u_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
+ 	//u_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
+
+ 	tau2 = 1.0/inv_tau2;
+
+
+ 	//update sigma2_eps,
+ 	mu = X*betacoef;
+ 	arma::vec eps = y - mu;
+ 	double sum_eps2 = arma::accu(eps%eps);
+ 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+
+ }
+
+//'@title Fast Bayesian high-dimensional linear regression with horseshoe priors using slice sampler
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{tau2}{posterior mean of the global parameter}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res1 <- with(dat1,fast_horseshoe_ss_lm(y,X))
+//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
+//'res2 <- with(dat2,fast_horseshoe_ss_lm(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'fast_horseshoe_tab <- tab
+//'print(fast_horseshoe_tab)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X,
+                                 int mcmc_sample = 500,
+                                 int burnin = 500, int thinning = 1,
+                                 double a_sigma = 0.0, double b_sigma = 0.0,
+                                 double A_tau = 1, double A_lambda = 1){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
+ 	}
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double b_tau = 1;
+
+ 	double tau2 = 1.0/p;
+
+
+
+
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	lambda.ones(p);
+ 	b_lambda.ones(p);
+ 	arma::vec mu;
+
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
+
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	lambda_list.zeros(p,mcmc_sample);
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+
+ 	if(p<n){
+ 		arma::vec d;
+ 		arma::mat U;
+ 		arma::mat V;
+ 		arma::svd_econ(U,d,V,X);
+
+ 		arma::vec d2 = d%d;
+ 		arma::vec dys = d%(U.t()*y);
+
+ 		for(int iter=0;iter<burnin;iter++){
+ 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                             b_tau, mu, dys,  V,  d2, y, X,
+                             A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                              b_tau, mu, dys,  V,  d2, y, X,
+                              A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			sigma2_eps_list(iter) = sigma2_eps;
+ 			tau2_list(iter) = tau2;
+ 		}
+ 	} else{
+
+ 		for(int iter=0;iter<burnin;iter++){
+ 			hs_one_step_update_slice_sampler(betacoef, lambda, sigma2_eps, tau2,
+                                     b_tau, b_lambda, mu,  y,  X,
+                                     A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				hs_one_step_update_slice_sampler(betacoef, lambda, sigma2_eps, tau2,
+                                      b_tau,b_lambda, mu,  y,  X,
+                                      A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			sigma2_eps_list(iter) = sigma2_eps;
+ 			tau2_list(iter) = tau2;
+ 		}
+
+ 	}
+
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	lambda = arma::mean(lambda_list,1);
+ 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	tau2 = arma::mean(tau2_list);
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                            Named("betacoef") = betacoef,
+                                            Named("lambda") = lambda,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("tau2") = tau2);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("lambda") = lambda_list,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+double super_fast_normal_lm_svd(arma::vec& betacoef, double& sigma2_eps,
+                                const arma::mat& U, const arma::vec& d, const arma::mat& V,
+                                const arma::vec& y, double theta);
+
+// empirical Bayes starting values of the horseshoe samplers: the ridge
+// penalty theta maximizing the marginal likelihood of the normal prior model
+// gives the noise variance and tau2 = 1/theta
+void horseshoe_eb_init(double& sigma2_eps, double& tau2,
+                       const arma::mat& U, const arma::vec& d, const arma::mat& V,
+                       const arma::vec& y){
+	arma::vec betacoef;
+	double sigma2_eb = 1.0;
+	double theta = super_fast_normal_lm_svd(betacoef, sigma2_eb, U, d, V, y, -1.0);
+	if(theta>0 && sigma2_eb>0){
+		sigma2_eps = sigma2_eb;
+		tau2 = 1.0/theta;
+	}
+}
+
+// fast_horseshoe_hd_lm restricted to a working set of columns. The set starts
+// from the screen_size columns of largest marginal correlation with y (SIS).
+// During burnin, every screen_every iterations each excluded column is checked
+// against the current residual and reinserted when its standardized score
+// |X_j'(y - mu)|/(sigma_eps*||X_j||) exceeds sqrt(2 log p), a level that null
+// columns rarely reach. The working set is kept fixed after burnin
+ Rcpp::List screened_horseshoe_hd_lm(arma::vec& y, arma::mat& X,
+                                     int mcmc_sample, int burnin, int thinning,
+                                     double a_sigma, double b_sigma,
+                                     double A_tau, double A_lambda,
+                                     int screen_size, int screen_every,
+                                     bool init_eb){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
+ 	}
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double b_tau = 1;
+
+ 	//marginal screening
+ 	arma::vec x_norm(p);
+ 	for(int j=0;j<p;j++)
+ 		x_norm(j) = arma::norm(X.col(j));
+ 	x_norm.elem(arma::find(x_norm==0)).ones();
+ 	arma::vec score = arma::abs(X.t()*y)/x_norm;
+ 	arma::uvec order = arma::sort_index(score,"descend");
+ 	arma::uvec active = arma::sort(order.head(screen_size));
+ 	double threshold = sqrt(2.0*log((double)p));
+ 	int n_reinserted = 0;
+
+ 	int p_w = active.n_elem;
+ 	double tau2 = 1.0/p_w;
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	lambda.ones(p_w);
+ 	b_lambda.ones(p_w);
+ 	arma::vec mu;
+
+ 	arma::mat X_w;
+ 	arma::mat V;
+ 	arma::vec d2;
+ 	arma::vec dys;
+ 	bool rebuild = true;
+
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+ 	int total_iter = burnin + mcmc_sample*thinning;
+ 	for(int iter=0;iter<total_iter;iter++){
+ 		if(rebuild){
+ 			X_w = X.cols(active);
+ 			p_w = active.n_elem;
+ 			arma::vec d;
+ 			arma::mat U;
+ 			if(p_w<n || (init_eb && iter==0))
+ 				arma::svd_econ(U,d,V,X_w);
+ 			if(p_w<n){
+ 				d2 = d%d;
+ 				dys = d%(U.t()*y);
+ 			}
+ 			if(init_eb && iter==0)
+ 				horseshoe_eb_init(sigma2_eps, tau2, U, d, V, y);
+ 			rebuild = false;
+ 		}
+ 		if(p_w<n){
+ 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                              b_tau, mu, dys,  V,  d2, y, X_w,
+                              A2, A2_lambda, a_sigma,  b_sigma, p_w,  n);
+ 		} else{
+ 			hs_one_step_update(betacoef, lambda, sigma2_eps, tau2,
+                        b_tau, b_lambda, mu,  y,  X_w,
+                        A2, A2_lambda, a_sigma,  b_sigma, p_w,  n);
+ 		}
+
+ 		//reinsert the excluded columns that fail the check
+ 		if(iter<burnin && (iter+1)%screen_every==0 && p_w<p){
+ 			arma::uvec in_active = arma::zeros<arma::uvec>(p);
+ 			in_active.elem(active).ones();
+ 			arma::uvec excluded = arma::find(in_active==0);
+ 			arma::vec z = X.t()*(y - mu);
+ 			z = arma::abs(z.elem(excluded))/(x_norm.elem(excluded)*sqrt(sigma2_eps));
+ 			arma::uvec add = excluded.elem(arma::find(z>threshold));
+ 			if(add.n_elem>0){
+ 				arma::vec betacoef_p = arma::zeros<arma::vec>(p);
+ 				arma::vec lambda_p = arma::ones<arma::vec>(p);
+ 				arma::vec b_lambda_p = arma::ones<arma::vec>(p);
+ 				betacoef_p.elem(active) = betacoef;
+ 				lambda_p.elem(active) = lambda;
+ 				b_lambda_p.elem(active) = b_lambda;
+ 				active = arma::sort(arma::join_cols(active,add));
+ 				betacoef = betacoef_p.elem(active);
+ 				lambda = lambda_p.elem(active);
+ 				b_lambda = b_lambda_p.elem(active);
+ 				n_reinserted += add.n_elem;
+ 				rebuild = true;
+ 			}
+ 		}
+
+ 		if(iter>=burnin && (iter-burnin+1)%thinning==0){
+ 			int mcmc_iter = (iter-burnin)/thinning;
+ 			if(mcmc_iter==0){
+ 				betacoef_list.zeros(p_w,mcmc_sample);
+ 				lambda_list.zeros(p_w,mcmc_sample);
+ 			}
+ 			betacoef_list.col(mcmc_iter) = betacoef;
+ 			lambda_list.col(mcmc_iter) = lambda;
+ 			sigma2_eps_list(mcmc_iter) = sigma2_eps;
+ 			tau2_list(mcmc_iter) = tau2;
+ 		}
+ 	}
+
+ 	//coefficients of the screened out columns are zero
+ 	arma::mat betacoef_list_p = arma::zeros<arma::mat>(p,mcmc_sample);
+ 	arma::mat lambda_list_p = arma::zeros<arma::mat>(p,mcmc_sample);
+ 	betacoef_list_p.rows(active) = betacoef_list;
+ 	lambda_list_p.rows(active) = lambda_list;
+
+ 	betacoef = arma::mean(betacoef_list_p,1);
+ 	lambda = arma::mean(lambda_list_p,1);
+ 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	tau2 = arma::mean(tau2_list);
+
+ 	arma::uvec working_set = active + 1;
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X_w*betacoef.elem(active),
+                                            Named("betacoef") = betacoef,
+                                            Named("lambda") = lambda,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("tau2") = tau2);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list_p,
+                                       Named("lambda") = lambda_list_p,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("working_set") = working_set,
+                            Named("n_reinserted") = n_reinserted,
+                            Named("elapsed") = elapsed);
+ }
+
+//'@title Fast Bayesian high-dimensional linear regression with horseshoe priors
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save; a negative value
+//'means 500, or 100 when init is "eb"
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param screen_size number of columns kept by marginal correlation screening
+//'before sampling; 0 means no screening. During burnin the screened out columns
+//'are checked against the residual every screen_every iterations and the
+//'strongly associated ones are put back
+//'@param screen_every number of burnin iterations between two checks of the screened out columns
+//'@param init "zero" to start from the prior scale values or "eb" to start the
+//'noise variance and the global shrinkage parameter at the empirical Bayes
+//'estimates of \link{super_fast_normal_lm}
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{b_lambda}{posterior mean of the rate parameter in the prior for local shrinkage parameters}
+//'\item{tau2}{posterior mean of the global parameter}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{b_lambda}{a vector of MCMC samples of the rate parameter in the prior for local shrinkage parameters}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'}
+//'\item{working_set}{indices of the columns sampled when screen_size is positive;
+//'coefficients of the other columns are zero}
+//'\item{n_reinserted}{number of screened out columns put back during burnin when screen_size is positive}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res1 <- with(dat1,fast_horseshoe_ss_lm(y,X))
+//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
+//'res2 <- with(dat2,fast_horseshoe_ss_lm(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'fast_horseshoe_tab <- tab
+//'print(fast_horseshoe_tab)
+//'res3 <- with(dat2,fast_horseshoe_hd_lm(y,X,screen_size=200,init="eb"))
+//'print(comp_sparse_SSE(dat2$betacoef,res3$post_mean$betacoef))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X,
+                                 int mcmc_sample = 500,
+                                 int burnin = -1, int thinning = 1,
+                                 double a_sigma = 0.0, double b_sigma = 0.0,
+                                 double A_tau = 1, double A_lambda = 1,
+                                 int screen_size = 0, int screen_every = 50,
+                                 std::string init = "zero"){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	if(init!="zero" && init!="eb")
+ 		Rcpp::stop("init must be \"zero\" or \"eb\"");
+ 	bool init_eb = init=="eb";
+ 	if(burnin<0)
+ 		burnin = init_eb ? 100 : 500;
+ 	if(screen_size>0 && screen_size<p){
+ 		if(screen_every<1)
+ 			Rcpp::stop("screen_every must be positive");
+ 		return screened_horseshoe_hd_lm(y, X, mcmc_sample, burnin, thinning,
+                                   a_sigma, b_sigma, A_tau, A_lambda,
+                                   screen_size, screen_every, init_eb);
+ 	}
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
+ 	}
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double b_tau = 1;
+
+ 	double tau2 = 1.0/p;
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	if(p<n || init_eb)
+ 		arma::svd_econ(U,d,V,X);
+ 	if(init_eb)
+ 		horseshoe_eb_init(sigma2_eps, tau2, U, d, V, y);
+
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	lambda.ones(p);
+ 	b_lambda.ones(p);
+ 	arma::vec mu;
+
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
+
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	lambda_list.zeros(p,mcmc_sample);
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
+
+
+ 	if(p<n){
+ 		arma::vec d2 = d%d;
+ 		arma::vec dys = d%(U.t()*y);
+
+ 		for(int iter=0;iter<burnin;iter++){
+ 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                             b_tau, mu, dys,  V,   d2, y, X,
+                             A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                              b_tau, mu, dys,  V,  d2, y, X,
+                              A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			sigma2_eps_list(iter) = sigma2_eps;
+ 			tau2_list(iter) = tau2;
+ 		}
+ 	} else{
+
+ 		for(int iter=0;iter<burnin;iter++){
+ 			hs_one_step_update(betacoef, lambda, sigma2_eps, tau2,
+                       b_tau, b_lambda, mu,  y,  X,
+                       A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 		}
+ 		for(int iter=0;iter<mcmc_sample;iter++){
+ 			for(int j=0;j<thinning;j++){
+ 				hs_one_step_update(betacoef, lambda, sigma2_eps, tau2,
+                        b_tau,b_lambda, mu,  y,  X,
+                        A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 			}
+ 			betacoef_list.col(iter) = betacoef;
+ 			lambda_list.col(iter) = lambda;
+ 			sigma2_eps_list(iter) = sigma2_eps;
+ 			tau2_list(iter) = tau2;
+ 		}
+
+ 	}
+
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	lambda = arma::mean(lambda_list,1);
+ 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	tau2 = arma::mean(tau2_list);
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                            Named("betacoef") = betacoef,
+                                            Named("lambda") = lambda,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("tau2") = tau2);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("lambda") = lambda_list,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
+                            Named("elapsed") = elapsed);
+ }
+
+
+// one Gibbs sweep of q horseshoe regressions sharing the thin SVD X = U D V';
+// W = D V', ys = U'y and rss0 holds the residual sums of squares outside the
+// column space of X. All random numbers are drawn serially up front, so only
+// the per-outcome solves and shrinkage updates run on the OpenMP threads.
+// Returns the number of outcomes whose linear system could not be solved
+ int hs_one_step_update_multi(arma::mat& betacoef, arma::mat& lambda,
+                              arma::vec& sigma2_eps, arma::vec& tau2,
+                              arma::vec& b_tau, arma::mat& b_lambda,
+                              arma::mat& ys, arma::mat& V, arma::mat& W,
+                              arma::vec& d, arma::vec& d2, arma::vec& rss0,
+                              double A2, double A2_lambda,
+                              double a_sigma, double b_sigma,
+                              int p, int n, int n_threads){
+ 	int q = ys.n_cols;
+ 	int r = ys.n_rows;
+ 	arma::mat alpha_1 = arma::randn<arma::mat>(p,q);
+ 	arma::mat alpha_2 = arma::randn<arma::mat>(r,q);
+ 	arma::mat g_lambda = arma::randg<arma::mat>(p,q,distr_param(1.0,1.0));
+ 	arma::mat g_b_lambda = arma::randg<arma::mat>(p,q,distr_param(1.0,1.0));
+ 	arma::vec g_tau = arma::randg<arma::vec>(q,distr_param((1.0+p)/2.0,1.0));
+ 	arma::vec g_b_tau = arma::randg<arma::vec>(q,distr_param(1.0,1.0));
+ 	arma::vec g_sigma = arma::randg<arma::vec>(q,distr_param(a_sigma+(p+n)/2.0,1.0));
+
+ 	bool use_precision = p<n;
+ 	arma::vec sigma_eps = sqrt(sigma2_eps);
+ 	arma::vec tau = sqrt(tau2);
+ 	arma::mat W_alpha_1;
+ 	if(!use_precision){
+ 		//one GEMM for the prior draws of all outcomes
+ 		alpha_1 %= lambda;
+ 		alpha_1.each_row() %= (sigma_eps%tau).t();
+ 		alpha_2.each_row() %= sigma_eps.t();
+ 		W_alpha_1 = W*alpha_1;
+ 	}
+
+ 	//update beta
+ 	int n_fail = 0;
+ 	#pragma omp parallel for schedule(dynamic) reduction(+:n_fail) num_threads(get_num_threads(n_threads))
+ 	for(int k=0;k<q;k++){
+ 		if(use_precision){
+ 			//p x p system
+ 			arma::mat V_d_lambda = V;
+ 			V_d_lambda.each_col() /= lambda.col(k)*tau(k);
+ 			arma::mat VtV = V_d_lambda.t()*V_d_lambda;
+ 			VtV.diag() += d2;
+ 			arma::mat R;
+ 			if(!arma::chol(R,VtV)){
+ 				n_fail++;
+ 				continue;
+ 			}
+ 			arma::vec b = arma::solve(arma::trimatl(R.t()),d%ys.col(k)/sigma_eps(k));
+ 			b += alpha_1.col(k);
+ 			betacoef.col(k) = sigma_eps(k)*V*arma::solve(arma::trimatu(R),b);
+ 		} else{
+ 			//n x n system
+ 			arma::mat W_lambda = W;
+ 			W_lambda.each_row() %= lambda.col(k).t();
+ 			arma::mat Z = W_lambda*W_lambda.t();
+ 			Z.diag() += 1.0/tau2(k);
+ 			arma::vec beta_s;
+ 			arma::vec rhs = ys.col(k) - W_alpha_1.col(k) - alpha_2.col(k);
+ 			if(!arma::solve(beta_s,Z,rhs,arma::solve_opts::fast)){
+ 				n_fail++;
+ 				continue;
+ 			}
+ 			betacoef.col(k) = alpha_1.col(k) + lambda.col(k)%(W_lambda.t()*beta_s);
+ 		}
+ 	}
+ 	if(n_fail>0)
+ 		return n_fail;
+
+ 	//residuals of all outcomes in one GEMM
+ 	arma::mat eps = ys - W*betacoef;
+ 	arma::rowvec sum_eps2 = arma::sum(eps%eps,0);
+ 	arma::mat betacoef2 = betacoef%betacoef;
+
+ 	//update lambda, tau2, sigma2_eps, b_tau and b_lambda
+ 	#pragma omp parallel for schedule(static) num_threads(get_num_threads(n_threads))
+ 	for(int k=0;k<q;k++){
+ 		arma::vec inv_lambda2 = g_lambda.col(k)/(b_lambda.col(k) + 0.5*betacoef2.col(k)/tau2(k)/sigma2_eps(k));
+ 		lambda.col(k) = sqrt(1.0/inv_lambda2);
+ 		b_lambda.col(k) = g_b_lambda.col(k)/(1.0/A2_lambda+inv_lambda2);
+ 		double sum_beta2_inv_lambda2 = arma::accu(betacoef2.col(k)%inv_lambda2);
+ 		double inv_tau2 = g_tau(k)/(b_tau(k)+0.5*sum_beta2_inv_lambda2/sigma2_eps(k));
+ 		b_tau(k) = g_b_tau(k)/(1.0/A2 + inv_tau2);
+ 		tau2(k) = 1.0/inv_tau2;
+ 		sigma2_eps(k) = (b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*(sum_eps2(k)+rss0(k)))/g_sigma(k);
+ 	}
+ 	return 0;
+ }
+
+//'@title Fast Bayesian linear regression with horseshoe priors with multiple outcome variables
+//'@param y n x q matrix of q outcome variables with n observations
+//'@param X n x p matrix of p candidate predictors with n observations
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param mcmc_output logical value; if false only the running posterior means are kept,
+//'so memory does not grow with mcmc_sample. Default value is true
+//'@param n_threads number of OpenMP threads for the per-outcome updates; 0 uses all available threads
+//'@param display_progress logical value; Default value is false
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a matrix of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x q matrix of posterior mean of regression coeficients}
+//'\item{lambda}{a p x q matrix of posterior mean of local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance of each outcome}
+//'\item{tau2}{a vector of posterior mean of the global parameter of each outcome}
+//'}
+//'\item{mcmc}{a list object of three components for MCMC samples, returned when mcmc_output is true}
+//'\describe{
+//'\item{betacoef}{an array of MCMC samples of p by q regression coeficients}
+//'\item{sigma2_eps}{a q x mcmc_sample matrix of MCMC samples of the noise variance}
+//'\item{tau2}{a q x mcmc_sample matrix of MCMC samples of the global shrinkage parameter}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat1 <- sim_linear_reg_multi(n=2000,p=200,X_cor=0.9,q=6)
+//'res1 <- with(dat1,fast_horseshoe_multi_lm(y,X,mcmc_output=FALSE))
+//'dat2 <- sim_linear_reg_multi(n=200,p=2000,X_cor=0.9,q=6)
+//'res2 <- with(dat2,fast_horseshoe_multi_lm(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'print(tab)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List fast_horseshoe_multi_lm(arma::mat& y, arma::mat& X,
+                                    int mcmc_sample = 500,
+                                    int burnin = 500, int thinning = 1,
+                                    double a_sigma = 0.0, double b_sigma = 0.0,
+                                    double A_tau = 1, double A_lambda = 1,
+                                    bool mcmc_output = true,
+                                    int n_threads = 0,
+                                    bool display_progress = false){
+
+ 	arma::wall_clock timer;
+ 	timer.tic();
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	int q = y.n_cols;
+ 	if((int)y.n_rows != n)
+ 		Rcpp::stop("y and X must have the same number of rows");
+
+ 	//one factorization shared by all outcomes
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+ 	arma::vec d2 = d%d;
+ 	arma::mat W = arma::diagmat(d)*V.t();
+ 	arma::mat ys = U.t()*y;
+ 	arma::vec rss0 = arma::sum(y%y,0).t() - arma::sum(ys%ys,0).t();
+ 	rss0.elem(arma::find(rss0<0)).zeros();
+
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	arma::vec sigma2_eps = arma::ones<arma::vec>(q);
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps *= b_sigma/a_sigma;
+ 	}
+ 	arma::vec b_tau = arma::ones<arma::vec>(q);
+ 	arma::vec tau2 = arma::ones<arma::vec>(q)/p;
+ 	arma::mat betacoef = arma::zeros<arma::mat>(p,q);
+ 	arma::mat lambda = arma::ones<arma::mat>(p,q);
+ 	arma::mat b_lambda = arma::ones<arma::mat>(p,q);
+
+ 	arma::cube betacoef_list;
+ 	arma::mat sigma2_eps_list;
+ 	arma::mat tau2_list;
+
+ 	arma::mat betacoef_mean = arma::zeros<arma::mat>(p,q);
+ 	arma::mat lambda_mean = arma::zeros<arma::mat>(p,q);
+ 	arma::vec sigma2_eps_mean = arma::zeros<arma::vec>(q);
+ 	arma::vec tau2_mean = arma::zeros<arma::vec>(q);
+
+ 	if(mcmc_output){
+ 		betacoef_list.zeros(p,q,mcmc_sample);
+ 		sigma2_eps_list.zeros(q,mcmc_sample);
+ 		tau2_list.zeros(q,mcmc_sample);
+ 	}
+
+ 	int total_iter = burnin+thinning*mcmc_sample;
+ 	Progress pb(total_iter, display_progress);
+
+ 	for(int iter=0;iter<burnin;iter++){
+ 		if(hs_one_step_update_multi(betacoef, lambda, sigma2_eps, tau2,
+                               b_tau, b_lambda, ys, V, W, d, d2, rss0,
+                               A2, A2_lambda, a_sigma, b_sigma, p, n, n_threads)>0)
+ 			Rcpp::stop("failed to solve the linear system in the update of betacoef");
+ 		pb.increment();
+ 	}
+ 	for(int iter=0;iter<mcmc_sample;iter++){
+ 		for(int j=0;j<thinning;j++){
+ 			if(hs_one_step_update_multi(betacoef, lambda, sigma2_eps, tau2,
+                                b_tau, b_lambda, ys, V, W, d, d2, rss0,
+                                A2, A2_lambda, a_sigma, b_sigma, p, n, n_threads)>0)
+ 				Rcpp::stop("failed to solve the linear system in the update of betacoef");
+ 			pb.increment();
+ 		}
+ 		if(mcmc_output){
+ 			betacoef_list.slice(iter) = betacoef;
+ 			sigma2_eps_list.col(iter) = sigma2_eps;
+ 			tau2_list.col(iter) = tau2;
+ 		}
+ 		betacoef_mean += betacoef;
+ 		lambda_mean += lambda;
+ 		sigma2_eps_mean += sigma2_eps;
+ 		tau2_mean += tau2;
+ 	}
+
+ 	betacoef = betacoef_mean/mcmc_sample;
+ 	lambda = lambda_mean/mcmc_sample;
+ 	sigma2_eps = sigma2_eps_mean/mcmc_sample;
+ 	tau2 = tau2_mean/mcmc_sample;
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                            Named("betacoef") = betacoef,
+                                            Named("lambda") = lambda,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("tau2") = tau2);
+ 	double elapsed = timer.toc();
+ 	if(mcmc_output){
+ 		Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                         Named("sigma2_eps") = sigma2_eps_list,
+                                         Named("tau2") = tau2_list);
+ 		return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("mcmc") = mcmc,
+                              Named("elapsed") = elapsed);
+ 	} else{
+ 		return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("elapsed") = elapsed);
+ 	}
+ }
+
+//'@title Prediction with fast Bayesian linear regression fitting
+//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{mean}{a vector of \eqn{n} posterior predictive mean values}
+//'\item{ucl}{a vector of \eqn{n}  posterior \eqn{\alpha} level upper credible limits}
+//'\item{lcl}{a vector of \eqn{n}  posterior \eqn{\alpha} level lower credible limits}
+//'\item{median}{a vector of \eqn{n}  posterior predictive median values}
+//'\item{sd}{a vector of \eqn{n}  posterior predictive standard deviation values}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'train_idx = 1:round(length(dat$y)/2)
+//'test_idx = setdiff(1:length(dat$y),train_idx)
+//'res <- fast_horseshoe_lm(dat$y[train_idx],dat$X[train_idx,])
+//'pred_res <- predict_fast_lm(res,dat$X[test_idx,])
+//'plot(dat$y[test_idx,],pred_res$mean,
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
+//'ylab = "Predictions")
+//'abline(0,1)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95){
+
+ 	Rcpp::List mcmc = model_fit["mcmc"];
+ 	arma::mat betacoef = mcmc["betacoef"];
+ 	arma::mat pred_mu = X_test*betacoef;
+ 	double alpha_1 = (1-alpha)*0.5;
+ 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
+ 	arma::vec pred_mean = arma::mean(pred_mu,1);
+ 	arma::mat pred_cls = arma::quantile(pred_mu,pvec,1);
+ 	arma::vec pred_median = arma::median(pred_mu,1);
+ 	arma::vec pred_sd = arma::stddev(pred_mu,0,1);
+
+
+ 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mean,
+                                       Named("ucl") = pred_cls.col(0),
+                                       Named("lcl") = pred_cls.col(1),
+                                       Named("median") = pred_median,
+                                       Named("sd") = pred_sd);
+
+ 	return pred;
+ }
+
+//'@title Prediction with fast Bayesian linear regression fitting with multiple outcomes
+//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{mean}{a matrix of \eqn{n} by \eqn{q} posterior predictive mean values}
+//'\item{ucl}{a matrix of \eqn{n} by \eqn{q}  posterior \eqn{\alpha} level upper credible limits}
+//'\item{lcl}{a vector of \eqn{n} by \eqn{q}  posterior \eqn{\alpha} level lower credible limits}
+//'\item{median}{a vector of \eqn{n} by \eqn{q}  posterior predictive median values}
+//'\item{sd}{a vector of \eqn{n} by \eqn{q}  posterior predictive standard deviation values}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg_multi(n=2000,p=200,m=5,X_cor=0.9,q=6)
+//'train_idx = 1:round(nrow(dat$y)/2)
+//'test_idx = setdiff(1:nrow(dat$y),train_idx)
+//'res <- fast_normal_multi_lm(dat$y[train_idx,],dat$X[train_idx,])
+//'pred_res <- predict_fast_multi_lm(res,dat$X[test_idx,])
+//'plot(dat$y[test_idx,1],pred_res$mean[,1],
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
+//'ylab = "Predictions")
+//'abline(0,1)
+//'@export
+//[[Rcpp::export]]
+Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test){
+
+	Rcpp::List post_mean = model_fit["post_mean"];
+ 	arma::mat betacoef = post_mean["betacoef"];
+ 	arma::mat pred_mu = arma::zeros<arma::mat>(X_test.n_rows,betacoef.n_cols);
+ 	for(int i=0;i<betacoef.n_cols;i++){
+ 		pred_mu.col(i) = X_test*betacoef.col(i);
+ 	}
+
+
+ 	//arma::mat pred_mean = arma::mean(pred_mu,2);
+ 	//arma::mat pred_sd = arma::stddev(pred_mu,0,2);
+
+
+ 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mu);
+
+ 	return pred;
+}
+
+
+//'@title Prediction with fast mean field variational Bayesian linear regression fitting
+//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
+//'@return a list object consisting
+//'\describe{
+//'\item{mean}{a vector of \eqn{n} posterior predictive mean values}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'train_idx = 1:round(length(dat$y)/2)
+//'test_idx = setdiff(1:length(dat$y),train_idx)
+//'res <- fast_mfvb_normal_lm(dat$y[train_idx],dat$X[train_idx,])
+//'pred_res <- predict_fast_mfvb_lm(res,dat$X[test_idx,])
+//'plot(dat$y[test_idx,],pred_res$mean,
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
+//'ylab = "Predictions")
+//'abline(0,1)
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test){
+
+ 	Rcpp::List post_mean = model_fit["post_mean"];
+ 	arma::vec betacoef = post_mean["betacoef"];
+ 	arma::vec pred_mean = X_test*betacoef;
+
+ 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mean);
+ 	return pred;
+ }
+
+//'@title Prediction with fast Bayesian logistic regression fitting
+//'@param model_fit  output list object of fast Bayesian logistic regression fitting (see value of \link{fast_horseshoe_lm} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
+//'@param cutoff threshold value for posterior predicitve probablity. The default value is 0.5
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{class}{a vector of \eqn{n} predicted class indicators}
+//'\item{mean}{a vector of \eqn{n} posterior predictive mean probabilities}
+//'\item{ucl}{a vector of \eqn{n}  posterior \eqn{\alpha} level upper credible limits of probabilities}
+//'\item{lcl}{a vector of \eqn{n}  posterior \eqn{\alpha} level lower credible limits of probabilities}
+//'\item{median}{a vector of \eqn{n}  posterior predictive median probabilities}
+//'\item{sd}{a vector of \eqn{n}  standard deviations of posterior predictive probabilities}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'train_idx = 1:round(length(dat$y)/2)
+//'test_idx = setdiff(1:length(dat$y),train_idx)
+//'res <- fast_normal_logit(dat$y[train_idx],dat$X[train_idx,])
+//'pred_res <- predict_fast_logit(res,dat$X[test_idx,])
+//'plot(dat$prob[test_idx,],pred_res$mean,
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
+//'ylab = "Predicted Probabilities")
+//'abline(0,1)
+//'print(comp_class_acc(pred_res$class,dat$y[test_idx]))
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test,
+                               double alpha = 0.95, double cutoff = 0.5){
+
+ 	Rcpp::List mcmc = model_fit["mcmc"];
+ 	arma::mat betacoef = mcmc["betacoef"];
+ 	arma::mat pred_mu = X_test*betacoef;
+ 	arma::mat pred_prob;
+ 	link_apply<sigmoid_kernel>(pred_mu, pred_prob);
+ 	double alpha_1 = (1-alpha)*0.5;
+ 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
+ 	arma::vec pred_mean = arma::mean(pred_prob,1);
+ 	arma::mat pred_cls = arma::quantile(pred_prob,pvec,1);
+ 	arma::vec pred_median = arma::median(pred_prob,1);
+ 	arma::vec pred_sd = arma::stddev(pred_prob,0,1);
+ 	arma::uvec pred_class;
+ 	pred_class.zeros(pred_mean.n_elem);
+ 	pred_class.elem(arma::find(pred_mean>cutoff)).ones();
+
+
+ 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
+                                       Named("mean") = pred_mean,
+                                       Named("ucl") = pred_cls.col(0),
+                                       Named("lcl") = pred_cls.col(1),
+                                       Named("median") = pred_median,
+                                       Named("sd") = pred_sd);
+
+ 	return pred;
+ }
+
+//'@title Prediction with fast Bayesian multinomial logistic regression fitting
+//'@param model_fit  output list object of fast Bayesian multinomial logistic regression fitting (see value of \link{fast_horseshoe_lm} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{class}{a vector of \eqn{n} predicted class indicators}
+//'\item{mean}{a matrix of \eqn{n} by \eqn{K} posterior predictive mean probabilities}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,
+//'beta_size=1,intercept0=c(5,-5,-10,-10))
+//'train_idx = 1:round(length(dat$y)/2)
+//'test_idx = setdiff(1:length(dat$y),train_idx)
+//'res <- fast_normal_multiclass(dat$y[train_idx],dat$X[train_idx,])
+//'pred_res <- predict_fast_multiclass(res,dat$X[test_idx,])
+//'mean(pred_res$class!=dat$y[test_idx])
+//'@export
+//[[Rcpp::export]]
+ Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit,
+                                    arma::mat& X_test){
+
+ 	Rcpp::List mcmc = model_fit["mcmc"];
+ 	arma::cube betacoef = mcmc["betacoef"];
+ 	int nclass = betacoef.n_slices+1;
+ 	int mcmc_sample = betacoef.n_cols;
+ 	int npred = X_test.n_rows;
+
+
+ 	arma::cube log_1_prob(npred,mcmc_sample,nclass-1);
+ 	arma::cube prob(npred,mcmc_sample,nclass-1);
+ 	arma::mat log_prob(npred,mcmc_sample);
 
- 	//update lambda
- 	arma::vec betacoef2 = betacoef%betacoef;
- 	arma::vec B = 0.5*betacoef2/tau2/sigma2_eps;
- 	arma::vec inv_lambda2 = 1.0/(lambda%lambda);
- 	u_lambda = arma::randu<arma::vec>(p)%(A2_lambda/(1.0+A2_lambda*inv_lambda2));
- 	arma::vec upsilon = arma::randu<arma::vec>(p);
- 	arma::vec C = 1.0/u_lambda - 1.0/A2_lambda;
- 	inv_lambda2 = -arma::log1p(-upsilon%(1.0 - exp(-B%C)))/B;
- 	//std::cout << inv_lambda2 << std::endl;
- 	lambda = sqrt(1.0/inv_lambda2);
+ 	for(int k=nclass-1;k>=1;k--){
+ 		arma::mat log_1_prob_k;
+ 		log_sigmoid_both(X_test*betacoef.slice(k-1), log_prob, log_1_prob_k);
+ 		log_1_prob.slice(k-1) = log_1_prob_k;
+ 		prob.slice(k-1) = log_prob;
+ 		if(k<nclass - 1){
+ 			for(int j=k;j<nclass-1;j++){
+ 				prob.slice(k-1) += log_1_prob.slice(j);
+ 			}
+ 		}
+ 	}
 
- 	//update tau2,  b_tau
+ 	prob = exp(prob);
+ 	arma::mat mean_prob = arma::mean(prob,1);
+ 	arma::vec prob0 = 1.0 - arma::sum(mean_prob,1);
+ 	mean_prob = arma::join_rows(prob0,mean_prob);
 
- 	double sum_beta2_inv_lambda2 = arma::accu(betacoef2%inv_lambda2);
- 	double B_tau = 0.5*sum_beta2_inv_lambda2/sigma2_eps;
- 	u_tau = arma::randu()*(A2_tau/(1.0+A2_tau*inv_tau2));
- 	double C_tau = 1.0/u_tau - 1.0/A2_tau;
 
- 	Rcpp::Environment pkg = Rcpp::Environment::namespace_env("stats");
- 	Rcpp::Function pgamma = pkg["pgamma"];
- 	Rcpp::Function qgamma = pkg["qgamma"];
- 	Rcpp::NumericVector F_C_tau = pgamma(C_tau,(p+1.0)/2.0,B_tau);
- 	Rcpp::NumericVector inv_F_tau = qgamma(arma::randu()*F_C_tau,(p+1.0)/2.0,B_tau);
- 	inv_tau2 = inv_F_tau(0);
- 	//double m_log_v_tau_B_tau = -log(arma::randu())/B_tau + inv_tau2;
- 	//double D_tau = m_log_v_tau_B_tau;
- 	//if(D_tau > C_tau)
- 	//	D_tau = C_tau;
- 	//double s_tau = arma::randu();
- 	//inv_tau2 = D_tau*pow(s_tau,2.0/(p+1.0));
 
 
- 	//std::cout << inv_tau2 << std::endl;
+ 	arma::uvec pred_class = index_max(mean_prob,1);
 
- 	//inv_tau2 = randg<double>(distr_param((1.0+p)/2.0,1.0/(u_tau+0.5*sum_beta2_inv_lambda2/sigma2_eps)));
- 	//u_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2_tau + inv_tau2)));
 
- 	tau2 = 1.0/inv_tau2;
 
 
- 	//update sigma2_eps,
- 	mu = X*betacoef;
- 	arma::vec eps = y - mu;
- 	double sum_eps2 = arma::accu(eps%eps);
- 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(p+n)/2, 1.0/(b_sigma+0.5*sum_beta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
- 	sigma2_eps = 1.0/inv_sigma2_eps;
+ 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
+                                       Named("mean") = mean_prob);
 
+ 	return pred;
  }
 
-//'@title Fast Bayesian high-dimensional linear regression with horseshoe priors using slice sampler
-//'@param y vector of n outcome variables
-//'@param X n x p matrix of candidate predictors
-//'@param mcmc_sample number of MCMC iterations saved
-//'@param burnin number of iterations before start to save
-//'@param thinning number of iterations to skip between two saved iterations
-//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
-//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
-//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
-//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
-//'@return a list object consisting of two components
-//'\describe{
-//'\item{post_mean}{a list object of four components for posterior mean statistics}
-//'\describe{
-//'\item{mu}{a vector of posterior predictive mean of the n training sample}
-//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
-//'\item{sigma2_eps}{posterior mean of the noise variance}
-//'\item{tau2}{posterior mean of the global parameter}
-//'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
+
+//'@title Prediction with fast mean field variational Bayesian logistic regression fitting
+//'@param model_fit output list object of fast mean field variational Bayesian logistic regression fitting (see value of \link{fast_mfvb_normal_logit} as an example)
+//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
+//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
+//'@param cutoff threshold value for posterior predicitve probablity. The default value is 0.5
+//'@return a list object consisting of three components
 //'\describe{
-//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
-//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
-//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
-//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
-//'}
+//'\item{class}{a vector of \eqn{n} predicted class indicators}
+//'\item{prob}{a vector of \eqn{n} posterior predictive mean probabilities}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'set.seed(2022)
-//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'res1 <- with(dat1,fast_horseshoe_ss_lm(y,X))
-//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
-//'res2 <- with(dat2,fast_horseshoe_ss_lm(y,X))
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
-//'time=c(res1$elapsed,res2$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
-//'fast_horseshoe_tab <- tab
-//'print(fast_horseshoe_tab)
+//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,q=6,beta_size=5)
+//'train_idx = 1:round(length(dat$y)/2)
+//'test_idx = setdiff(1:length(dat$y),train_idx)
+//'res_mcmc <- fast_normal_logit(dat$y[train_idx],dat$X[train_idx,])
+//'res <- fast_mfvb_normal_logit(dat$y[train_idx],dat$X[train_idx,])
+//'pred_res <- predict_fast_mfvb_logit(res,dat$X[test_idx,])
+//'pred_res_mcmc <- predict_fast_logit(res_mcmc,dat$X[test_idx,])
+//'par(mfrow=c(1,2))
+//'plot(dat$prob[test_idx,],pred_res$prob,
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
+//'ylab = "Predicted Probabilities",main="MFVB")
+//'abline(0,1)
+//'plot(dat$prob[test_idx,],pred_res_mcmc$mean,
+//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
+//'ylab = "Predicted Probabilities",main="MCMC")
+//'abline(0,1)
+//'mfvb <- comp_class_acc(pred_res$class,dat$y[test_idx])
+//'mcmc <- comp_class_acc(pred_res_mcmc$class,dat$y[test_idx])
+//'tab <- rbind(mfvb,mcmc)
+//'print(tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_horseshoe_ss_lm(arma::vec& y, arma::mat& X,
-                                 int mcmc_sample = 500,
-                                 int burnin = 500, int thinning = 1,
-                                 double a_sigma = 0.0, double b_sigma = 0.0,
-                                 double A_tau = 1, double A_lambda = 1){
+ Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test,
+                                    double alpha = 0.95, double cutoff = 0.5){
 
- 	arma::wall_clock timer;
- 	timer.tic();
+ 	Rcpp::List post_mean = model_fit["post_mean"];
+ 	arma::vec betacoef = post_mean["betacoef"];
+ 	arma::vec pred_mu = X_test*betacoef;
+ 	arma::vec pred_prob;
+ 	link_apply<sigmoid_kernel>(pred_mu, pred_prob);
+ 	double alpha_1 = (1-alpha)*0.5;
+ 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
+ 	arma::uvec pred_class;
+ 	pred_class.zeros(pred_prob.n_elem);
+ 	pred_class.elem(arma::find(pred_prob>cutoff)).ones();
 
- 	int p = X.n_cols;
- 	int n = X.n_rows;
- 	double sigma2_eps = 1;
- 	if(a_sigma!=0.0){
- 		sigma2_eps = b_sigma/a_sigma;
+
+ 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
+                                       Named("prob") = pred_prob);
+
+ 	return pred;
+ }
+
+
+
+// add sign*X.col(j)*Phi.row(j) to Z when delta(j) flips; Phi_t = Phi.t() so
+// that row j of Phi is a sparse column
+ void scalar_img_update_Z(arma::mat& Z, arma::mat& X, arma::sp_mat& Phi_t,
+                          int j, double sign){
+ 	arma::sp_mat::const_col_iterator it_end = Phi_t.end_col(j);
+ 	for(arma::sp_mat::const_col_iterator it=Phi_t.begin_col(j);it!=it_end;++it){
+ 		Z.col(it.row()) += sign*(*it)*X.col(j);
  	}
- 	double A2 = A_tau*A_tau;
- 	double A2_lambda = A_lambda*A_lambda;
- 	double b_tau = 1;
+ }
 
- 	double tau2 = 1.0/p;
+// number of sweeps between two rebuilds of Z'Z and Z'y from Z, which bounds
+// the rounding error accumulated by the updates below
+const int scalar_img_rebuild_every = 50;
+
+// bring Z'Z and Z'y up to date after the flips of one sweep, with Z already
+// updated: for D = X_F*S*Phi_F' of the flipped columns F with signs S,
+// Z'Z gains Z'D + D'Z - D'D. When more than L columns flipped, or on a
+// rebuild sweep, Z'Z is formed from Z directly, which costs no more
+ void scalar_img_update_ZtZ(arma::mat& ZtZ, arma::vec& Zty, arma::mat& Z,
+                            arma::vec& y, arma::mat& X, arma::vec& Xty,
+                            arma::sp_mat& Phi_t, std::vector<arma::uword>& flip,
+                            std::vector<double>& flip_sign, bool rebuild){
+ 	int L = Z.n_cols;
+ 	int num_flip = flip.size();
+ 	if(rebuild || num_flip > L){
+ 		ZtZ = Z.t()*Z;
+ 		Zty = Z.t()*y;
+ 		return;
+ 	}
+ 	if(num_flip==0)
+ 		return;
+ 	arma::uvec flip_idx(flip);
+ 	arma::mat X_F = X.cols(flip_idx);
+ 	//P = S*Phi_F, with the rows of Phi read as sparse columns of Phi_t
+ 	arma::mat P = arma::zeros<arma::mat>(num_flip, L);
+ 	for(int f=0;f<num_flip;f++){
+ 		arma::sp_mat::const_col_iterator it_end = Phi_t.end_col(flip[f]);
+ 		for(arma::sp_mat::const_col_iterator it=Phi_t.begin_col(flip[f]);it!=it_end;++it){
+ 			P(f,it.row()) = flip_sign[f]*(*it);
+ 		}
+ 	}
+ 	arma::mat ZtD = (Z.t()*X_F)*P;
+ 	arma::mat DtD = P.t()*(X_F.t()*X_F)*P;
+ 	ZtZ += ZtD + ZtD.t() - DtD;
+ 	arma::vec Xty_F = Xty.elem(flip_idx);
+ 	Zty += P.t()*Xty_F;
+ }
+
+ void scalar_img_one_step_update(arma::vec& theta, arma::uvec& delta, arma::vec& lambda,
+                                 double& sigma2_eps, double& tau2,
+                                 double& b_tau, arma::vec& b_lambda,  arma::vec& betacoef,
+                                 arma::vec& y, arma::mat& X, arma::vec& Xty,
+                                 arma::mat& Z, arma::mat& ZtZ, arma::vec& Zty,
+                                 arma::sp_mat& Phi, arma::sp_mat& Phi_t, arma::vec& eps,
+                                 double& A2, double& A2_lambda,
+                                 double a_sigma, double b_sigma, double rss0,
+                                 int p, int n, int L, bool rebuild){
+
+ 	bool use_precision = L < (int)X.n_rows;
+
+ 	//update delta; Z follows every flip, while Z'Z and Z'y are updated
+ 	//once for all the flips of the sweep
+ 	std::vector<arma::uword> flip;
+ 	std::vector<double> flip_sign;
+ 	for(int j=0;j<p;j++){
+ 		arma::vec xphi_j = X.col(j)*betacoef(j);
+ 		arma::vec eps_j = eps;
+ 		if(delta(j)==1L){
+ 			eps_j += xphi_j;
+ 		}
+ 		arma::vec eps_j_1 = eps_j - xphi_j;
+ 		double log_prob_1 = -0.5*arma::accu(eps_j_1%eps_j_1)/sigma2_eps;
+ 		double log_prob_0 = -0.5*arma::accu(eps_j%eps_j)/sigma2_eps;
+ 		double prob = 0.0;
+ 		if(log_prob_1>log_prob_0){
+ 			prob = 1.0/(1.0+exp(log_prob_0-log_prob_1));
+ 		} else{
+ 			prob = exp(log_prob_1-log_prob_0);
+ 			prob = prob/(1+prob);
+ 		}
+ 		arma::uword delta_j = arma::randu<double>() < prob ? 1L : 0L;
+ 		if(delta_j==1L){
+ 			eps = eps_j_1;
+ 		} else{
+ 			eps = eps_j;
+ 		}
+ 		//update Z by a rank-one change
+ 		if(delta_j != delta(j)){
+ 			double sign = delta_j==1L ? 1.0 : -1.0;
+ 			scalar_img_update_Z(Z, X, Phi_t, j, sign);
+ 			flip.push_back(j);
+ 			flip_sign.push_back(sign);
+ 			delta(j) = delta_j;
+ 		}
+ 	}
+ 	if(use_precision)
+ 		scalar_img_update_ZtZ(ZtZ, Zty, Z, y, X, Xty, Phi_t, flip, flip_sign, rebuild);
 
+ 	//update theta
+ 	arma::vec lambda2 = lambda%lambda;
+ 	double sigma_eps = sqrt(sigma2_eps);
+ 	double tau = sqrt(tau2);
+ 	double inv_tau2 = 1.0/tau2;
+ 	if(use_precision){
+ 		//L x L precision matrix
+ 		arma::mat Q = ZtZ;
+ 		Q.diag() += inv_tau2/lambda2;
+ 		arma::mat R;
+ 		if(!arma::chol(R,Q))
+ 			Rcpp::stop("Cholesky decomposition failed in the update of theta");
+ 		arma::vec w = arma::solve(arma::trimatl(R.t()),Zty);
+ 		w += sigma_eps*arma::randn<arma::vec>(L);
+ 		theta = arma::solve(arma::trimatu(R),w);
+ 	} else{
+ 		//n x n system
+ 		int n_row = X.n_rows;
+ 		arma::vec alpha_1 = arma::randn<arma::vec>(L)%lambda;
+ 		alpha_1 *= sigma_eps*tau;
+ 		arma::vec alpha_2 = arma::randn<arma::vec>(n_row);
+ 		alpha_2 *= sigma_eps;
+ 		arma::mat LambdaZt = Z.t();
+ 		LambdaZt.each_col() %= lambda;
+ 		arma::mat ZZt = arma::eye(n_row,n_row);
+ 		ZZt += tau2*LambdaZt.t()*LambdaZt;
+ 		arma::vec theta_s = arma::solve(ZZt, y - Z*alpha_1 - alpha_2,arma::solve_opts::fast);
+ 		theta = alpha_1 + tau2*lambda2%(Z.t()*theta_s);
+ 	}
+ 	//update betacoef
+ 	betacoef = Phi*theta;
+ 	//update eps
+ 	eps = y - Z*theta;
 
 
+ 	//update lambda
+ 	arma::vec theta2 = theta%theta;
+ 	arma::vec inv_lambda2 = arma::randg<arma::vec>(L,distr_param(1.0,1.0));
+ 	inv_lambda2 /= b_lambda + 0.5*theta2/tau2/sigma2_eps;
+ 	b_lambda = randg<arma::vec>(L,distr_param(1.0, 1.0));
+ 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
+ 	lambda = sqrt(1.0/inv_lambda2);
 
- 	arma::vec betacoef;
- 	arma::vec lambda;
- 	arma::vec b_lambda;
- 	lambda.ones(p);
- 	b_lambda.ones(p);
- 	arma::vec mu;
+ 	//update tau2, sigma2_eps, b_tau and b_lambda
+ 	double sum_eps2 = arma::accu(eps%eps) + rss0;
+ 	double sum_theta2_inv_lambda2 = arma::accu(theta2%inv_lambda2);
+ 	inv_tau2 = randg<double>(distr_param((1.0+L)/2.0,1.0/(b_tau+0.5*sum_theta2_inv_lambda2/sigma2_eps)));
+ 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
+ 	tau2 = 1.0/inv_tau2;
+ 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(L+n)/2.0, 1.0/(b_sigma+0.5*sum_theta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
+ 	sigma2_eps = 1.0/inv_sigma2_eps;
+ }
 
- 	arma::mat betacoef_list;
- 	arma::mat lambda_list;
- 	arma::vec sigma2_eps_list;
- 	arma::vec tau2_list;
+// mean field variational updates of the normal linear model given the SVD
+// of X; ys = U'y. The optional flag lets a background job stop the updates
+ void mfvb_normal_lm_svd(arma::vec& betacoef, double& sigma2_eps, double& tau2,
+                         arma::vec& t_E2_list, arma::vec& t_B2_list,
+                         arma::vec& t_tau2_list, arma::vec& t_sigma2_eps_list,
+                         const arma::vec& d, const arma::mat& V, const arma::vec& ys,
+                         int p, int n, int max_iter,
+                         double a_sigma, double b_sigma, double A_tau, double tol,
+                         double t_sigma2_eps_0, double t_tau2_0,
+                         const std::atomic<bool>* cancel = NULL){
+ 	double A2_tau = A_tau*A_tau;
+ 	arma::vec d2 = d%d;
+ 	arma::vec ys2 = ys%ys;
+
+ 	t_tau2_list.zeros(max_iter);
+ 	t_E2_list.zeros(max_iter);
+ 	t_B2_list.zeros(max_iter);
+ 	t_sigma2_eps_list.zeros(max_iter);
+
+ 	if(t_tau2_0<=0){
+ 		t_tau2_0 = A2_tau;
+ 	}
+
+ 	double t_sigma2_eps = t_sigma2_eps_0;
+ 	double t_tau2 = t_tau2_0;
+ 	double t_b_tau = t_tau2;
+ 	arma::vec d2_t_tau2 = d2*t_tau2;
+ 	arma::vec inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2 );
+ 	arma::vec ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
+ 	double t_B2 = t_tau2*arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
+                                  t_sigma2_eps)%inv_one_d2_t_tau2);
+ 	double t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
+ 	double t_B2_0 = 2*t_B2;
+ 	double err = abs(t_B2 - t_B2_0);
 
- 	betacoef_list.zeros(p,mcmc_sample);
- 	lambda_list.zeros(p,mcmc_sample);
- 	sigma2_eps_list.zeros(mcmc_sample);
- 	tau2_list.zeros(mcmc_sample);
+ 	if(p<n){
 
+ 		int iter = 0;
+ 		while((iter<max_iter) & (err > tol*t_B2_0)){
+ 			if(cancel!=NULL && cancel->load())
+ 				break;
+ 			t_sigma2_eps = (t_E2 + t_B2/t_tau2+2*b_sigma)/(2*(p+a_sigma));
+ 			t_b_tau = t_tau2*A2_tau/(t_tau2+A2_tau);
+ 			t_tau2 = (t_b_tau + t_B2/t_sigma2_eps)/(p+1);
+ 			d2_t_tau2 = d2*t_tau2;
+ 			inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2);
+ 			ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
+ 			t_B2_0 = t_B2;
+ 			t_B2 = t_tau2*arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
+ 				t_sigma2_eps)%inv_one_d2_t_tau2);
 
- 	if(p<n){
- 		arma::vec d;
- 		arma::mat U;
- 		arma::mat V;
- 		arma::svd_econ(U,d,V,X);
+ 			t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
+ 			err = abs(t_B2-t_B2_0);
 
- 		arma::vec d2 = d%d;
- 		arma::vec dys = d%(U.t()*y);
+ 			t_E2_list(iter) = t_E2;
+ 			t_B2_list(iter) = t_B2;
+ 			t_tau2_list(iter) = t_tau2;
+ 			t_sigma2_eps_list(iter) = t_sigma2_eps;
 
- 		for(int iter=0;iter<burnin;iter++){
- 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                             b_tau, mu, dys,  V,  d2, y, X,
-                             A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 			iter++;
  		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                              b_tau, mu, dys,  V,  d2, y, X,
-                              A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			sigma2_eps_list(iter) = sigma2_eps;
- 			tau2_list(iter) = tau2;
+ 		betacoef = V*(inv_one_d2_t_tau2%d%ys)*t_tau2;
+ 		if(iter<max_iter){
+ 			t_E2_list.shed_rows(iter,max_iter-1);
+ 			t_B2_list.shed_rows(iter,max_iter-1);
+ 			t_tau2_list.shed_rows(iter,max_iter-1);
+ 			t_sigma2_eps_list.shed_rows(iter,max_iter-1);
  		}
+
  	} else{
 
- 		for(int iter=0;iter<burnin;iter++){
- 			hs_one_step_update_slice_sampler(betacoef, lambda, sigma2_eps, tau2,
-                                     b_tau, b_lambda, mu,  y,  X,
-                                     A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				hs_one_step_update_slice_sampler(betacoef, lambda, sigma2_eps, tau2,
-                                      b_tau,b_lambda, mu,  y,  X,
-                                      A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			sigma2_eps_list(iter) = sigma2_eps;
- 			tau2_list(iter) = tau2;
- 		}
+ 		int iter = 0;
+ 		while((iter<max_iter) & (err > tol*t_B2_0)){
+ 			if(cancel!=NULL && cancel->load())
+ 				break;
+ 			t_sigma2_eps = (t_E2 + t_B2/t_tau2+2*b_sigma)/(p+n+2*a_sigma);
+ 			t_b_tau = t_tau2*A2_tau/(t_tau2+A2_tau);
+ 			t_tau2 = (t_b_tau + t_B2/t_sigma2_eps)/(p+1);
+ 			d2_t_tau2 = d2*t_tau2;
+ 			inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2);
+ 			ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
+ 			t_B2_0 = t_B2;
+ 			t_B2 = t_tau2*(arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
+ 				t_sigma2_eps)%inv_one_d2_t_tau2)+(p - n)*t_sigma2_eps);
 
- 	}
+ 			t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
+ 			err = abs(t_B2-t_B2_0);
 
- 	betacoef = arma::mean(betacoef_list,1);
- 	lambda = arma::mean(lambda_list,1);
- 	sigma2_eps = arma::mean(sigma2_eps_list);
- 	tau2 = arma::mean(tau2_list);
+ 			t_E2_list(iter) = t_E2;
+ 			t_B2_list(iter) = t_B2;
+ 			t_tau2_list(iter) = t_tau2;
+ 			t_sigma2_eps_list(iter) = t_sigma2_eps;
 
- 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
-                                            Named("betacoef") = betacoef,
-                                            Named("lambda") = lambda,
-                                            Named("sigma2_eps") = sigma2_eps,
-                                            Named("tau2") = tau2);
- 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                       Named("lambda") = lambda_list,
-                                       Named("sigma2_eps") = sigma2_eps_list,
-                                       Named("tau2") = tau2_list);
+ 			iter++;
+ 		}
+ 		betacoef = V*(inv_one_d2_t_tau2%d%ys)*t_tau2;
+ 		if(iter<max_iter){
+ 			t_E2_list.shed_rows(iter,max_iter-1);
+ 			t_B2_list.shed_rows(iter,max_iter-1);
+ 			t_tau2_list.shed_rows(iter,max_iter-1);
+ 			t_sigma2_eps_list.shed_rows(iter,max_iter-1);
+ 		}
+ 	}
 
- 	double elapsed = timer.toc();
- 	return Rcpp::List::create(Named("post_mean") = post_mean,
-                            Named("mcmc") = mcmc,
-                            Named("elapsed") = elapsed);
+ 	tau2 = (t_b_tau+t_B2/t_sigma2_eps)/p;
+ 	if(n < p){
+ 		sigma2_eps = (t_E2+t_B2/t_tau2+2*b_sigma)/(n+p+2*a_sigma);
+ 	} else{
+ 		sigma2_eps = (t_E2+t_B2/t_tau2+2*b_sigma)/(2*p+2*a_sigma);
+ 	}
  }
 
-//'@title Fast Bayesian high-dimensional linear regression with horseshoe priors
+//'@title Fast Mean Field Varational Bayesian linear regression with normal priors
 //'@param y vector of n outcome variables
 //'@param X n x p matrix of candidate predictors
-//'@param mcmc_sample number of MCMC iterations saved
-//'@param burnin number of iterations before start to save
-//'@param thinning number of iterations to skip between two saved iterations
+//'@param max_iter max number of iterations
 //'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
 //'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
-//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
-//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
 //'@return a list object consisting of two components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
-//'\describe{
-//'\item{mu}{a vector of posterior predictive mean of the n training sample}
-//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
-//'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
-//'\item{sigma2_eps}{posterior mean of the noise variance}
-//'\item{b_lambda}{posterior mean of the rate parameter in the prior for local shrinkage parameters}
-//'\item{tau2}{posterior mean of the global parameter}
+//'\itemize{
+//'\item{mu: a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef: a vector of posterior mean of p regression coeficients}
+//'\item{sigma2_eps: posterior mean of the noise variance}
+//'\item{tau2: posterior mean of the ratio between prior regression coefficient variances and the noise variance}
 //'}
-//'\item{mcmc}{a list object of three components for MCMC samples}
-//'\describe{
-//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
-//'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
-//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
-//'\item{b_lambda}{a vector of MCMC samples of the rate parameter in the prior for local shrinkage parameters}
-//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'\item{trace}{a list object for parameter updates}
+//'\itemize{
+//'\item{t_E2: posterior mean of residual squared}
+//'\item{t_B2: posterior mean of L2 norm of the regression coeficients}
+//'\item{t_tau2: posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{t_sigma2_eps: posterior mean of the noise variance}
 //'}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
 //'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'res1 <- with(dat1,fast_horseshoe_ss_lm(y,X))
+//'res1 <- with(dat1,fast_mfvb_normal_lm(y,X))
 //'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
-//'res2 <- with(dat2,fast_horseshoe_ss_lm(y,X))
+//'res2 <- with(dat2,fast_mfvb_normal_lm(y,X))
 //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
 //'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
 //'time=c(res1$elapsed,res2$elapsed))
 //'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
-//'fast_horseshoe_tab <- tab
-//'print(fast_horseshoe_tab)
+//'fast_normal_tab <- tab
+//'print(fast_normal_tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List fast_horseshoe_hd_lm(arma::vec& y, arma::mat& X,
-                                 int mcmc_sample = 500,
-                                 int burnin = 500, int thinning = 1,
-                                 double a_sigma = 0.0, double b_sigma = 0.0,
-                                 double A_tau = 1, double A_lambda = 1){
+Rcpp::List fast_mfvb_normal_lm(arma::vec& y, arma::mat& X,
+                                int max_iter = 500,
+                                double a_sigma = 0.01, double b_sigma = 0.01,
+                                double A_tau = 1,double tol = 1e-5,
+                                double t_sigma2_eps_0 = 0, double t_tau2_0 = 0){
 
  	arma::wall_clock timer;
  	timer.tic();
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+
+ 	//std::cout << "U (" << U.n_rows << "," << U.n_cols << ")" << std::endl;
+ 	//std::cout << "d (" << d.n_elem  << ")" << std::endl;
+ 	//std::cout << "V (" << V.n_rows << "," << V.n_cols << ")" << std::endl;
 
  	int p = X.n_cols;
  	int n = X.n_rows;
- 	double sigma2_eps = 1;
- 	if(a_sigma!=0.0){
- 		sigma2_eps = b_sigma/a_sigma;
- 	}
- 	double A2 = A_tau*A_tau;
- 	double A2_lambda = A_lambda*A_lambda;
- 	double b_tau = 1;
-
- 	double tau2 = 1.0/p;
-
- 	arma::vec betacoef;
- 	arma::vec lambda;
- 	arma::vec b_lambda;
- 	lambda.ones(p);
- 	b_lambda.ones(p);
- 	arma::vec mu;
-
- 	arma::mat betacoef_list;
- 	arma::mat lambda_list;
- 	arma::vec sigma2_eps_list;
- 	arma::vec tau2_list;
-
- 	betacoef_list.zeros(p,mcmc_sample);
- 	lambda_list.zeros(p,mcmc_sample);
- 	sigma2_eps_list.zeros(mcmc_sample);
- 	tau2_list.zeros(mcmc_sample);
-
-
- 	if(p<n){
- 		arma::vec d;
- 		arma::mat U;
- 		arma::mat V;
- 		arma::svd_econ(U,d,V,X);
-
- 		arma::vec d2 = d%d;
- 		arma::vec dys = d%(U.t()*y);
-
- 		for(int iter=0;iter<burnin;iter++){
- 			hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                             b_tau, mu, dys,  V,   d2, y, X,
-                             A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
-                              b_tau, mu, dys,  V,  d2, y, X,
-                              A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			sigma2_eps_list(iter) = sigma2_eps;
- 			tau2_list(iter) = tau2;
- 		}
- 	} else{
-
- 		for(int iter=0;iter<burnin;iter++){
- 			hs_one_step_update(betacoef, lambda, sigma2_eps, tau2,
-                       b_tau, b_lambda, mu,  y,  X,
-                       A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 		}
- 		for(int iter=0;iter<mcmc_sample;iter++){
- 			for(int j=0;j<thinning;j++){
- 				hs_one_step_update(betacoef, lambda, sigma2_eps, tau2,
-                        b_tau,b_lambda, mu,  y,  X,
-                        A2, A2_lambda, a_sigma,  b_sigma, p,  n);
- 			}
- 			betacoef_list.col(iter) = betacoef;
- 			lambda_list.col(iter) = lambda;
- 			sigma2_eps_list(iter) = sigma2_eps;
- 			tau2_list(iter) = tau2;
- 		}
+ 	arma::vec ys = U.t()*y;
 
- 	}
+ 	arma::vec t_sigma2_eps_list;
+ 	arma::vec t_tau2_list;
+ 	arma::vec t_E2_list;
+ 	arma::vec t_B2_list;
+ 	arma::vec betacoef;
+ 	double sigma2_eps;
+ 	double tau2;
 
- 	betacoef = arma::mean(betacoef_list,1);
- 	lambda = arma::mean(lambda_list,1);
- 	sigma2_eps = arma::mean(sigma2_eps_list);
- 	tau2 = arma::mean(tau2_list);
+ 	mfvb_normal_lm_svd(betacoef, sigma2_eps, tau2,
+                     t_E2_list, t_B2_list, t_tau2_list, t_sigma2_eps_list,
+                     d, V, ys, p, n, max_iter, a_sigma, b_sigma, A_tau, tol,
+                     t_sigma2_eps_0, t_tau2_0);
 
  	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
                                             Named("betacoef") = betacoef,
-                                            Named("lambda") = lambda,
                                             Named("sigma2_eps") = sigma2_eps,
                                             Named("tau2") = tau2);
- 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-                                       Named("lambda") = lambda_list,
-                                       Named("sigma2_eps") = sigma2_eps_list,
-                                       Named("tau2") = tau2_list);
+ 	Rcpp::List trace = Rcpp::List::create(Named("t_E2") = t_E2_list,
+                                        Named("t_B2") = t_B2_list,
+                                        Named("t_tau2") = t_tau2_list,
+                                        Named("t_sigma2_eps") = t_sigma2_eps_list);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
-                            Named("mcmc") = mcmc,
+                            Named("trace") = trace,
                             Named("elapsed") = elapsed);
  }
 
+//Define the function for high dimensional case
+class H_fun: public Optim{
+public:
+	H_fun(const arma::mat& in_d_sq,
+       const arma::mat& in_z_sq) : d_sq(in_d_sq), z_sq(in_z_sq){
+	}
 
-//'@title Prediction with fast Bayesian linear regression fitting
-//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
-//'@return a list object consisting of three components
-//'\describe{
-//'\item{mean}{a vector of \eqn{n} posterior predictive mean values}
-//'\item{ucl}{a vector of \eqn{n}  posterior \eqn{\alpha} level upper credible limits}
-//'\item{lcl}{a vector of \eqn{n}  posterior \eqn{\alpha} level lower credible limits}
-//'\item{median}{a vector of \eqn{n}  posterior predictive median values}
-//'\item{sd}{a vector of \eqn{n}  posterior predictive standard deviation values}
-//'}
-//'@author Jian Kang <jiankang@umich.edu>
-//'@examples
-//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'train_idx = 1:round(length(dat$y)/2)
-//'test_idx = setdiff(1:length(dat$y),train_idx)
-//'res <- fast_horseshoe_lm(dat$y[train_idx],dat$X[train_idx,])
-//'pred_res <- predict_fast_lm(res,dat$X[test_idx,])
-//'plot(dat$y[test_idx,],pred_res$mean,
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
-//'ylab = "Predictions")
-//'abline(0,1)
-//'@export
-//[[Rcpp::export]]
- Rcpp::List predict_fast_lm(Rcpp::List& model_fit, arma::mat& X_test, double alpha = 0.95){
 
- 	Rcpp::List mcmc = model_fit["mcmc"];
- 	arma::mat betacoef = mcmc["betacoef"];
- 	arma::mat pred_mu = X_test*betacoef;
- 	double alpha_1 = (1-alpha)*0.5;
- 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
- 	arma::vec pred_mean = arma::mean(pred_mu,1);
- 	arma::mat pred_cls = arma::quantile(pred_mu,pvec,1);
- 	arma::vec pred_median = arma::median(pred_mu,1);
- 	arma::vec pred_sd = arma::stddev(pred_mu,0,1);
+	double value(double theta){
+		arma::mat d_sq_theta = (d_sq + theta);
+		arma::mat term1 = z_sq/d_sq_theta;
+		arma::mat term2 = arma::log(d_sq_theta);
+		double value = std::log(arma::accu(term1));
+		value *= -0.5*d_sq.n_elem;
+		value -= 0.5*arma::accu(term2);
+		return value;
+	}
 
+private:
+	const arma::mat& d_sq;
+	const arma::mat& z_sq;
+	/*void Gradient(const arma::mat& theta, arma::mat& grad){
+		grad.set_size(1, 1);
+		grad[0] = 0.0;
+		arma::mat inv_d_sq_theta = 1.0/(d_sq + theta[0]);
+		grad[0] = arma::accu(z_sq%inv_d_sq_theta%inv_d_sq_theta);
+		grad[0] /= arma::accu(z_sq%inv_d_sq_theta);
+		grad[0] *= -0.5*d_sq.n_elem;
+		grad[0] += 0.5*arma::accu(inv_d_sq_theta);
+	}*/
+};
 
- 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mean,
-                                       Named("ucl") = pred_cls.col(0),
-                                       Named("lcl") = pred_cls.col(1),
-                                       Named("median") = pred_median,
-                                       Named("sd") = pred_sd);
+//Define the function for large sample size
+class L_fun: public Optim{
+public:
+	L_fun(const arma::mat& in_d_sq,
+       const arma::mat& in_z_sq,
+       const double& in_sum_y_sq,
+       const int& in_n) : d_sq(in_d_sq),
+       z_sq(in_z_sq), sum_y_sq(in_sum_y_sq), n(in_n){
+	}
 
- 	return pred;
- }
 
-//'@title Prediction with fast Bayesian linear regression fitting with multiple outcomes
-//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
-//'@return a list object consisting of three components
-//'\describe{
-//'\item{mean}{a matrix of \eqn{n} by \eqn{q} posterior predictive mean values}
-//'\item{ucl}{a matrix of \eqn{n} by \eqn{q}  posterior \eqn{\alpha} level upper credible limits}
-//'\item{lcl}{a vector of \eqn{n} by \eqn{q}  posterior \eqn{\alpha} level lower credible limits}
-//'\item{median}{a vector of \eqn{n} by \eqn{q}  posterior predictive median values}
-//'\item{sd}{a vector of \eqn{n} by \eqn{q}  posterior predictive standard deviation values}
-//'}
-//'@author Jian Kang <jiankang@umich.edu>
-//'@examples
-//'dat <- sim_linear_reg_multi(n=2000,p=200,m=5,X_cor=0.9,q=6)
-//'train_idx = 1:round(nrow(dat$y)/2)
-//'test_idx = setdiff(1:nrow(dat$y),train_idx)
-//'res <- fast_normal_multi_lm(dat$y[train_idx,],dat$X[train_idx,])
-//'pred_res <- predict_fast_multi_lm(res,dat$X[test_idx,])
-//'plot(dat$y[test_idx,1],pred_res$mean[,1],
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
-//'ylab = "Predictions")
-//'abline(0,1)
+	double value(double theta){
+		arma::mat d_sq_theta = (d_sq + theta);
+		arma::mat term1 = d_sq%z_sq/d_sq_theta;
+		arma::mat term2 = arma::log(d_sq_theta);
+		double value = std::log(sum_y_sq - arma::accu(term1));
+		value *= -0.5*n;
+		value -= 0.5*arma::accu(term2);
+		return value;
+	}
+
+private:
+	const arma::mat& d_sq;
+	const arma::mat& z_sq;
+	const double& sum_y_sq;
+	const int& n;
+	/*void Gradient(const arma::mat& theta, arma::mat& grad){
+	 grad.set_size(1, 1);
+	 grad[0] = 0.0;
+	 arma::mat inv_d_sq_theta = 1.0/(d_sq + theta[0]);
+	 grad[0] = arma::accu(z_sq%inv_d_sq_theta%inv_d_sq_theta);
+	 grad[0] /= arma::accu(z_sq%inv_d_sq_theta);
+	 grad[0] *= -0.5*d_sq.n_elem;
+	 grad[0] += 0.5*arma::accu(inv_d_sq_theta);
+	}*/
+};
+
 //'@export
 //[[Rcpp::export]]
-Rcpp::List predict_fast_multi_lm(Rcpp::List& model_fit, arma::mat& X_test){
+double Rcpp_optimize_H(arma::mat& d_sq, arma::mat& z_sq){
+	H_fun h(d_sq, z_sq);
+	double theta_max = optimize(&h, 0, 10000, true, 1e-3);
+	return theta_max;
+}
 
-	Rcpp::List post_mean = model_fit["post_mean"];
- 	arma::mat betacoef = post_mean["betacoef"];
- 	arma::mat pred_mu = arma::zeros<arma::mat>(X_test.n_rows,betacoef.n_cols);
- 	for(int i=0;i<betacoef.n_cols;i++){
- 		pred_mu.col(i) = X_test*betacoef.col(i);
- 	}
+//'@export
+//[[Rcpp::export]]
+double Rcpp_optimize_L(arma::mat& d_sq,
+                       arma::mat& z_sq,
+                       double & sum_y_sq,
+                       int & n){
+	 L_fun l(d_sq, z_sq, sum_y_sq, n);
+	 double theta_max = optimize(&l, 0, 10000, true, 1e-3);
+	 return theta_max;
+}
 
+// tuning free posterior mean of the normal linear model given the SVD of X;
+// theta < 0 means it is estimated by maximizing the marginal likelihood
+double super_fast_normal_lm_svd(arma::vec& betacoef, double& sigma2_eps,
+                                const arma::mat& U, const arma::vec& d, const arma::mat& V,
+                                const arma::vec& y, double theta){
+ 	if(U.n_rows>0){
 
- 	//arma::mat pred_mean = arma::mean(pred_mu,2);
- 	//arma::mat pred_sd = arma::stddev(pred_mu,0,2);
+ 		int n = U.n_rows;
+ 		int p = V.n_rows;
+ 		arma::vec d_sq = d%d;
+ 		arma::vec z = U.t()*y;
+ 		arma::vec z_sq = z%z;
 
+ 		H_fun h(d_sq, z_sq);
 
- 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mu);
+ 		double sum_y_sq = arma::accu(y%y);
 
- 	return pred;
-}
+ 		L_fun l(d_sq, z_sq, sum_y_sq, n);
 
+ 		if(theta<0){
+ 			if(p >= n){
+ 				theta = optimize(&h, 0, 10000, true, 1e-3);
+ 			} else{
+ 				theta = optimize(&l, 0, 10000, true, 1e-3);
+ 			}
+ 		}
+ 		arma::vec theta_d_sq = theta + d_sq;
 
-//'@title Prediction with fast mean field variational Bayesian linear regression fitting
-//'@param model_fit  output list object of fast Bayesian linear regression fitting (see value of \link{fast_horseshoe_lm} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
-//'@return a list object consisting
+ 		betacoef = V*((d/theta_d_sq)%z);
+ 		sigma2_eps = theta*arma::mean(z_sq/theta_d_sq);
+ 	}
+ 	return theta;
+}
+
+//'@title Super Fast Bayesian linear regression with normal priors (Tuning Free)
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param theta shrinkage parameter
+//'@return a list object consisting of posterior mean estiamte
 //'\describe{
-//'\item{mean}{a vector of \eqn{n} posterior predictive mean values}
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{sigma2_eps}{posterior mean of the noise variance}
+//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'train_idx = 1:round(length(dat$y)/2)
-//'test_idx = setdiff(1:length(dat$y),train_idx)
-//'res <- fast_mfvb_normal_lm(dat$y[train_idx],dat$X[train_idx,])
-//'pred_res <- predict_fast_mfvb_lm(res,dat$X[test_idx,])
-//'plot(dat$y[test_idx,],pred_res$mean,
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="Observations",
-//'ylab = "Predictions")
-//'abline(0,1)
+//'set.seed(2022)
+//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res1 <- with(dat1,fast_normal_lm(y,X))
+//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
+//'res2 <- with(dat2,fast_normal_lm(y,X))
+//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
+//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
+//'time=c(res1$elapsed,res2$elapsed))
+//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
+//'fast_normal_tab <- tab
+//'print(fast_normal_tab)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List predict_fast_mfvb_lm(Rcpp::List& model_fit, arma::mat& X_test){
+Rcpp::List super_fast_normal_lm(arma::vec& y, arma::mat& X,
+                                double theta = -1.0){
 
- 	Rcpp::List post_mean = model_fit["post_mean"];
- 	arma::vec betacoef = post_mean["betacoef"];
- 	arma::vec pred_mean = X_test*betacoef;
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+
+ 	arma::vec betacoef;
+ 	double sigma2_eps = 1.0;
+
+ 	theta = super_fast_normal_lm_svd(betacoef, sigma2_eps, U, d, V, y, theta);
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
+                                            Named("betacoef") = betacoef,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("theta") = theta);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("elapsed") = elapsed);
+}
+
+// SVD pieces (d, V, ys = U'y) of one block of a batched fit. When p < n the
+// p x p Gram matrix is decomposed instead of the n x p block, which is much
+// cheaper for the small p typical of batched fits
+bool batch_svd(arma::vec& d, arma::mat& V, arma::vec& ys,
+               const arma::mat& X, const arma::vec& y){
+	if(X.n_cols < X.n_rows){
+		arma::vec d2;
+		arma::mat XtX = X.t()*X;
+		if(!arma::eig_sym(d2, V, XtX))
+			return false;
+		d2.elem(arma::find(d2<0)).zeros();
+		d = arma::sqrt(d2);
+		ys = V.t()*(X.t()*y);
+		double tol = d.max()*X.n_rows*arma::datum::eps;
+		arma::uvec idx1 = arma::find(d > tol);
+		arma::uvec idx0 = arma::find(d <= tol);
+		ys.elem(idx1) /= d.elem(idx1);
+		ys.elem(idx0).zeros();
+		d.elem(idx0).zeros();
+		return true;
+	} else{
+		arma::mat U;
+		if(!arma::svd_econ(U,d,V,X))
+			return false;
+		ys = U.t()*y;
+		return true;
+	}
+}
 
- 	Rcpp::List pred = Rcpp::List::create(Named("mean") = pred_mean);
- 	return pred;
- }
+// row indices of each group, built in one counting pass over the labels;
+// group labels take all the values 1,...,G and are checked as integers, so
+// a negative label cannot wrap around to a huge unsigned one
+std::vector<arma::uvec> batch_group_index(arma::ivec& group, int n){
+	if((int)group.n_elem != n)
+		Rcpp::stop("group must have the same length as y");
+	if(group.n_elem==0 || group.min()<1)
+		Rcpp::stop("group labels must be positive integers");
+	int G = group.max();
+	if(G>n)
+		Rcpp::stop("group labels must take all the values 1,...,G");
+	arma::uvec count = arma::zeros<arma::uvec>(G);
+	for(int i=0;i<n;i++)
+		count(group(i)-1)++;
+	if(arma::any(count==0))
+		Rcpp::stop("group labels must take all the values 1,...,G");
+	std::vector<arma::uvec> group_idx(G);
+	for(int g=0;g<G;g++)
+		group_idx[g].set_size(count(g));
+	count.zeros();
+	for(int i=0;i<n;i++){
+		int g = group(i)-1;
+		group_idx[g](count(g)++) = i;
+	}
+	return group_idx;
+}
 
-//'@title Prediction with fast Bayesian logistic regression fitting
-//'@param model_fit  output list object of fast Bayesian logistic regression fitting (see value of \link{fast_horseshoe_lm} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
-//'@param cutoff threshold value for posterior predicitve probablity. The default value is 0.5
-//'@return a list object consisting of three components
+//'@title Super Fast Bayesian linear regressions for many groups in one call (Tuning Free)
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param group vector of n group labels taking all the values 1,...,G; a
+//'separate regression is fitted to the observations of each group
+//'@param theta shrinkage parameter; a negative value means it is estimated separately for each group
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@param numa_interleave logical value; if true X is first copied by the OpenMP
+//'threads, so that with OMP_PROC_BIND=spread its pages are spread over their
+//'NUMA nodes. Default value is false
+//'@return a list object consisting of posterior mean estiamte
 //'\describe{
-//'\item{class}{a vector of \eqn{n} predicted class indicators}
-//'\item{mean}{a vector of \eqn{n} posterior predictive mean probabilities}
-//'\item{ucl}{a vector of \eqn{n}  posterior \eqn{\alpha} level upper credible limits of probabilities}
-//'\item{lcl}{a vector of \eqn{n}  posterior \eqn{\alpha} level lower credible limits of probabilities}
-//'\item{median}{a vector of \eqn{n}  posterior predictive median probabilities}
-//'\item{sd}{a vector of \eqn{n}  standard deviations of posterior predictive probabilities}
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x G matrix of posterior mean of regression coeficients for each group}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance for each group}
+//'\item{theta}{a vector of shrinkage parameters for each group}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'train_idx = 1:round(length(dat$y)/2)
-//'test_idx = setdiff(1:length(dat$y),train_idx)
-//'res <- fast_normal_logit(dat$y[train_idx],dat$X[train_idx,])
-//'pred_res <- predict_fast_logit(res,dat$X[test_idx,])
-//'plot(dat$prob[test_idx,],pred_res$mean,
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
-//'ylab = "Predicted Probabilities")
-//'abline(0,1)
-//'print(comp_class_acc(pred_res$class,dat$y[test_idx]))
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=20000,p=20,X_cor=0.5,q=6)
+//'group <- rep(1:1000,each=20)
+//'res <- with(dat,super_fast_normal_lm_batch(y,X,group))
+//'res1 <- with(dat,super_fast_normal_lm(y[group==1],X[group==1,]))
+//'print(cbind(res$post_mean$betacoef[,1],res1$post_mean$betacoef))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List predict_fast_logit(Rcpp::List& model_fit, arma::mat& X_test,
-                               double alpha = 0.95, double cutoff = 0.5){
+Rcpp::List super_fast_normal_lm_batch(arma::vec& y, arma::mat& X,
+                                      arma::ivec& group,
+                                      double theta = -1.0,
+                                      int n_threads = 0,
+                                      bool numa_interleave = false){
 
- 	Rcpp::List mcmc = model_fit["mcmc"];
- 	arma::mat betacoef = mcmc["betacoef"];
- 	arma::mat pred_mu = X_test*betacoef;
- 	arma::mat pred_prob = 1.0/(1.0 + exp(-pred_mu));
- 	double alpha_1 = (1-alpha)*0.5;
- 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
- 	arma::vec pred_mean = arma::mean(pred_prob,1);
- 	arma::mat pred_cls = arma::quantile(pred_prob,pvec,1);
- 	arma::vec pred_median = arma::median(pred_prob,1);
- 	arma::vec pred_sd = arma::stddev(pred_prob,0,1);
- 	arma::uvec pred_class;
- 	pred_class.zeros(pred_mean.n_elem);
- 	pred_class.elem(arma::find(pred_mean>cutoff)).ones();
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	std::vector<arma::uvec> group_idx = batch_group_index(group, X.n_rows);
+ 	arma::mat X_local;
+ 	if(numa_interleave)
+ 		first_touch_copy(X_local, X, n_threads);
+ 	const arma::mat& X_w = numa_interleave ? X_local : X;
+ 	int G = group_idx.size();
+ 	int p = X.n_cols;
 
+ 	arma::mat betacoef;
+ 	arma::vec sigma2_eps;
+ 	arma::vec theta_vec;
+ 	arma::vec mu;
+ 	betacoef.zeros(p,G);
+ 	sigma2_eps.ones(G);
+ 	theta_vec.zeros(G);
+ 	mu.zeros(X.n_rows);
+
+ 	#pragma omp parallel for schedule(dynamic) num_threads(get_num_threads(n_threads))
+ 	for(int g=0;g<G;g++){
+ 		const arma::uvec& idx = group_idx[g];
+ 		arma::mat X_g = X_w.rows(idx);
+ 		arma::vec y_g = y.elem(idx);
+ 		arma::vec d;
+ 		arma::mat V;
+ 		arma::vec z;
+ 		if(!batch_svd(d,V,z,X_g,y_g)){
+ 			betacoef.col(g).fill(arma::datum::nan);
+ 			sigma2_eps(g) = arma::datum::nan;
+ 			theta_vec(g) = arma::datum::nan;
+ 			continue;
+ 		}
+ 		arma::vec d_sq = d%d;
+ 		arma::vec z_sq = z%z;
+ 		double theta_g = theta;
+ 		if(theta_g<0){
+ 			if(p >= (int)idx.n_elem){
+ 				H_fun h(d_sq, z_sq);
+ 				theta_g = optimize(&h, 0, 10000, true, 1e-3);
+ 			} else{
+ 				double sum_y_sq = arma::accu(y_g%y_g);
+ 				int n_g = idx.n_elem;
+ 				L_fun l(d_sq, z_sq, sum_y_sq, n_g);
+ 				theta_g = optimize(&l, 0, 10000, true, 1e-3);
+ 			}
+ 		}
+ 		arma::vec theta_d_sq = theta_g + d_sq;
+ 		betacoef.col(g) = V*((d/theta_d_sq)%z);
+ 		sigma2_eps(g) = theta_g*arma::mean(z_sq/theta_d_sq);
+ 		theta_vec(g) = theta_g;
+ 		mu.elem(idx) = X_g*betacoef.col(g);
+ 	}
 
- 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
-                                       Named("mean") = pred_mean,
-                                       Named("ucl") = pred_cls.col(0),
-                                       Named("lcl") = pred_cls.col(1),
-                                       Named("median") = pred_median,
-                                       Named("sd") = pred_sd);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = mu,
+                                            Named("betacoef") = betacoef,
+                                            Named("sigma2_eps") = sigma2_eps,
+                                            Named("theta") = theta_vec);
 
- 	return pred;
- }
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("elapsed") = elapsed);
+}
 
-//'@title Prediction with fast Bayesian multinomial logistic regression fitting
-//'@param model_fit  output list object of fast Bayesian multinomial logistic regression fitting (see value of \link{fast_horseshoe_lm} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@return a list object consisting of three components
+//'@title Fast Bayesian linear regressions with normal priors for many groups in one call
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param group vector of n group labels taking all the values 1,...,G; a
+//'separate regression is fitted to the observations of each group
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param display_progress logical value; Default value is false
+//'@return a list object consisting of two components
 //'\describe{
-//'\item{class}{a vector of \eqn{n} predicted class indicators}
-//'\item{mean}{a matrix of \eqn{n} by \eqn{K} posterior predictive mean probabilities}
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{a vector of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x G matrix of posterior mean of regression coeficients for each group}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance for each group}
+//'\item{tau2}{a vector of posterior mean of the ratio between prior regression coefficient variances and the noise variance for each group}
+//'}
+//'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'dat<-sim_multiclass_reg(K=5,n=1000,p=20,X_var = 10,X_cor=0.5,q=10,
-//'beta_size=1,intercept0=c(5,-5,-10,-10))
-//'train_idx = 1:round(length(dat$y)/2)
-//'test_idx = setdiff(1:length(dat$y),train_idx)
-//'res <- fast_normal_multiclass(dat$y[train_idx],dat$X[train_idx,])
-//'pred_res <- predict_fast_multiclass(res,dat$X[test_idx,])
-//'mean(pred_res$class!=dat$y[test_idx])
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=20000,p=20,X_cor=0.5,q=6)
+//'group <- rep(1:1000,each=20)
+//'res <- with(dat,fast_normal_lm_batch(y,X,group))
+//'res1 <- with(dat,fast_normal_lm(y[group==1],X[group==1,]))
+//'print(cbind(res$post_mean$betacoef[,1],res1$post_mean$betacoef))
 //'@export
 //[[Rcpp::export]]
- Rcpp::List predict_fast_multiclass(Rcpp::List& model_fit,
-                                    arma::mat& X_test){
+Rcpp::List fast_normal_lm_batch(arma::vec& y, arma::mat& X,
+                                arma::ivec& group,
+                                int mcmc_sample = 500,
+                                int burnin = 500, int thinning = 1,
+                                double a_sigma = 0.01, double b_sigma = 0.01,
+                                double A_tau = 10,
+                                bool display_progress = false){
 
- 	Rcpp::List mcmc = model_fit["mcmc"];
- 	arma::cube betacoef = mcmc["betacoef"];
- 	int nclass = betacoef.n_slices+1;
- 	int mcmc_sample = betacoef.n_cols;
- 	int npred = X_test.n_rows;
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	std::vector<arma::uvec> group_idx = batch_group_index(group, X.n_rows);
+ 	int G = group_idx.size();
+ 	int p = X.n_cols;
 
+ 	arma::mat betacoef_mean;
+ 	arma::vec sigma2_eps_mean;
+ 	arma::vec tau2_mean;
+ 	arma::vec mu_mean;
+ 	betacoef_mean.zeros(p,G);
+ 	sigma2_eps_mean.zeros(G);
+ 	tau2_mean.zeros(G);
+ 	mu_mean.zeros(X.n_rows);
 
- 	arma::cube log_1_prob(npred,mcmc_sample,nclass-1);
- 	arma::cube prob(npred,mcmc_sample,nclass-1);
- 	arma::mat log_prob(npred,mcmc_sample);
+ 	double A2 = A_tau*A_tau;
 
- 	for(int k=nclass-1;k>=1;k--){
- 		log_prob = X_test*betacoef.slice(k-1);
- 		log_1_prob.slice(k-1) = -log1pexp_mat(log_prob);
- 		log_prob += log_1_prob.slice(k-1);
- 		prob.slice(k-1) = log_prob;
- 		if(k<nclass - 1){
- 			for(int j=k;j<nclass-1;j++){
- 				prob.slice(k-1) += log_1_prob.slice(j);
+ 	Progress pb(G, display_progress);
+ 	for(int g=0;g<G;g++){
+ 		pb.increment();
+ 		const arma::uvec& idx = group_idx[g];
+ 		arma::mat X_g = X.rows(idx);
+ 		arma::vec y_g = y.elem(idx);
+ 		int n_g = idx.n_elem;
+ 		arma::vec d;
+ 		arma::mat V;
+ 		arma::vec ys;
+ 		if(!batch_svd(d,V,ys,X_g,y_g))
+ 			Rcpp::stop("decomposition of the design matrix failed for group %d", g+1);
+ 		arma::vec d2 = d%d;
+
+ 		arma::vec betacoef;
+ 		arma::vec mu;
+ 		arma::vec beta_s_mean;
+ 		arma::vec beta_s_sum = arma::zeros<arma::vec>(d.n_elem);
+ 		double sigma2_eps = b_sigma/a_sigma;
+ 		double b_tau = A2;
+ 		double tau2 = b_tau;
+
+ 		for(int iter=0;iter<burnin+mcmc_sample;iter++){
+ 			int n_step = iter<burnin ? 1 : thinning;
+ 			for(int j=0;j<n_step;j++){
+ 				if(p<n_g){
+ 					one_step_update_big_n(betacoef, beta_s_mean, sigma2_eps, tau2,
+                            b_tau, mu, ys,  V,  d, d2, y_g,  X_g,
+                            A2,  a_sigma,  b_sigma, p,  n_g);
+ 				} else{
+ 					one_step_update_big_p(betacoef, beta_s_mean, sigma2_eps, tau2,
+                            b_tau, mu, ys,  V,  d, d2, y_g,  X_g,
+                            A2,  a_sigma,  b_sigma, p,  n_g);
+ 				}
+ 			}
+ 			if(iter>=burnin){
+ 				beta_s_sum += beta_s_mean;
+ 				sigma2_eps_mean(g) += sigma2_eps;
+ 				tau2_mean(g) += tau2;
  			}
  		}
+ 		betacoef_mean.col(g) = V*(beta_s_sum/mcmc_sample);
+ 		sigma2_eps_mean(g) /= mcmc_sample;
+ 		tau2_mean(g) /= mcmc_sample;
+ 		mu_mean.elem(idx) = X_g*betacoef_mean.col(g);
  	}
 
- 	prob = exp(prob);
- 	arma::mat mean_prob = arma::mean(prob,1);
- 	arma::vec prob0 = 1.0 - arma::sum(mean_prob,1);
- 	mean_prob = arma::join_rows(prob0,mean_prob);
-
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = mu_mean,
+                                            Named("betacoef") = betacoef_mean,
+                                            Named("sigma2_eps") = sigma2_eps_mean,
+                                            Named("tau2") = tau2_mean);
 
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("elapsed") = elapsed);
+}
 
 
- 	arma::uvec pred_class = index_max(mean_prob,1);
+// Regularization paths: every fit along a grid of hyperparameters shares one
+// decomposition of the design, and each fit starts from the state reached by
+// the previous one, so neighbouring grid points converge in a few iterations.
+// Grids of length one are recycled to the length of the longest grid.
+int path_length(const arma::vec& grid1, const arma::vec& grid2, const arma::vec& grid3){
+	int K = std::max(grid1.n_elem, std::max(grid2.n_elem, grid3.n_elem));
+	if(grid1.n_elem==0 || grid2.n_elem==0 || grid3.n_elem==0)
+		Rcpp::stop("hyperparameter grids must not be empty");
+	if((grid1.n_elem!=1 && (int)grid1.n_elem!=K) ||
+    (grid2.n_elem!=1 && (int)grid2.n_elem!=K) ||
+    (grid3.n_elem!=1 && (int)grid3.n_elem!=K))
+		Rcpp::stop("hyperparameter grids must have length one or a common length");
+	return K;
+}
 
+double path_value(const arma::vec& grid, int k){
+	return grid.n_elem==1 ? grid(0) : grid(k);
+}
 
+//'@title Super Fast Bayesian linear regression with normal priors along a path of shrinkage parameters
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param theta vector of K shrinkage parameters
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{an n x K matrix of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance}
+//'\item{theta}{the shrinkage parameters}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res <- with(dat,super_fast_normal_lm_path(y,X,theta=10^seq(-2,3,length=20)))
+//'matplot(log10(res$post_mean$theta),t(res$post_mean$betacoef),type="l")
+//'@export
+//[[Rcpp::export]]
+Rcpp::List super_fast_normal_lm_path(arma::vec& y, arma::mat& X,
+                                     arma::vec& theta){
 
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	if(theta.n_elem==0)
+ 		Rcpp::stop("theta must not be empty");
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
 
- 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
-                                       Named("mean") = mean_prob);
+ 	int K = theta.n_elem;
+ 	arma::mat betacoef_path;
+ 	arma::vec sigma2_eps_path;
+ 	betacoef_path.zeros(X.n_cols,K);
+ 	sigma2_eps_path.zeros(K);
+
+ 	for(int k=0;k<K;k++){
+ 		arma::vec betacoef;
+ 		double sigma2_eps = 1.0;
+ 		super_fast_normal_lm_svd(betacoef, sigma2_eps, U, d, V, y, theta(k));
+ 		betacoef_path.col(k) = betacoef;
+ 		sigma2_eps_path(k) = sigma2_eps;
+ 	}
 
- 	return pred;
- }
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef_path,
+                                            Named("betacoef") = betacoef_path,
+                                            Named("sigma2_eps") = sigma2_eps_path,
+                                            Named("theta") = theta);
 
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("elapsed") = elapsed);
+}
 
-//'@title Prediction with fast mean field variational Bayesian logistic regression fitting
-//'@param model_fit output list object of fast mean field variational Bayesian logistic regression fitting (see value of \link{fast_mfvb_normal_logit} as an example)
-//'@param X_test \eqn{n} by \eqn{p} matrix of predictors for the test data
-//'@param alpha posterior predictive credible level \eqn{\alpha \in (0,1)}. The default value is \eqn{0.95}.
-//'@param cutoff threshold value for posterior predicitve probablity. The default value is 0.5
+//'@title Fast mean field variational Bayesian linear regression with normal priors along a path of hyperparameters
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param A_tau vector of K scale parameters in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param a_sigma shape parameters in the inverse gamma prior of the noise variance; either one value or K values
+//'@param b_sigma rate parameters in the inverse gamma prior of the noise variance; either one value or K values
+//'@param max_iter maximum number of iterations of each fit
+//'@param tol threshold of the relative changes of the noise variance and the ratio
 //'@return a list object consisting of three components
 //'\describe{
-//'\item{class}{a vector of \eqn{n} predicted class indicators}
-//'\item{prob}{a vector of \eqn{n} posterior predictive mean probabilities}
+//'\item{post_mean}{a list object of four components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{an n x K matrix of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance}
+//'\item{tau2}{a vector of posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'}
+//'\item{iter}{number of iterations used by each fit}
+//'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
-//'dat <- sim_logit_reg(n=2000,p=200,X_cor=0.9,q=6,beta_size=5)
-//'train_idx = 1:round(length(dat$y)/2)
-//'test_idx = setdiff(1:length(dat$y),train_idx)
-//'res_mcmc <- fast_normal_logit(dat$y[train_idx],dat$X[train_idx,])
-//'res <- fast_mfvb_normal_logit(dat$y[train_idx],dat$X[train_idx,])
-//'pred_res <- predict_fast_mfvb_logit(res,dat$X[test_idx,])
-//'pred_res_mcmc <- predict_fast_logit(res_mcmc,dat$X[test_idx,])
-//'par(mfrow=c(1,2))
-//'plot(dat$prob[test_idx,],pred_res$prob,
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
-//'ylab = "Predicted Probabilities",main="MFVB")
-//'abline(0,1)
-//'plot(dat$prob[test_idx,],pred_res_mcmc$mean,
-//'type="p",pch=19,cex=0.5,col="blue",asp=1,xlab="True Probabilities",
-//'ylab = "Predicted Probabilities",main="MCMC")
-//'abline(0,1)
-//'mfvb <- comp_class_acc(pred_res$class,dat$y[test_idx])
-//'mcmc <- comp_class_acc(pred_res_mcmc$class,dat$y[test_idx])
-//'tab <- rbind(mfvb,mcmc)
-//'print(tab)
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res <- with(dat,fast_mfvb_normal_lm_path(y,X,A_tau=10^seq(-2,2,length=20)))
+//'print(res$iter)
 //'@export
 //[[Rcpp::export]]
- Rcpp::List predict_fast_mfvb_logit(Rcpp::List& model_fit, arma::mat& X_test,
-                                    double alpha = 0.95, double cutoff = 0.5){
-
- 	Rcpp::List post_mean = model_fit["post_mean"];
- 	arma::vec betacoef = post_mean["betacoef"];
- 	arma::vec pred_mu = X_test*betacoef;
- 	arma::vec pred_prob = 1.0/(1.0 + exp(-pred_mu));
- 	double alpha_1 = (1-alpha)*0.5;
- 	arma::vec pvec = {1.0 - alpha_1,alpha_1};
- 	arma::uvec pred_class;
- 	pred_class.zeros(pred_prob.n_elem);
- 	pred_class.elem(arma::find(pred_prob>cutoff)).ones();
-
-
- 	Rcpp::List pred = Rcpp::List::create(Named("class") = pred_class,
-                                       Named("prob") = pred_prob);
-
- 	return pred;
- }
-
-
-
- void scalar_img_one_step_update(arma::vec& theta, arma::uvec& delta, arma::vec& lambda,
-                                 double& sigma2_eps, double& tau2,
-                                 double& b_tau, arma::vec& b_lambda,  arma::vec& betacoef,
-                                 arma::vec& y, arma::mat& X, arma::mat& Z, arma::mat& Phi, arma::vec& eps,
-                                 double& A2, double& A2_lambda,
-                                 double a_sigma, double b_sigma,
-                                 int p, int n, int L){
+Rcpp::List fast_mfvb_normal_lm_path(arma::vec& y, arma::mat& X,
+                                    arma::vec& A_tau,
+                                    Rcpp::NumericVector a_sigma = Rcpp::NumericVector::create(0.01),
+                                    Rcpp::NumericVector b_sigma = Rcpp::NumericVector::create(0.01),
+                                    int max_iter = 500, double tol = 1e-5){
 
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec a_sigma_grid = Rcpp::as<arma::vec>(a_sigma);
+ 	arma::vec b_sigma_grid = Rcpp::as<arma::vec>(b_sigma);
+ 	int K = path_length(A_tau, a_sigma_grid, b_sigma_grid);
 
- 	//update delta
- 	for(int j=0;j<p;j++){
- 		//update mu_j
- 		arma::vec xphi_j = X.col(j)*betacoef(j);
- 		arma::vec eps_j = eps;
- 		if(delta(j)==1L){
- 			eps_j -= xphi_j;
- 		}
- 		arma::vec eps_j_1 = eps_j - xphi_j;
- 		double log_prob_1 = -0.5*arma::accu(eps_j_1%eps_j_1)/sigma2_eps;
- 		double log_prob_0 = -0.5*arma::accu(eps_j%eps_j)/sigma2_eps;
- 		double prob = 0.0;
- 		if(log_prob_1>log_prob_0){
- 			prob = 1.0/(1.0+exp(log_prob_0-log_prob_1));
- 		} else{
- 			prob = exp(log_prob_1-log_prob_0);
- 			prob = prob/(1+prob);
- 		}
- 		if(arma::randu<double>() < prob){
- 			delta(j) = 1L;
- 			eps = eps_j - xphi_j;
- 		} else{
- 			delta(j) = 0L;
- 			eps = eps_j;
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
+
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	arma::vec ys = U.t()*y;
+
+ 	arma::mat betacoef_path;
+ 	arma::vec sigma2_eps_path;
+ 	arma::vec tau2_path;
+ 	arma::ivec iter_path;
+ 	betacoef_path.zeros(p,K);
+ 	sigma2_eps_path.zeros(K);
+ 	tau2_path.zeros(K);
+ 	iter_path.zeros(K);
+
+ 	//t_sigma2_eps_0 = t_tau2_0 = 0 uses the default starting values
+ 	double t_sigma2_eps_0 = 0;
+ 	double t_tau2_0 = 0;
+ 	for(int k=0;k<K;k++){
+ 		arma::vec t_sigma2_eps_list;
+ 		arma::vec t_tau2_list;
+ 		arma::vec t_E2_list;
+ 		arma::vec t_B2_list;
+ 		arma::vec betacoef;
+ 		double sigma2_eps;
+ 		double tau2;
+ 		mfvb_normal_lm_svd(betacoef, sigma2_eps, tau2,
+                      t_E2_list, t_B2_list, t_tau2_list, t_sigma2_eps_list,
+                      d, V, ys, p, n, max_iter,
+                      path_value(a_sigma_grid,k), path_value(b_sigma_grid,k),
+                      path_value(A_tau,k), tol, t_sigma2_eps_0, t_tau2_0);
+ 		betacoef_path.col(k) = betacoef;
+ 		sigma2_eps_path(k) = sigma2_eps;
+ 		tau2_path(k) = tau2;
+
+ 		//warm start the next fit from the last variational parameters
+ 		arma::uvec idx = arma::find(t_tau2_list>0);
+ 		if(idx.n_elem>0){
+ 			iter_path(k) = idx.n_elem;
+ 			t_tau2_0 = t_tau2_list(idx(idx.n_elem-1));
+ 			t_sigma2_eps_0 = t_sigma2_eps_list(idx(idx.n_elem-1));
  		}
  	}
- 	//update Z
- 	arma::uvec active_idx = arma::find(delta==1L);
- 	Z = X.cols(active_idx)*Phi.rows(active_idx);
 
- 	//update theta
- 	arma::vec lambda2 = lambda%lambda;
- 	double sigma_eps = sqrt(sigma2_eps);
- 	double tau = sqrt(tau2);
- 	double inv_tau2 = 1.0/tau2;
- 	arma::vec alpha_1 = arma::randn<arma::vec>(p)%lambda;
- 	alpha_1 *= sigma_eps*tau;
- 	arma::vec alpha_2 = arma::randn<arma::vec>(n);
- 	alpha_2 *= sigma_eps;
- 	arma::mat LambdaZt = Z.t();
- 	for(int i=0;i<n;i++){
- 		LambdaZt.col(i) %= lambda;
- 	}
- 	arma::mat ZZt = arma::eye(n,n);
- 	ZZt += tau2*LambdaZt.t()*LambdaZt;
- 	arma::vec theta_s = arma::solve(ZZt, y - Z*alpha_1 - alpha_2,arma::solve_opts::fast);
- 	theta = alpha_1 + tau2*lambda2%(Z.t()*theta_s);
- 	//update betacoef
- 	betacoef = Phi*theta;
- 	//update eps
- 	eps = y - Z*theta;
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef_path,
+                                            Named("betacoef") = betacoef_path,
+                                            Named("sigma2_eps") = sigma2_eps_path,
+                                            Named("tau2") = tau2_path);
 
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("iter") = iter_path,
+                            Named("elapsed") = elapsed);
+}
 
- 	//update lambda
- 	arma::vec theta2 = theta%theta;
- 	arma::vec inv_lambda2 = arma::randg<arma::vec>(p,distr_param(1.0,1.0));
- 	inv_lambda2 /= b_lambda + 0.5*theta2/tau2/sigma2_eps;
- 	b_lambda = randg<arma::vec>(p,distr_param(1.0, 1.0));
- 	b_lambda /= 1.0/A2_lambda+inv_lambda2;
- 	lambda = sqrt(1.0/inv_lambda2);
+//'@title Fast mean field variational Bayesian logistic regression with normal priors along a path of hyperparameters
+//'@param y vector of n binrary outcome variables taking values 0 or 1
+//'@param X n x p matrix of candidate predictors
+//'@param A vector of K scale parameters in the half Cauchy prior for regression coefficients
+//'@param max_iter maximum number of iterations of each fit
+//'@param tol the tolerance for the parameter changes
+//'@return a list object consisting of four components
+//'\describe{
+//'\item{post_mean}{a list object of two components for posterior mean statistics}
+//'\describe{
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients}
+//'\item{inv_tau_sq}{a vector of posterior mean of the inverse prior variance of regression coefficients}
+//'}
+//'\item{iter}{number of iterations used by each fit}
+//'\item{convergence}{zero for the fits that converged}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_logit_reg(n=2000,p=20,X_cor=0.9,q=10)
+//'res <- with(dat,fast_mfvb_normal_logit_path(y,X,A=10^seq(-1,2,length=10)))
+//'print(res$iter)
+//'@export
+//[[Rcpp::export]]
+Rcpp::List fast_mfvb_normal_logit_path(arma::vec& y, arma::mat& X,
+                                       arma::vec& A,
+                                       int max_iter = 5000,
+                                       double tol = 1e-05){
 
- 	//update tau2, sigma2_eps, b_tau and b_lambda
- 	double sum_eps2 = arma::accu(eps%eps);
- 	double sum_theta2_inv_lambda2 = arma::accu(theta2%inv_lambda2);
- 	inv_tau2 = randg<double>(distr_param((1.0+L)/2.0,1.0/(b_tau+0.5*sum_theta2_inv_lambda2/sigma2_eps)));
- 	b_tau = randg<double>(distr_param(1.0,1.0/(1.0/A2 + inv_tau2)));
- 	tau2 = 1.0/inv_tau2;
- 	double inv_sigma2_eps = arma::randg<double>(distr_param(a_sigma+(L+n)/2, 1.0/(b_sigma+0.5*sum_theta2_inv_lambda2*inv_tau2+0.5*sum_eps2)));
- 	sigma2_eps = 1.0/inv_sigma2_eps;
- }
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	if(A.n_elem==0)
+ 		Rcpp::stop("A must not be empty");
+ 	int K = A.n_elem;
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
 
-//'@title Fast Mean Field Varational Bayesian linear regression with normal priors
+ 	arma::mat betacoef_path;
+ 	arma::vec inv_tau_sq_path;
+ 	arma::ivec iter_path;
+ 	arma::vec convergence_path;
+ 	betacoef_path.zeros(p,K);
+ 	inv_tau_sq_path.zeros(K);
+ 	iter_path.zeros(K);
+ 	convergence_path.zeros(K);
+
+ 	//the first fit uses the default starting values, the others start
+ 	//from the omega and inv_tau_sq of the previous fit; E_beta is not
+ 	//passed on since the first beta update would reproduce it exactly and
+ 	//stop the fit before A(k) enters the inv_tau_sq update
+ 	Rcpp::NumericVector E_omega(n, 1.0);
+ 	double E_inv_tau_sq = 1;
+ 	for(int k=0;k<K;k++){
+ 		Rcpp::List fit = fast_mfvb_normal_logit(y, X, max_iter, tol, A(k),
+                                           E_inv_tau_sq, E_omega, R_NilValue);
+ 		Rcpp::List fit_mean = fit["post_mean"];
+ 		E_omega = Rcpp::as<Rcpp::NumericVector>(fit_mean["omega"]);
+ 		E_inv_tau_sq = Rcpp::as<double>(fit_mean["inv_tau_sq"]);
+ 		betacoef_path.col(k) = Rcpp::as<arma::vec>(fit_mean["betacoef"]);
+ 		inv_tau_sq_path(k) = E_inv_tau_sq;
+ 		iter_path(k) = Rcpp::as<int>(fit["iter"]);
+ 		convergence_path(k) = Rcpp::as<double>(fit["convergence"]);
+ 	}
+
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("betacoef") = betacoef_path,
+                                            Named("inv_tau_sq") = inv_tau_sq_path);
+
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("iter") = iter_path,
+                            Named("convergence") = convergence_path,
+                            Named("elapsed") = elapsed);
+}
+
+//'@title Fast Bayesian linear regression with normal priors along a path of hyperparameters
 //'@param y vector of n outcome variables
 //'@param X n x p matrix of candidate predictors
-//'@param max_iter max number of iterations
-//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
-//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
-//'@param A_tau scale parameter in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param A_tau vector of K scale parameters in the half Cauchy prior of the ratio between the coefficient variance and the noise variance
+//'@param a_sigma shape parameters in the inverse gamma prior of the noise variance; either one value or K values
+//'@param b_sigma rate parameters in the inverse gamma prior of the noise variance; either one value or K values
+//'@param mcmc_sample number of MCMC iterations saved for each grid point
+//'@param burnin number of iterations before start to save for the first grid point
+//'@param burnin_warm number of iterations before start to save for the other grid points,
+//'whose chains continue from the last state of the previous grid point
+//'@param thinning number of iterations to skip between two saved iterations
 //'@return a list object consisting of two components
 //'\describe{
 //'\item{post_mean}{a list object of four components for posterior mean statistics}
-//'\itemize{
-//'\item{mu: a vector of posterior predictive mean of the n training sample}
-//'\item{betacoef: a vector of posterior mean of p regression coeficients}
-//'\item{sigma2_eps: posterior mean of the noise variance}
-//'\item{tau2: posterior mean of the ratio between prior regression coefficient variances and the noise variance}
-//'}
-//'\item{trace}{a list object for parameter updates}
-//'\itemize{
-//'\item{t_E2: posterior mean of residual squared}
-//'\item{t_B2: posterior mean of L2 norm of the regression coeficients}
-//'\item{t_tau2: posterior mean of the ratio between prior regression coefficient variances and the noise variance}
-//'\item{t_sigma2_eps: posterior mean of the noise variance}
+//'\describe{
+//'\item{mu}{an n x K matrix of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance}
+//'\item{tau2}{a vector of posterior mean of the ratio between prior regression coefficient variances and the noise variance}
 //'}
+//'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'res1 <- with(dat1,fast_mfvb_normal_lm(y,X))
-//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
-//'res2 <- with(dat2,fast_mfvb_normal_lm(y,X))
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
-//'time=c(res1$elapsed,res2$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
-//'fast_normal_tab <- tab
-//'print(fast_normal_tab)
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'res <- with(dat,fast_normal_lm_path(y,X,A_tau=10^seq(-2,2,length=10)))
+//'matplot(t(res$post_mean$betacoef),type="l")
 //'@export
 //[[Rcpp::export]]
-Rcpp::List fast_mfvb_normal_lm(arma::vec& y, arma::mat& X,
-                                int max_iter = 500,
-                                double a_sigma = 0.01, double b_sigma = 0.01,
-                                double A_tau = 1,double tol = 1e-5,
-                                double t_sigma2_eps_0 = 0, double t_tau2_0 = 0){
+Rcpp::List fast_normal_lm_path(arma::vec& y, arma::mat& X,
+                               arma::vec& A_tau,
+                               Rcpp::NumericVector a_sigma = Rcpp::NumericVector::create(0.01),
+                               Rcpp::NumericVector b_sigma = Rcpp::NumericVector::create(0.01),
+                               int mcmc_sample = 500,
+                               int burnin = 500, int burnin_warm = 100,
+                               int thinning = 1){
 
  	arma::wall_clock timer;
  	timer.tic();
+ 	arma::vec a_sigma_grid = Rcpp::as<arma::vec>(a_sigma);
+ 	arma::vec b_sigma_grid = Rcpp::as<arma::vec>(b_sigma);
+ 	int K = path_length(A_tau, a_sigma_grid, b_sigma_grid);
+
  	arma::vec d;
  	arma::mat U;
  	arma::mat V;
  	arma::svd_econ(U,d,V,X);
 
- 	//std::cout << "U (" << U.n_rows << "," << U.n_cols << ")" << std::endl;
- 	//std::cout << "d (" << d.n_elem  << ")" << std::endl;
- 	//std::cout << "V (" << V.n_rows << "," << V.n_cols << ")" << std::endl;
-
  	int p = X.n_cols;
  	int n = X.n_rows;
- 	double A2_tau = A_tau*A_tau;
  	arma::vec d2 = d%d;
  	arma::vec ys = U.t()*y;
- 	arma::vec ys2 = ys%ys;
 
- 	arma::vec t_sigma2_eps_list;
- 	arma::vec t_tau2_list;
- 	arma::vec t_E2_list;
- 	arma::vec t_B2_list;
- 	t_tau2_list.zeros(max_iter);
- 	t_E2_list.zeros(max_iter);
- 	t_B2_list.zeros(max_iter);
- 	t_sigma2_eps_list.zeros(max_iter);
+ 	arma::mat betacoef_path;
+ 	arma::vec sigma2_eps_path;
+ 	arma::vec tau2_path;
+ 	betacoef_path.zeros(p,K);
+ 	sigma2_eps_path.zeros(K);
+ 	tau2_path.zeros(K);
 
  	arma::vec betacoef;
+ 	arma::vec mu;
+ 	arma::vec beta_s_mean;
+ 	double sigma2_eps = b_sigma_grid(0)/a_sigma_grid(0);
+ 	double b_tau = A_tau(0)*A_tau(0);
+ 	double tau2 = b_tau;
 
- 	if(t_tau2_0<=0){
- 		t_tau2_0 = A2_tau;
+ 	for(int k=0;k<K;k++){
+ 		double A2 = path_value(A_tau,k)*path_value(A_tau,k);
+ 		double a_sigma_k = path_value(a_sigma_grid,k);
+ 		double b_sigma_k = path_value(b_sigma_grid,k);
+ 		int burnin_k = k==0 ? burnin : burnin_warm;
+ 		arma::vec beta_s_sum = arma::zeros<arma::vec>(d.n_elem);
+
+ 		for(int iter=0;iter<burnin_k+mcmc_sample;iter++){
+ 			int n_step = iter<burnin_k ? 1 : thinning;
+ 			for(int j=0;j<n_step;j++){
+ 				if(p<n){
+ 					one_step_update_big_n(betacoef, beta_s_mean, sigma2_eps, tau2,
+                            b_tau, mu, ys,  V,  d, d2, y,  X,
+                            A2,  a_sigma_k,  b_sigma_k, p,  n);
+ 				} else{
+ 					one_step_update_big_p(betacoef, beta_s_mean, sigma2_eps, tau2,
+                            b_tau, mu, ys,  V,  d, d2, y,  X,
+                            A2,  a_sigma_k,  b_sigma_k, p,  n);
+ 				}
+ 			}
+ 			if(iter>=burnin_k){
+ 				beta_s_sum += beta_s_mean;
+ 				sigma2_eps_path(k) += sigma2_eps;
+ 				tau2_path(k) += tau2;
+ 			}
+ 		}
+ 		betacoef_path.col(k) = V*(beta_s_sum/mcmc_sample);
+ 		sigma2_eps_path(k) /= mcmc_sample;
+ 		tau2_path(k) /= mcmc_sample;
  	}
 
- 	double t_sigma2_eps = t_sigma2_eps_0;
- 	double t_tau2 = t_tau2_0;
- 	double t_b_tau = t_tau2;
- 	arma::vec d2_t_tau2 = d2*t_tau2;
- 	arma::vec inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2 );
- 	arma::vec ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
- 	double t_B2 = t_tau2*arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
-                                  t_sigma2_eps)%inv_one_d2_t_tau2);
- 	double t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
- 	double t_B2_0 = 2*t_B2;
- 	double err = abs(t_B2 - t_B2_0);
-
- 	if(p<n){
-
- 		int iter = 0;
- 		while((iter<max_iter) & (err > tol*t_B2_0)){
- 			t_sigma2_eps = (t_E2 + t_B2/t_tau2+2*b_sigma)/(2*(p+a_sigma));
- 			t_b_tau = t_tau2*A2_tau/(t_tau2+A2_tau);
- 			t_tau2 = (t_b_tau + t_B2/t_sigma2_eps)/(p+1);
- 			d2_t_tau2 = d2*t_tau2;
- 			inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2);
- 			ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
- 			t_B2_0 = t_B2;
- 			t_B2 = t_tau2*arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
- 				t_sigma2_eps)%inv_one_d2_t_tau2);
-
- 			t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
- 			err = abs(t_B2-t_B2_0);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef_path,
+                                            Named("betacoef") = betacoef_path,
+                                            Named("sigma2_eps") = sigma2_eps_path,
+                                            Named("tau2") = tau2_path);
 
- 			t_E2_list(iter) = t_E2;
- 			t_B2_list(iter) = t_B2;
- 			t_tau2_list(iter) = t_tau2;
- 			t_sigma2_eps_list(iter) = t_sigma2_eps;
+ 	double elapsed = timer.toc();
+ 	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("elapsed") = elapsed);
+}
 
- 			iter++;
- 		}
- 		betacoef = V*(inv_one_d2_t_tau2%d%ys)*t_tau2;
- 		if(iter<max_iter){
- 			t_E2_list.shed_rows(iter,max_iter-1);
- 			t_B2_list.shed_rows(iter,max_iter-1);
- 			t_tau2_list.shed_rows(iter,max_iter-1);
- 			t_sigma2_eps_list.shed_rows(iter,max_iter-1);
- 		}
+//'@title Fast Bayesian linear regression with horseshoe priors along a path of hyperparameters
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors
+//'@param A_tau vector of K scale parameters in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameters in the half Cauchy prior of the local shrinkage parameters; either one value or K values
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param mcmc_sample number of MCMC iterations saved for each grid point
+//'@param burnin number of iterations before start to save for the first grid point
+//'@param burnin_warm number of iterations before start to save for the other grid points,
+//'whose chains continue from the last state of the previous grid point
+//'@param thinning number of iterations to skip between two saved iterations
+//'@return a list object consisting of two components
+//'\describe{
+//'\item{post_mean}{a list object of five components for posterior mean statistics}
+//'\describe{
+//'\item{mu}{an n x K matrix of posterior predictive mean of the n training sample}
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients}
+//'\item{lambda}{a p x K matrix of posterior mean of the local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of posterior mean of the noise variance}
+//'\item{tau2}{a vector of posterior mean of the global shrinkage parameter}
+//'}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'set.seed(2022)
+//'dat <- sim_linear_reg(n=500,p=50,X_cor=0.9,q=6)
+//'res <- with(dat,fast_horseshoe_lm_path(y,X,A_tau=10^seq(-2,0,length=5)))
+//'matplot(t(res$post_mean$betacoef),type="l")
+//'@export
+//[[Rcpp::export]]
+Rcpp::List fast_horseshoe_lm_path(arma::vec& y, arma::mat& X,
+                                  arma::vec& A_tau,
+                                  Rcpp::NumericVector A_lambda = Rcpp::NumericVector::create(1),
+                                  double a_sigma = 0.0, double b_sigma = 0.0,
+                                  int mcmc_sample = 500,
+                                  int burnin = 500, int burnin_warm = 100,
+                                  int thinning = 1){
 
- 	} else{
+ 	arma::wall_clock timer;
+ 	timer.tic();
+ 	arma::vec A_lambda_grid = Rcpp::as<arma::vec>(A_lambda);
+ 	int K = path_length(A_tau, A_lambda_grid, A_tau);
 
- 		int iter = 0;
- 		while((iter<max_iter) & (err > tol*t_B2_0)){
- 			t_sigma2_eps = (t_E2 + t_B2/t_tau2+2*b_sigma)/(p+n+2*a_sigma);
- 			t_b_tau = t_tau2*A2_tau/(t_tau2+A2_tau);
- 			t_tau2 = (t_b_tau + t_B2/t_sigma2_eps)/(p+1);
- 			d2_t_tau2 = d2*t_tau2;
- 			inv_one_d2_t_tau2 = 1.0/(1.0+d2_t_tau2);
- 			ys2_inv_one_d2_t_tau2 = ys2%inv_one_d2_t_tau2;
- 			t_B2_0 = t_B2;
- 			t_B2 = t_tau2*(arma::accu((ys2_inv_one_d2_t_tau2%d2_t_tau2+
- 				t_sigma2_eps)%inv_one_d2_t_tau2)+(p - n)*t_sigma2_eps);
+ 	arma::vec d;
+ 	arma::mat U;
+ 	arma::mat V;
+ 	arma::svd_econ(U,d,V,X);
 
- 			t_E2 = arma::accu((ys2_inv_one_d2_t_tau2+t_sigma2_eps*d2_t_tau2)%inv_one_d2_t_tau2);
- 			err = abs(t_B2-t_B2_0);
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	arma::vec d2 = d%d;
+ 	arma::vec ys = U.t()*y;
+ 	arma::vec dys = d%ys;
+ 	arma::mat VD;
+ 	if(p>=n){
+ 		VD = V;
+ 		VD.each_row() %= d.t();
+ 	}
 
- 			t_E2_list(iter) = t_E2;
- 			t_B2_list(iter) = t_B2;
- 			t_tau2_list(iter) = t_tau2;
- 			t_sigma2_eps_list(iter) = t_sigma2_eps;
+ 	arma::mat betacoef_path;
+ 	arma::mat lambda_path;
+ 	arma::vec sigma2_eps_path;
+ 	arma::vec tau2_path;
+ 	betacoef_path.zeros(p,K);
+ 	lambda_path.zeros(p,K);
+ 	sigma2_eps_path.zeros(K);
+ 	tau2_path.zeros(K);
 
- 			iter++;
- 		}
- 		betacoef = V*(inv_one_d2_t_tau2%d%ys)*t_tau2;
- 		if(iter<max_iter){
- 			t_E2_list.shed_rows(iter,max_iter-1);
- 			t_B2_list.shed_rows(iter,max_iter-1);
- 			t_tau2_list.shed_rows(iter,max_iter-1);
- 			t_sigma2_eps_list.shed_rows(iter,max_iter-1);
- 		}
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
  	}
+ 	double b_tau = 1;
+ 	double tau2 = 1.0/p;
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	lambda.ones(p);
+ 	b_lambda.ones(p);
+ 	arma::vec mu;
 
- 	double sigma2_eps;
- 	double tau2 = (t_b_tau+t_B2/t_sigma2_eps)/p;
- 	if(n < p){
- 		sigma2_eps = (t_E2+t_B2/t_tau2+2*b_sigma)/(n+p+2*a_sigma);
- 	} else{
- 		sigma2_eps = (t_E2+t_B2/t_tau2+2*b_sigma)/(2*p+2*a_sigma);
+ 	for(int k=0;k<K;k++){
+ 		double A2 = path_value(A_tau,k)*path_value(A_tau,k);
+ 		double A2_lambda = path_value(A_lambda_grid,k)*path_value(A_lambda_grid,k);
+ 		int burnin_k = k==0 ? burnin : burnin_warm;
+
+ 		for(int iter=0;iter<burnin_k+mcmc_sample;iter++){
+ 			int n_step = iter<burnin_k ? 1 : thinning;
+ 			for(int j=0;j<n_step;j++){
+ 				if(p<n){
+ 					hs_one_step_update_big_n(betacoef,lambda, sigma2_eps, tau2,b_lambda,
+                               b_tau, mu, dys,  V,  d2, y, X,
+                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 				} else{
+ 					hs_one_step_update_big_p(betacoef, lambda, sigma2_eps, tau2,
+                               b_tau, b_lambda, mu, ys,  V,  d, d2, y,  X, VD,
+                               A2, A2_lambda, a_sigma,  b_sigma, p,  n);
+ 				}
+ 			}
+ 			if(iter>=burnin_k){
+ 				betacoef_path.col(k) += betacoef;
+ 				lambda_path.col(k) += lambda;
+ 				sigma2_eps_path(k) += sigma2_eps;
+ 				tau2_path(k) += tau2;
+ 			}
+ 		}
+ 		betacoef_path.col(k) /= mcmc_sample;
+ 		lambda_path.col(k) /= mcmc_sample;
+ 		sigma2_eps_path(k) /= mcmc_sample;
+ 		tau2_path(k) /= mcmc_sample;
  	}
 
-
- 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
-                                            Named("betacoef") = betacoef,
-                                            Named("sigma2_eps") = sigma2_eps,
-                                            Named("tau2") = tau2);
- 	Rcpp::List trace = Rcpp::List::create(Named("t_E2") = t_E2_list,
-                                        Named("t_B2") = t_B2_list,
-                                        Named("t_tau2") = t_tau2_list,
-                                        Named("t_sigma2_eps") = t_sigma2_eps_list);
+ 	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef_path,
+                                            Named("betacoef") = betacoef_path,
+                                            Named("lambda") = lambda_path,
+                                            Named("sigma2_eps") = sigma2_eps_path,
+                                            Named("tau2") = tau2_path);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
-                            Named("trace") = trace,
                             Named("elapsed") = elapsed);
- }
+}
 
-//Define the function for high dimensional case
-class H_fun: public Optim{
-public:
-	H_fun(const arma::mat& in_d_sq,
-       const arma::mat& in_z_sq) : d_sq(in_d_sq), z_sq(in_z_sq){
+// Background fit jobs: designs are registered once and shared read-only by
+// all jobs, together with their SVD which is computed on first use. Jobs run
+// on a package-level pool of worker threads; only the deterministic fitters
+// are supported since the MCMC samplers draw from R's RNG and call pgdraw
+struct fit_design{
+	arma::mat X;
+	arma::mat U;
+	arma::vec d;
+	arma::mat V;
+	arma::mat gram;
+	bool svd_ok;
+	std::once_flag svd_flag;
+	std::once_flag gram_flag;
+	fit_design(const arma::mat& in_X, bool numa_interleave) : svd_ok(false){
+		first_touch_copy(X, in_X, numa_interleave ? 0 : 1);
 	}
-
-
-	double value(double theta){
-		arma::mat d_sq_theta = (d_sq + theta);
-		arma::mat term1 = z_sq/d_sq_theta;
-		arma::mat term2 = arma::log(d_sq_theta);
-		double value = std::log(arma::accu(term1));
-		value *= -0.5*d_sq.n_elem;
-		value -= 0.5*arma::accu(term2);
-		return value;
+	void compute_svd(){
+		std::call_once(svd_flag, [this](){ svd_ok = arma::svd_econ(U,d,V,X); });
+	}
+	//X'X when p < n and XX' otherwise, used by cross-validation folds
+	void compute_gram(){
+		std::call_once(gram_flag, [this](){
+			gram = X.n_cols < X.n_rows ? arma::mat(X.t()*X) : arma::mat(X*X.t());
+		});
 	}
+};
 
-private:
-	const arma::mat& d_sq;
-	const arma::mat& z_sq;
-	/*void Gradient(const arma::mat& theta, arma::mat& grad){
-		grad.set_size(1, 1);
-		grad[0] = 0.0;
-		arma::mat inv_d_sq_theta = 1.0/(d_sq + theta[0]);
-		grad[0] = arma::accu(z_sq%inv_d_sq_theta%inv_d_sq_theta);
-		grad[0] /= arma::accu(z_sq%inv_d_sq_theta);
-		grad[0] *= -0.5*d_sq.n_elem;
-		grad[0] += 0.5*arma::accu(inv_d_sq_theta);
-	}*/
+enum fit_job_status {JOB_QUEUED, JOB_RUNNING, JOB_DONE, JOB_CANCELLED, JOB_FAILED};
+
+struct fit_job{
+	std::string fun;
+	std::shared_ptr<fit_design> design;
+	arma::vec y;
+	double theta;
+	int max_iter;
+	double a_sigma;
+	double b_sigma;
+	double A_tau;
+	double tol;
+	std::atomic<int> status;
+	std::atomic<bool> cancel;
+	arma::vec betacoef;
+	double sigma2_eps;
+	double tau2;
+	arma::vec t_E2_list;
+	arma::vec t_B2_list;
+	arma::vec t_tau2_list;
+	arma::vec t_sigma2_eps_list;
+	double elapsed;
+	std::string error;
+	std::mutex mtx;
+	std::condition_variable cv;
+	fit_job() : status(JOB_QUEUED), cancel(false){
+	}
+	void finish(int new_status){
+		std::lock_guard<std::mutex> lock(mtx);
+		status = new_status;
+		cv.notify_all();
+	}
+	void run(){
+		int expected = JOB_QUEUED;
+		if(cancel.load() || !status.compare_exchange_strong(expected, JOB_RUNNING)){
+			finish(JOB_CANCELLED);
+			return;
+		}
+		try{
+			arma::wall_clock timer;
+			timer.tic();
+			design->compute_svd();
+			if(!design->svd_ok)
+				throw std::runtime_error("svd of the design matrix failed");
+			if(fun=="super_fast_normal_lm"){
+				sigma2_eps = 1.0;
+				theta = super_fast_normal_lm_svd(betacoef, sigma2_eps, design->U,
+                                     design->d, design->V, y, theta);
+			} else{
+				arma::vec ys = design->U.t()*y;
+				mfvb_normal_lm_svd(betacoef, sigma2_eps, tau2,
+                       t_E2_list, t_B2_list, t_tau2_list, t_sigma2_eps_list,
+                       design->d, design->V, ys, design->X.n_cols, design->X.n_rows,
+                       max_iter, a_sigma, b_sigma, A_tau, tol, 0, 0, &cancel);
+			}
+			elapsed = timer.toc();
+			bool cancelled = fun=="fast_mfvb_normal_lm" && cancel.load();
+			finish(cancelled ? JOB_CANCELLED : JOB_DONE);
+		} catch(std::exception& e){
+			error = e.what();
+			finish(JOB_FAILED);
+		}
+	}
 };
 
-//Define the function for large sample size
-class L_fun: public Optim{
+class fit_job_pool{
 public:
-	L_fun(const arma::mat& in_d_sq,
-       const arma::mat& in_z_sq,
-       const double& in_sum_y_sq,
-       const int& in_n) : d_sq(in_d_sq),
-       z_sq(in_z_sq), sum_y_sq(in_sum_y_sq), n(in_n){
+	fit_job_pool() : stopping(false){
 	}
-
-
-	double value(double theta){
-		arma::mat d_sq_theta = (d_sq + theta);
-		arma::mat term1 = d_sq%z_sq/d_sq_theta;
-		arma::mat term2 = arma::log(d_sq_theta);
-		double value = std::log(sum_y_sq - arma::accu(term1));
-		value *= -0.5*n;
-		value -= 0.5*arma::accu(term2);
-		return value;
+	~fit_job_pool(){
+		stop();
+	}
+	void push(std::shared_ptr<fit_job> job){
+		std::lock_guard<std::mutex> lock(mtx);
+		if(workers.empty()){
+			stopping = false;
+			int n_threads = std::max(1u, std::thread::hardware_concurrency());
+			for(int i=0;i<n_threads;i++)
+				workers.push_back(std::thread(&fit_job_pool::worker_loop, this));
+		}
+		queue.push_back(job);
+		cv.notify_one();
+	}
+	void stop(){
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			stopping = true;
+			for(auto& job : queue)
+				job->cancel = true;
+			cv.notify_all();
+		}
+		for(auto& worker : workers)
+			worker.join();
+		workers.clear();
 	}
-
 private:
-	const arma::mat& d_sq;
-	const arma::mat& z_sq;
-	const double& sum_y_sq;
-	const int& n;
-	/*void Gradient(const arma::mat& theta, arma::mat& grad){
-	 grad.set_size(1, 1);
-	 grad[0] = 0.0;
-	 arma::mat inv_d_sq_theta = 1.0/(d_sq + theta[0]);
-	 grad[0] = arma::accu(z_sq%inv_d_sq_theta%inv_d_sq_theta);
-	 grad[0] /= arma::accu(z_sq%inv_d_sq_theta);
-	 grad[0] *= -0.5*d_sq.n_elem;
-	 grad[0] += 0.5*arma::accu(inv_d_sq_theta);
-	}*/
+	void worker_loop(){
+		while(true){
+			std::shared_ptr<fit_job> job;
+			{
+				std::unique_lock<std::mutex> lock(mtx);
+				cv.wait(lock, [this](){ return stopping || !queue.empty(); });
+				if(queue.empty())
+					return;
+				job = queue.front();
+				queue.pop_front();
+			}
+			job->run();
+		}
+	}
+	std::vector<std::thread> workers;
+	std::deque<std::shared_ptr<fit_job> > queue;
+	std::mutex mtx;
+	std::condition_variable cv;
+	bool stopping;
 };
 
+fit_job_pool& fit_pool(){
+	static fit_job_pool pool;
+	return pool;
+}
+
+std::map<int, std::shared_ptr<fit_design> > fit_designs;
+std::map<int, std::shared_ptr<fit_job> > fit_jobs;
+int fit_design_count = 0;
+int fit_job_count = 0;
+
+std::shared_ptr<fit_job> find_fit_job(int job){
+	std::map<int, std::shared_ptr<fit_job> >::iterator it = fit_jobs.find(job);
+	if(it==fit_jobs.end())
+		Rcpp::stop("unknown fit job %d", job);
+	return it->second;
+}
+
+double fit_arg(Rcpp::List& args, const char* name, double value){
+	if(args.containsElementNamed(name))
+		value = Rcpp::as<double>(args[name]);
+	return value;
+}
+
+extern "C" void R_unload_fastBayesReg(DllInfo *dll){
+	for(auto& job : fit_jobs)
+		job.second->cancel = true;
+	fit_pool().stop();
+}
+
+//'@title Register a design matrix shared by background fit jobs
+//'@param X n x p matrix of candidate predictors
+//'@param numa_interleave logical value; if true the copy of X is written by all
+//'OpenMP threads, so that with OMP_PROC_BIND=spread its pages are spread over
+//'the NUMA nodes used by \link{cv_fit}. Default value is false
+//'@return an integer handle of the design; the matrix and its SVD are kept
+//'in memory until \link{release_design} is called
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'design <- register_design(dat$X)
+//'job <- submit_fit("super_fast_normal_lm",dat$y,design)
+//'res <- wait_fit(job)
+//'release_design(design)
 //'@export
 //[[Rcpp::export]]
-double Rcpp_optimize_H(arma::mat& d_sq, arma::mat& z_sq){
-	H_fun h(d_sq, z_sq);
-	double theta_max = optimize(&h, 0, 10000, true, 1e-3);
-	return theta_max;
+int register_design(arma::mat& X, bool numa_interleave = false){
+	fit_design_count++;
+	fit_designs[fit_design_count] = std::make_shared<fit_design>(X, numa_interleave);
+	return fit_design_count;
 }
 
+//'@title Release a design matrix registered by register_design
+//'@param design integer handle returned by \link{register_design}
+//'@return logical value indicating whether the design was registered;
+//'jobs already submitted keep their own reference to the design
+//'@author Jian Kang <jiankang@umich.edu>
 //'@export
 //[[Rcpp::export]]
-double Rcpp_optimize_L(arma::mat& d_sq,
-                       arma::mat& z_sq,
-                       double & sum_y_sq,
-                       int & n){
-	 L_fun l(d_sq, z_sq, sum_y_sq, n);
-	 double theta_max = optimize(&l, 0, 10000, true, 1e-3);
-	 return theta_max;
+bool release_design(int design){
+	return fit_designs.erase(design) > 0;
 }
 
-//'@title Super Fast Bayesian linear regression with normal priors (Tuning Free)
+//'@title Submit a fit to run in the background
+//'@param fun name of the fitting function, either "super_fast_normal_lm"
+//'or "fast_mfvb_normal_lm"
 //'@param y vector of n outcome variables
-//'@param X n x p matrix of candidate predictors
-//'@param theta shrinkage parameter
-//'@return a list object consisting of posterior mean estiamte
+//'@param design integer handle returned by \link{register_design}
+//'@param args a named list of optional arguments of \code{fun}: theta for
+//'super_fast_normal_lm; max_iter, a_sigma, b_sigma, A_tau and tol for fast_mfvb_normal_lm
+//'@return an integer handle of the job used by \link{poll_fit}, \link{wait_fit} and \link{cancel_fit}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'design <- register_design(dat$X)
+//'jobs <- sapply(1:10,function(i) submit_fit("fast_mfvb_normal_lm",dat$y+rnorm(2000),design))
+//'res <- lapply(jobs,wait_fit)
+//'release_design(design)
+//'@export
+//[[Rcpp::export]]
+int submit_fit(std::string fun, arma::vec& y, int design,
+               Rcpp::Nullable<Rcpp::List> args = R_NilValue){
+	if(fun!="super_fast_normal_lm" && fun!="fast_mfvb_normal_lm")
+		Rcpp::stop("fun must be either super_fast_normal_lm or fast_mfvb_normal_lm");
+	std::map<int, std::shared_ptr<fit_design> >::iterator it = fit_designs.find(design);
+	if(it==fit_designs.end())
+		Rcpp::stop("unknown design %d", design);
+	if(y.n_elem != it->second->X.n_rows)
+		Rcpp::stop("y must have the same length as the number of rows of the design");
+	Rcpp::List args_list;
+	if(args.isNotNull())
+		args_list = Rcpp::as<Rcpp::List>(args);
+
+	std::shared_ptr<fit_job> job = std::make_shared<fit_job>();
+	job->fun = fun;
+	job->design = it->second;
+	job->y = y;
+	job->theta = fit_arg(args_list, "theta", -1.0);
+	job->max_iter = fit_arg(args_list, "max_iter", 500);
+	job->a_sigma = fit_arg(args_list, "a_sigma", 0.01);
+	job->b_sigma = fit_arg(args_list, "b_sigma", 0.01);
+	job->A_tau = fit_arg(args_list, "A_tau", 1);
+	job->tol = fit_arg(args_list, "tol", 1e-5);
+
+	fit_job_count++;
+	fit_jobs[fit_job_count] = job;
+	fit_pool().push(job);
+	return fit_job_count;
+}
+
+//'@title Poll the status of a background fit job
+//'@param job integer handle returned by \link{submit_fit}
+//'@return one of "queued", "running", "done", "cancelled" or "failed"
+//'@author Jian Kang <jiankang@umich.edu>
+//'@export
+//[[Rcpp::export]]
+std::string poll_fit(int job){
+	const char* status_names[] = {"queued", "running", "done", "cancelled", "failed"};
+	return status_names[find_fit_job(job)->status.load()];
+}
+
+//'@title Wait for a background fit job and collect its result
+//'@param job integer handle returned by \link{submit_fit}
+//'@return the same list object returned by the fitting function; the job
+//'is removed once its result has been collected
+//'@author Jian Kang <jiankang@umich.edu>
+//'@export
+//[[Rcpp::export]]
+Rcpp::List wait_fit(int job){
+	std::shared_ptr<fit_job> fit = find_fit_job(job);
+	{
+		std::unique_lock<std::mutex> lock(fit->mtx);
+		while(fit->status.load() < JOB_DONE){
+			fit->cv.wait_for(lock, std::chrono::milliseconds(100));
+			if(fit->status.load() < JOB_DONE){
+				lock.unlock();
+				Rcpp::checkUserInterrupt();
+				lock.lock();
+			}
+		}
+	}
+	fit_jobs.erase(job);
+	if(fit->status.load()==JOB_CANCELLED)
+		Rcpp::stop("fit job %d was cancelled", job);
+	if(fit->status.load()==JOB_FAILED)
+		Rcpp::stop("fit job %d failed: %s", job, fit->error);
+
+	if(fit->fun=="super_fast_normal_lm"){
+		Rcpp::List post_mean = Rcpp::List::create(Named("mu") = fit->design->X*fit->betacoef,
+                                              Named("betacoef") = fit->betacoef,
+                                              Named("sigma2_eps") = fit->sigma2_eps,
+                                              Named("theta") = fit->theta);
+		return Rcpp::List::create(Named("post_mean") = post_mean,
+                              Named("elapsed") = fit->elapsed);
+	}
+	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = fit->design->X*fit->betacoef,
+                                            Named("betacoef") = fit->betacoef,
+                                            Named("sigma2_eps") = fit->sigma2_eps,
+                                            Named("tau2") = fit->tau2);
+	Rcpp::List trace = Rcpp::List::create(Named("t_E2") = fit->t_E2_list,
+                                        Named("t_B2") = fit->t_B2_list,
+                                        Named("t_tau2") = fit->t_tau2_list,
+                                        Named("t_sigma2_eps") = fit->t_sigma2_eps_list);
+	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("trace") = trace,
+                            Named("elapsed") = fit->elapsed);
+}
+
+//'@title Cancel a background fit job
+//'@param job integer handle returned by \link{submit_fit}
+//'@return logical value indicating whether the job was stopped before it
+//'finished; queued jobs never start and running variational fits stop at the
+//'next iteration
+//'@author Jian Kang <jiankang@umich.edu>
+//'@export
+//[[Rcpp::export]]
+bool cancel_fit(int job){
+	std::shared_ptr<fit_job> fit = find_fit_job(job);
+	int expected = JOB_QUEUED;
+	if(fit->status.compare_exchange_strong(expected, JOB_CANCELLED)){
+		fit->cancel = true;
+		fit->finish(JOB_CANCELLED);
+		return true;
+	}
+	//only the variational fit checks the flag while it runs; the other
+	//running fits are left to finish
+	if(fit->status.load()==JOB_RUNNING && fit->fun=="fast_mfvb_normal_lm"){
+		fit->cancel = true;
+		return true;
+	}
+	return false;
+}
+
+// SVD pieces (d, V, ys = U'y) of the training rows of a cross-validation
+// fold, obtained from the Gram matrix of the whole design: when p < n the
+// cross product of the held-out rows is subtracted from X'X, otherwise the
+// training block of XX' is decomposed. Only the held-out rows are copied
+bool cv_fold_svd(arma::vec& d, arma::mat& V, arma::vec& ys,
+                 fit_design& design, const arma::vec& y,
+                 const arma::uvec& train_idx, const arma::uvec& test_idx){
+	const arma::mat& X = design.X;
+	arma::vec d2;
+	if(X.n_cols < X.n_rows){
+		if(X.n_cols >= train_idx.n_elem){
+			arma::mat X_train = X.rows(train_idx);
+			arma::vec y_train = y.elem(train_idx);
+			return batch_svd(d,V,ys,X_train,y_train);
+		}
+		arma::mat X_test = X.rows(test_idx);
+		arma::mat XtX = design.gram - X_test.t()*X_test;
+		if(!arma::eig_sym(d2, V, XtX))
+			return false;
+		arma::vec y_train = y;
+		y_train.elem(test_idx).zeros();
+		d2.elem(arma::find(d2<0)).zeros();
+		d = arma::sqrt(d2);
+		ys = V.t()*(X.t()*y_train);
+		double tol = d.max()*train_idx.n_elem*arma::datum::eps;
+		arma::uvec idx1 = arma::find(d > tol);
+		arma::uvec idx0 = arma::find(d <= tol);
+		ys.elem(idx1) /= d.elem(idx1);
+		ys.elem(idx0).zeros();
+		d.elem(idx0).zeros();
+	} else{
+		arma::mat W;
+		arma::mat XXt = design.gram.submat(train_idx, train_idx);
+		if(!arma::eig_sym(d2, W, XXt))
+			return false;
+		d2.elem(arma::find(d2<0)).zeros();
+		d = arma::sqrt(d2);
+		double tol = d.max()*X.n_cols*arma::datum::eps;
+		arma::uvec idx1 = arma::find(d > tol);
+		ys = W.t()*y.elem(train_idx);
+		//the near-zero singular values are kept as zeros with zero columns of
+		//V, so that a rank deficient fold keeps all n_train directions of U
+		d.elem(arma::find(d <= tol)).zeros();
+		//V = X_train'W/d with the rows of W scattered back into the full design
+		arma::mat U = arma::zeros<arma::mat>(X.n_rows, idx1.n_elem);
+		U.rows(train_idx) = W.cols(idx1);
+		arma::vec d1 = d.elem(idx1);
+		arma::mat V1 = X.t()*U;
+		V1.each_row() /= d1.t();
+		V = arma::zeros<arma::mat>(X.n_cols, d.n_elem);
+		V.cols(idx1) = V1;
+	}
+	return true;
+}
+
+//'@title K-fold cross-validation of a fit on a registered design
+//'@param fun name of the fitting function, either "super_fast_normal_lm"
+//'or "fast_mfvb_normal_lm"
+//'@param y vector of n outcome variables
+//'@param design integer handle returned by \link{register_design}
+//'@param fold vector of n fold labels taking all the values 1,...,K; the observations
+//'of each fold are held out in turn and predicted from a fit to the others
+//'@param args a named list of optional arguments of \code{fun}: theta for
+//'super_fast_normal_lm; max_iter, a_sigma, b_sigma, A_tau and tol for fast_mfvb_normal_lm
+//'@param n_threads number of OpenMP threads; 0 means all available threads
+//'@return a list object consisting of six components
+//'\describe{
+//'\item{cv_mse}{mean squared prediction error over all held-out observations}
+//'\item{fold_mse}{a vector of mean squared prediction errors of the K folds}
+//'\item{fold_size}{a vector of the numbers of held-out observations of the K folds}
+//'\item{mu}{a vector of held-out predictions of the n observations}
+//'\item{betacoef}{a p x K matrix of posterior mean of regression coeficients fitted without each fold}
+//'\item{elapsed}{running time}
+//'}
+//'@author Jian Kang <jiankang@umich.edu>
+//'@examples
+//'dat <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
+//'design <- register_design(dat$X)
+//'fold <- sample(rep(1:10,length=2000))
+//'res <- cv_fit("fast_mfvb_normal_lm",dat$y,design,fold)
+//'print(res$cv_mse)
+//'release_design(design)
+//'@export
+//[[Rcpp::export]]
+Rcpp::List cv_fit(std::string fun, arma::vec& y, int design,
+                  arma::ivec& fold,
+                  Rcpp::Nullable<Rcpp::List> args = R_NilValue,
+                  int n_threads = 0){
+	arma::wall_clock timer;
+	timer.tic();
+	if(fun!="super_fast_normal_lm" && fun!="fast_mfvb_normal_lm")
+		Rcpp::stop("fun must be either super_fast_normal_lm or fast_mfvb_normal_lm");
+	std::map<int, std::shared_ptr<fit_design> >::iterator it = fit_designs.find(design);
+	if(it==fit_designs.end())
+		Rcpp::stop("unknown design %d", design);
+	std::shared_ptr<fit_design> cv_design = it->second;
+	const arma::mat& X = cv_design->X;
+	if(y.n_elem != X.n_rows)
+		Rcpp::stop("y must have the same length as the number of rows of the design");
+	if(fold.n_elem != X.n_rows)
+		Rcpp::stop("fold must have the same length as y");
+	std::vector<arma::uvec> fold_idx = batch_group_index(fold, X.n_rows);
+	Rcpp::List args_list;
+	if(args.isNotNull())
+		args_list = Rcpp::as<Rcpp::List>(args);
+	double theta = fit_arg(args_list, "theta", -1.0);
+	int max_iter = fit_arg(args_list, "max_iter", 500);
+	double a_sigma = fit_arg(args_list, "a_sigma", 0.01);
+	double b_sigma = fit_arg(args_list, "b_sigma", 0.01);
+	double A_tau = fit_arg(args_list, "A_tau", 1);
+	double tol = fit_arg(args_list, "tol", 1e-5);
+
+	cv_design->compute_gram();
+	int K = fold_idx.size();
+	int p = X.n_cols;
+	int n = X.n_rows;
+	bool is_super_fast = fun=="super_fast_normal_lm";
+
+	arma::mat betacoef;
+	arma::vec mu;
+	arma::vec fold_mse;
+	arma::uvec fold_size(K);
+	betacoef.zeros(p,K);
+	mu.zeros(n);
+	fold_mse.zeros(K);
+	for(int k=0;k<K;k++)
+		fold_size(k) = fold_idx[k].n_elem;
+
+	#pragma omp parallel for schedule(dynamic) num_threads(get_num_threads(n_threads))
+	for(int k=0;k<K;k++){
+		const arma::uvec& test_idx = fold_idx[k];
+		if(test_idx.n_elem==0)
+			continue;
+		try{
+			arma::uvec in_train = arma::ones<arma::uvec>(n);
+			in_train.elem(test_idx).zeros();
+			arma::uvec train_idx = arma::find(in_train);
+			int n_train = train_idx.n_elem;
+			arma::vec d;
+			arma::mat V;
+			arma::vec ys;
+			if(n_train==0 || !cv_fold_svd(d,V,ys,*cv_design,y,train_idx,test_idx))
+				throw std::runtime_error("decomposition failed");
+			arma::vec betacoef_k;
+			if(is_super_fast){
+				arma::vec d_sq = d%d;
+				arma::vec z_sq = ys%ys;
+				double theta_k = theta;
+				if(theta_k<0){
+					if(p >= n_train){
+						H_fun h(d_sq, z_sq);
+						theta_k = optimize(&h, 0, 10000, true, 1e-3);
+					} else{
+						double sum_y_sq = arma::accu(arma::square(y.elem(train_idx)));
+						L_fun l(d_sq, z_sq, sum_y_sq, n_train);
+						theta_k = optimize(&l, 0, 10000, true, 1e-3);
+					}
+				}
+				betacoef_k = V*((d/(theta_k + d_sq))%ys);
+			} else{
+				arma::vec t_E2_list;
+				arma::vec t_B2_list;
+				arma::vec t_tau2_list;
+				arma::vec t_sigma2_eps_list;
+				double sigma2_eps;
+				double tau2;
+				mfvb_normal_lm_svd(betacoef_k, sigma2_eps, tau2,
+                       t_E2_list, t_B2_list, t_tau2_list, t_sigma2_eps_list,
+                       d, V, ys, p, n_train, max_iter, a_sigma, b_sigma, A_tau, tol, 0, 0);
+			}
+			arma::vec mu_k = X.rows(test_idx)*betacoef_k;
+			betacoef.col(k) = betacoef_k;
+			mu.elem(test_idx) = mu_k;
+			fold_mse(k) = arma::mean(arma::square(y.elem(test_idx) - mu_k));
+		} catch(std::exception& e){
+			betacoef.col(k).fill(arma::datum::nan);
+			mu.elem(test_idx).fill(arma::datum::nan);
+			fold_mse(k) = arma::datum::nan;
+		}
+	}
+
+	double cv_mse = arma::accu(fold_mse%arma::conv_to<arma::vec>::from(fold_size))/arma::accu(fold_size);
+
+	double elapsed = timer.toc();
+	return Rcpp::List::create(Named("cv_mse") = cv_mse,
+                           Named("fold_mse") = fold_mse,
+                           Named("fold_size") = fold_size,
+                           Named("mu") = mu,
+                           Named("betacoef") = betacoef,
+                           Named("elapsed") = elapsed);
+}
+
+
+//'@title Fast Bayesian Scalar-on-Image linear regression with basis expansion and horseshoe priors
+//'@param y vector of n outcome variables
+//'@param X n x p matrix of candidate predictors, e.g. vectorized images
+//'@param Phi p x L sparse matrix of basis functions, e.g. compactly supported
+//'basis functions evaluated at the p voxels
+//'@param mcmc_sample number of MCMC iterations saved
+//'@param burnin number of iterations before start to save
+//'@param thinning number of iterations to skip between two saved iterations
+//'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
+//'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
+//'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
+//'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
+//'@return a list object consisting of three components
+//'\describe{
+//'\item{post_mean}{a list object of seven components for posterior mean statistics}
 //'\describe{
 //'\item{mu}{a vector of posterior predictive mean of the n training sample}
 //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
+//'\item{theta}{a vector of posterior mean of L basis coeficients}
+//'\item{delta_prob}{a vector of posterior inclusion probabilities of p predictors}
+//'\item{lambda}{a vector of posterior mean of L local shrinkage parameters}
 //'\item{sigma2_eps}{posterior mean of the noise variance}
-//'\item{tau2}{posterior mean of the ratio between prior regression coefficient variances and the noise variance}
+//'\item{tau2}{posterior mean of the global parameter}
+//'}
+//'\item{mcmc}{a list object of four components for MCMC samples}
+//'\describe{
+//'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
+//'\item{lambda}{a matrix of MCMC samples of L local shrinkage parameters}
+//'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
+//'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
+//'}
+//'\item{elapsed}{running time}
 //'}
 //'@author Jian Kang <jiankang@umich.edu>
 //'@examples
 //'set.seed(2022)
-//'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
-//'res1 <- with(dat1,fast_normal_lm(y,X))
-//'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
-//'res2 <- with(dat2,fast_normal_lm(y,X))
-//'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
-//'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
-//'time=c(res1$elapsed,res2$elapsed))
-//'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
-//'fast_normal_tab <- tab
-//'print(fast_normal_tab)
+//'dat <- sim_linear_reg(n=200,p=1000,X_cor=0.5,q=20)
+//'Phi <- Matrix::sparseMatrix(i=1:1000,j=rep(1:100,each=10),x=1)
+//'res <- with(dat,fast_scalar_img_lm(y,X,Phi))
+//'print(comp_sparse_SSE(dat$betacoef,res$post_mean$betacoef))
 //'@export
 //[[Rcpp::export]]
-Rcpp::List super_fast_normal_lm(arma::vec& y, arma::mat& X,
-                                double theta = -1.0){
+Rcpp::List fast_scalar_img_lm(arma::vec& y, arma::mat& X, arma::sp_mat& Phi,
+                              int mcmc_sample = 500,
+                              int burnin = 500, int thinning = 1,
+                              double a_sigma = 0.0, double b_sigma = 0.0,
+                              double A_tau = 1, double A_lambda = 1){
 
  	arma::wall_clock timer;
  	timer.tic();
- 	arma::vec d;
- 	arma::mat U;
- 	arma::mat V;
- 	arma::svd_econ(U,d,V,X);
 
- 	arma::vec betacoef;
- 	arma::vec mu;
- 	double sigma2_eps = 1.0;
- 	//double theta = 0.0;
-
- 	//int p = X.n_cols;
- 	//int n = X.n_rows;
+ 	int p = X.n_cols;
+ 	int n = X.n_rows;
+ 	int L = Phi.n_cols;
+ 	if((int)Phi.n_rows != p)
+ 		Rcpp::stop("Phi must have as many rows as X has columns");
+
+ 	//rotate the data by U' when p < n; the residual sum of squares outside
+ 	//the column space of X does not depend on the parameters
+ 	arma::vec y_r;
+ 	arma::mat X_r;
+ 	double rss0 = 0.0;
+ 	if(p<n){
+ 		arma::vec d;
+ 		arma::mat U;
+ 		arma::mat V;
+ 		arma::svd_econ(U,d,V,X);
+ 		y_r = U.t()*y;
+ 		X_r = arma::diagmat(d)*V.t();
+ 		rss0 = arma::accu(y%y) - arma::accu(y_r%y_r);
+ 		if(rss0<0)
+ 			rss0 = 0.0;
+ 	} else{
+ 		y_r = y;
+ 		X_r = X;
+ 	}
 
- 	if(U.n_rows>0){
+ 	double sigma2_eps = 1;
+ 	if(a_sigma!=0.0){
+ 		sigma2_eps = b_sigma/a_sigma;
+ 	}
+ 	double A2 = A_tau*A_tau;
+ 	double A2_lambda = A_lambda*A_lambda;
+ 	double b_tau = 1;
+ 	double tau2 = 1;
 
- 		arma::vec d_sq = d%d;
- 		arma::vec z = U.t()*y;
- 		arma::vec z_sq = z%z;
+ 	arma::vec theta;
+ 	arma::uvec delta;
+ 	arma::vec betacoef;
+ 	arma::vec lambda;
+ 	arma::vec b_lambda;
+ 	arma::sp_mat Phi_t = Phi.t();
+ 	arma::mat Z = X_r*Phi;
+ 	arma::mat ZtZ;
+ 	arma::vec Zty;
+ 	arma::vec Xty = X_r.t()*y_r;
+ 	if(L < (int)X_r.n_rows){
+ 		ZtZ = Z.t()*Z;
+ 		Zty = Z.t()*y_r;
+ 	}
 
- 		H_fun h(d_sq, z_sq);
+ 	theta.zeros(L);
+ 	lambda.ones(L);
+ 	b_lambda.ones(L);
+ 	delta.ones(p);
+ 	betacoef.zeros(p);
+ 	arma::vec eps = y_r;
 
- 		double sum_y_sq = arma::accu(y%y);
+ 	arma::mat theta_list;
+ 	arma::umat delta_list;
+ 	arma::mat betacoef_list;
+ 	arma::mat lambda_list;
+ 	arma::vec sigma2_eps_list;
+ 	arma::vec tau2_list;
 
- 		L_fun l(d_sq, z_sq, sum_y_sq, X.n_rows);
+ 	delta_list.zeros(p,mcmc_sample);
+ 	betacoef_list.zeros(p,mcmc_sample);
+ 	theta_list.zeros(L,mcmc_sample);
+ 	lambda_list.zeros(L,mcmc_sample);
+ 	sigma2_eps_list.zeros(mcmc_sample);
+ 	tau2_list.zeros(mcmc_sample);
 
- 		if(theta<0){
- 			if(X.n_cols >= X.n_rows){
- 				theta = optimize(&h, 0, 10000, true, 1e-3);
- 			} else{
- 				theta = optimize(&l, 0, 10000, true, 1e-3);
- 			}
+ 	int num_sweeps = 0;
+ 	for(int iter=0;iter<burnin;iter++){
+ 		num_sweeps++;
+ 		scalar_img_one_step_update(theta, delta, lambda,
+                              sigma2_eps, tau2,
+                              b_tau,  b_lambda,  betacoef,
+                              y_r,  X_r, Xty, Z, ZtZ, Zty, Phi, Phi_t, eps,
+                              A2,  A2_lambda,
+                              a_sigma, b_sigma, rss0, p, n, L,
+                              num_sweeps%scalar_img_rebuild_every==0);
+ 	}
+ 	for(int iter=0;iter<mcmc_sample;iter++){
+ 		for(int j=0;j<thinning;j++){
+ 			num_sweeps++;
+ 			scalar_img_one_step_update(theta, delta, lambda,
+                               sigma2_eps, tau2,
+                               b_tau,  b_lambda,  betacoef,
+                               y_r,  X_r, Xty, Z, ZtZ, Zty, Phi, Phi_t, eps,
+                               A2,  A2_lambda,
+                               a_sigma, b_sigma, rss0, p, n, L,
+                               num_sweeps%scalar_img_rebuild_every==0);
  		}
- 		arma::vec theta_d_sq = theta + d_sq;
-
- 		betacoef = V*((d/theta_d_sq)%z);
- 		sigma2_eps = theta*arma::mean(z_sq/theta_d_sq);
+ 		theta_list.col(iter) = theta;
+ 		delta_list.col(iter) = delta;
+ 		betacoef_list.col(iter) = betacoef%delta;
+ 		lambda_list.col(iter) = lambda;
+ 		sigma2_eps_list(iter) = sigma2_eps;
+ 		tau2_list(iter) = tau2;
  	}
 
+ 	theta = arma::mean(theta_list,1);
+ 	arma::vec delta_prob = arma::mean(arma::conv_to<arma::mat>::from(delta_list),1);
+ 	betacoef = arma::mean(betacoef_list,1);
+ 	lambda = arma::mean(lambda_list,1);
+ 	sigma2_eps = arma::mean(sigma2_eps_list);
+ 	tau2 = arma::mean(tau2_list);
 
  	Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X*betacoef,
                                             Named("betacoef") = betacoef,
+                                            Named("theta") = theta,
+                                            Named("delta_prob") = delta_prob,
+                                            Named("lambda") = lambda,
                                             Named("sigma2_eps") = sigma2_eps,
-                                            Named("theta") = theta);
+                                            Named("tau2") = tau2);
+ 	Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
+                                       Named("lambda") = lambda_list,
+                                       Named("sigma2_eps") = sigma2_eps_list,
+                                       Named("tau2") = tau2_list);
 
  	double elapsed = timer.toc();
  	return Rcpp::List::create(Named("post_mean") = post_mean,
+                            Named("mcmc") = mcmc,
                             Named("elapsed") = elapsed);
-}
-
+ }
 
- /*
- //'@title Fast Bayesian Scalar-on-Image linear regression with Gaussian process priors
- //'@param y vector of n outcome variables
- //'@param X n x p matrix of candidate predictors
- //'@param Phi p x L matrix of basis function
- //'@param mcmc_sample number of MCMC iterations saved
- //'@param burnin number of iterations before start to save
- //'@param thinning number of iterations to skip between two saved iterations
- //'@param a_sigma shape parameter in the inverse gamma prior of the noise variance
- //'@param b_sigma rate parameter in the inverse gamma prior of the noise variance
- //'@param A_tau scale parameter in the half Cauchy prior of the global shrinkage parameter
- //'@param A_lambda scale parameter in the half Cauchy prior of the local shrinkage parameter
- //'@return a list object consisting of two components
- //'\describe{
- //'\item{post_mean}{a list object of four components for posterior mean statistics}
- //'\describe{
- //'\item{mu}{a vector of posterior predictive mean of the n training sample}
- //'\item{betacoef}{a vector of posterior mean of p regression coeficients}
- //'\item{lambda}{a vector of posterior mean of p local shrinkage parameters}
- //'\item{sigma2_eps}{posterior mean of the noise variance}
- //'\item{tau2}{posterior mean of the global parameter}
- //'}
- //'\item{mcmc}{a list object of three components for MCMC samples}
- //'\describe{
- //'\item{betacoef}{a matrix of MCMC samples of p regression coeficients}
- //'\item{lambda}{a matrix of MCMC samples of p local shrinkage parameters}
- //'\item{sigma2_eps}{a vector of MCMC samples of the noise variance}
- //'\item{tau2}{a vector of MCMC samples of the global shrinkage parameter}
- //'}
- //'}
- //'@author Jian Kang <jiankang@umich.edu>
- //'@examples
- //'set.seed(2022)
- //'dat1 <- sim_linear_reg(n=2000,p=200,X_cor=0.9,q=6)
- //'res1 <- with(dat1,fast_horseshoe_lm(y,X))
- //'dat2 <- sim_linear_reg(n=200,p=2000,X_cor=0.9,q=6)
- //'res2 <- with(dat2,fast_horseshoe_lm(y,X))
- //'tab <- data.frame(rbind(comp_sparse_SSE(dat1$betacoef,res1$post_mean$betacoef),
- //'comp_sparse_SSE(dat2$betacoef,res2$post_mean$betacoef)),
- //'time=c(res1$elapsed,res2$elapsed))
- //'rownames(tab)<-c("n = 2000, p = 200","n = 200, p = 2000")
- //'fast_horseshoe_tab <- tab
- //'print(fast_horseshoe_tab)
- //'@export
- //[[Rcpp::export]]
-  Rcpp::List fast_scalar_img_lm(arma::vec& y_, arma::mat& X_, arma::mat>& Phi,
-  int mcmc_sample = 500,
-  int burnin = 500, int thinning = 1,
-  double a_sigma = 0.0, double b_sigma = 0.0,
-  double A_tau = 1, double A_lambda = 1){
-
-  arma::wall_clock timer;
-  timer.tic();
-
-  arma::vec y;
-  arma::mat X;
-
-  if(p<n){
-  arma::vec d;
-  arma::mat U;
-  arma::mat V;
-  arma::svd_econ(U,d,V,X_);
-  y = U.t()*y_;
-  X = U.t()*X_;
-  } else{
-  y = y_;
-  X = X_;
-  }
-
-  int p = X.n_cols;
-  int n = X.n_rows;
-  int L = Phi.n_cols;
-
-  double sigma2_eps = 1;
-  if(a_sigma!=0.0){
-  sigma2_eps = b_sigma/a_sigma;
-  }
-  double A2 = A_tau*A_tau;
-  double A2_lambda = A_lambda*A_lambda;
-  double b_tau = 1;
-
-  double tau2 = 1;
-  arma::vec d2 = d%d;
-
-
-  arma::vec theta;
-  arma::uvec delta;
-  arma::vec betacoef;
-  arma::vec lambda;
-  arma::vec b_lambda;
-  arma::vec eps;
-  arma::mat Z = X*Phi;
-
-  theta.zeros(L);
-  lambda.ones(L);
-  b_lambda.ones(L);
-  delta.ones(p);
-  betacoef.zeros(p);
-  eps.zeros(n);
-
-
-  arma::mat theta_list;
-  arma::umat delta_list;
-  arma::mat betacoef_list;
-  arma::mat lambda_list;
-  arma::vec sigma2_eps_list;
-  arma::vec tau2_list;
-
-
-  delta_list.zeros(p,mcmc_sample);
-  betacoef_list.zeros(p,mcmc_sample);
-  theta_list.zeros(L,mcmc_sample);
-  lambda_list.zeros(L,mcmc_sample);
-  sigma2_eps_list.zeros(mcmc_sample);
-  tau2_list.zeros(mcmc_sample);
-
-
-  arma::mat XtX_inv = V*diagmat(1.0/d2)*V.t();
-  arma::vec Xty = X.t()*y;
-  for(int iter=0;iter<burnin;iter++){
-  scalar_img_one_step_update(theta, delta, lambda,
-  sigma2_eps, tau2,
-  b_tau,  b_lambda,  betacoef,
-  y,  X,  Z,  Phi, eps, A2,  A2_lambda,
-  a_sigma, b_sigma, p, n, L);
-  }
-  for(int iter=0;iter<mcmc_sample;iter++){
-  for(int j=0;j<thinning;j++){
-  scalar_img_one_step_update(theta, delta, lambda,
-  sigma2_eps, tau2,
-  b_tau,  b_lambda,  betacoef,
-  y,  X,  Z,  Phi, eps, A2,  A2_lambda,
-  a_sigma, b_sigma, p, n, L);
-  }
-  theta_list.col(iter) = theta;
-  delta_list.col(iter) = delta;
-  betacoef_list.col(iter) = betacoef;
-  lambda_list.col(iter) = lambda;
-  sigma2_eps_list(iter) = sigma2_eps;
-  tau2_list(iter) = tau2;
-  }
-
-
-  theta = arma::mean(theta_list,1);
-  arma::vec delta_prob = arma::mean(delta_list*1.0,1);
-  betacoef = arma::mean(betacoef_list,1);
-  lambda = arma::mean(lambda_list,1);
-  sigma2_eps = arma::mean(sigma2_eps_list);
-  tau2 = arma::mean(tau2_list);
-
-  Rcpp::List post_mean = Rcpp::List::create(Named("mu") = X_*betacoef,
-  Named("betacoef") = betacoef,
-  Named("theta") = theta,
-  Named("delta_prob") = delta_prob,
-  Named("lambda") = lambda,
-  Named("sigma2_eps") = sigma2_eps,
-  Named("tau2") = tau2);
-  Rcpp::List mcmc = Rcpp::List::create(Named("betacoef") = betacoef_list,
-  Named("lambda") = lambda_list,
-  Named("sigma2_eps") = sigma2_eps_list,
-  Named("tau2") = tau2_list);
-
-  double elapsed = timer.toc();
-  return Rcpp::List::create(Named("post_mean") = post_mean,
-  Named("mcmc") = mcmc,
-  Named("elapsed") = elapsed);
-  }*/